@@ -0,0 +1,194 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	atlas.c
+
+   Purpose:	  		Glyph atlas loading and blitting
+*/
+
+#include "atlas.h"
+#include "atlas_glyphs.h"
+
+#ifdef SPRITE_ATLAS
+
+/* Pixel rows follow the 12 byte GBitmap header, padded to 32 bits */
+#define ATLAS_HEADER 12
+#define ATLAS_ROW_BYTES ((ATLAS_WIDTH + 31) / 32 * 4)
+
+static uint8_t *atlas_data;
+static GBitmap *atlas_bitmap;
+
+bool atlas_load(void)
+{
+	ResHandle handle = resource_get_handle(RESOURCE_ID_GLYPH_ATLAS);
+	size_t size = resource_size(handle);
+
+	atlas_data = malloc(size);
+	if (!atlas_data)
+	{
+		return false;
+	}
+	resource_load(handle, atlas_data, size);
+	atlas_bitmap = gbitmap_create_with_data(atlas_data);
+	if (!atlas_bitmap)
+	{
+		atlas_unload();
+		return false;
+	}
+	return true;
+}
+
+void atlas_unload(void)
+{
+	if (atlas_bitmap)
+	{
+		gbitmap_destroy(atlas_bitmap);
+		atlas_bitmap = NULL;
+	}
+	free(atlas_data);
+	atlas_data = NULL;
+}
+
+// utility function to find a character's glyph; NULL for characters the font lacks
+static const AtlasGlyph* find_glyph(char c, int font)
+{
+	const AtlasFont *f = &AtlasFonts[font];
+
+	for (int i = 0; i < f->count; i++)
+	{
+		if (f->chars[i] == c)
+		{
+			return &AtlasGlyphs[f->first + i];
+		}
+	}
+	return NULL;
+}
+
+int atlas_text_width(const char *text, int font)
+{
+	int width = 0;
+
+	for (; *text; text++)
+	{
+		const AtlasGlyph *g = find_glyph(*text, font);
+		if (g)
+		{
+			width += g->advance;
+		}
+	}
+	return width;
+}
+
+void atlas_draw_text(GContext *ctx, const char *text, int font, int x, int y, GColor color)
+{
+	if (!atlas_bitmap)
+	{
+		return;
+	}
+
+	/* Glyph ink is set in the atlas: clear it into white tiles, or set it into black ones */
+	graphics_context_set_compositing_mode(ctx, gcolor_equal(color, GColorWhite) ? GCompOpOr : GCompOpClear);
+	for (; *text; text++)
+	{
+		const AtlasGlyph *g = find_glyph(*text, font);
+		if (!g)
+		{
+			continue;
+		}
+		gbitmap_set_bounds(atlas_bitmap, GRect(g->x, g->y, g->width, g->height));
+		graphics_draw_bitmap_in_rect(ctx, atlas_bitmap, GRect(x + g->left, y + g->top, g->width, g->height));
+		x += g->advance;
+	}
+	graphics_context_set_compositing_mode(ctx, GCompOpAssign);
+}
+
+// utility function to read up to 8 atlas pixels of one row, starting at column x
+static inline uint8_t atlas_bits(const uint8_t *row, int x, int n)
+{
+	unsigned bits = row[x >> 3] >> (x & 7);
+	if ((x & 7) + n > 8)
+	{
+		bits |= row[(x >> 3) + 1] << (8 - (x & 7));
+	}
+	return bits & ((1 << n) - 1);
+}
+
+void atlas_blit_text(GBitmap *frame, const char *text, int font, int x, int y, GColor color)
+{
+	if (!atlas_data)
+	{
+		return;
+	}
+
+	GRect bounds = gbitmap_get_bounds(frame);
+	uint16_t stride = gbitmap_get_bytes_per_row(frame);
+	uint8_t *pixels = gbitmap_get_data(frame);
+	bool bw = gbitmap_get_format(frame) == GBitmapFormat1Bit;
+	bool white = gcolor_equal(color, GColorWhite);
+
+	for (; *text; text++)
+	{
+		const AtlasGlyph *g = find_glyph(*text, font);
+		if (!g)
+		{
+			continue;
+		}
+
+		/* Columns and rows of the glyph that land on the screen */
+		int gx = x + g->left, gy = y + g->top;
+		int c0 = gx < 0 ? -gx : 0;
+		int c1 = gx + g->width > bounds.size.w ? bounds.size.w - gx : g->width;
+		int r0 = gy < 0 ? -gy : 0;
+		int r1 = gy + g->height > bounds.size.h ? bounds.size.h - gy : g->height;
+
+		for (int r = r0; r < r1; r++)
+		{
+			const uint8_t *src = atlas_data + ATLAS_HEADER + (g->y + r) * ATLAS_ROW_BYTES;
+			uint8_t *dst = pixels + (gy + r) * stride;
+
+			for (int c = c0; c < c1; c += 8)
+			{
+				int n = c1 - c < 8 ? c1 - c : 8;
+				uint8_t bits = atlas_bits(src, g->x + c, n);
+				if (!bits)
+				{
+					continue;
+				}
+				if (bw)
+				{
+					/* Up to 8 ink bits, shifted into one or two screen bytes */
+					int d = gx + c;
+					uint16_t ink = bits << (d & 7);
+					if (white)
+					{
+						dst[d >> 3] |= ink;
+						if (ink >> 8)
+						{
+							dst[(d >> 3) + 1] |= ink >> 8;
+						}
+					}
+					else
+					{
+						dst[d >> 3] &= ~ink;
+						if (ink >> 8)
+						{
+							dst[(d >> 3) + 1] &= ~(ink >> 8);
+						}
+					}
+				}
+				else
+				{
+					for (int i = 0; i < n; i++)
+					{
+						if (bits >> i & 1)
+						{
+							dst[gx + c + i] = color.argb;
+						}
+					}
+				}
+			}
+		}
+		x += g->advance;
+	}
+}
+
+#endif
@@ -0,0 +1,62 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	atlas.h
+
+   Purpose:	  		Tile text drawn from a pre-rasterized 1-bit glyph atlas
+   					(resources/data/glyph_atlas.bin, built by util/moonatlas)
+   					instead of TextLayers and custom fonts.
+*/
+
+#ifndef ATLAS_H
+#define ATLAS_H
+
+#include <pebble.h>
+
+/* Draw the tiles from the glyph atlas rather than with TextLayers.  The
+   atlas resource is declared in every build so that this switch alone
+   turns it on; builds without it carry its 6924 bytes unread */
+/* #define SPRITE_ATLAS 1 */
+
+/* Write changed tiles straight into the frame buffer from the atlas and
+   the cached backdrop, without graphics calls; implies SPRITE_ATLAS */
+/* #define FRAMEBUFFER_TILES 1 */
+
+#if defined(FRAMEBUFFER_TILES) && !defined(SPRITE_ATLAS)
+#define SPRITE_ATLAS 1
+#endif
+
+/* Tile fonts, in the order util/moonatlas packs them */
+enum { ATLAS_FONT_TIME, ATLAS_FONT_DAY, ATLAS_FONT_MOON, ATLAS_FONT_DATE, ATLAS_FONT_AMPM, ATLAS_FONT_COUNT };
+
+/* A glyph's rectangle in the atlas, and where it sits relative to the pen */
+typedef struct
+{
+	uint8_t x, y, width, height;
+	int8_t left, top;
+	uint8_t advance;
+} AtlasGlyph;
+
+/* The characters a tile font has, and where its glyphs start in the table */
+typedef struct
+{
+	const char *chars;
+	uint8_t first;
+	uint8_t count;
+} AtlasFont;
+
+// load the atlas resource into the heap; false if it could not be loaded
+bool atlas_load(void);
+
+// free the atlas
+void atlas_unload(void);
+
+// width in pixels of text set in font, for centring it once when it changes
+int atlas_text_width(const char *text, int font);
+
+// draw text in font with its pen starting at x and its line top at y
+void atlas_draw_text(GContext *ctx, const char *text, int font, int x, int y, GColor color);
+
+// write the ink of text straight into a captured 1-bit or 8-bit frame buffer, as atlas_draw_text draws it
+void atlas_blit_text(GBitmap *frame, const char *text, int font, int x, int y, GColor color);
+
+#endif
@@ -0,0 +1,112 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	atlas_glyphs.h
+
+   Purpose:	  	Glyph positions and metrics in resources/data/glyph_atlas.bin.
+   					Generated by util/moonatlas from the tile fonts; do not edit.
+*/
+
+#define ATLAS_WIDTH 256
+#define ATLAS_HEIGHT 216
+
+static const AtlasGlyph AtlasGlyphs[89] =
+{
+	{  0,   0, 25, 35,   3,  18, 31},  /* TIME '0' */
+	{ 25,   0,  4, 36,  22,  17, 29},  /* TIME '1' */
+	{ 29,   0, 25, 35,   3,  18, 31},  /* TIME '2' */
+	{ 54,   0, 23, 35,   3,  18, 29},  /* TIME '3' */
+	{ 77,   0, 25, 36,   3,  17, 31},  /* TIME '4' */
+	{102,   0, 25, 35,   3,  18, 31},  /* TIME '5' */
+	{127,   0, 25, 35,   3,  18, 31},  /* TIME '6' */
+	{152,   0, 23, 35,   3,  18, 29},  /* TIME '7' */
+	{175,   0, 25, 35,   3,  18, 31},  /* TIME '8' */
+	{200,   0, 25, 35,   3,  18, 31},  /* TIME '9' */
+	{225,   0,  5, 20,   5,  25, 16},  /* TIME ':' */
+	{  0,  36, 15, 23,   2,  11, 18},  /* DAY  'F' */
+	{ 15,  36, 17, 23,   2,  11, 21},  /* DAY  'M' */
+	{ 32,  36, 16, 23,   2,  11, 20},  /* DAY  'S' */
+	{ 48,  36, 16, 23,   2,  11, 20},  /* DAY  'T' */
+	{ 64,  36, 17, 23,   2,  11, 21},  /* DAY  'W' */
+	{ 81,  36, 12, 16,   2,  18, 16},  /* DAY  'a' */
+	{ 93,  36, 12, 23,   2,  11, 16},  /* DAY  'd' */
+	{105,  36, 12, 16,   2,  18, 16},  /* DAY  'e' */
+	{117,  36, 12, 23,   2,  11, 16},  /* DAY  'h' */
+	{129,  36,  3, 23,   2,  11,  6},  /* DAY  'i' */
+	{132,  36, 12, 16,   2,  18, 16},  /* DAY  'n' */
+	{144,  36, 12, 16,   2,  18, 16},  /* DAY  'o' */
+	{156,  36, 11, 16,   2,  18, 14},  /* DAY  'r' */
+	{167,  36, 12, 23,   2,  11, 16},  /* DAY  't' */
+	{179,  36, 12, 16,   2,  18, 16},  /* DAY  'u' */
+	{  0,  59, 30, 30,   2,   2, 33},  /* MOON '0' */
+	{ 30,  59, 30, 30,   0,   2, 33},  /* MOON '1' */
+	{ 60,  59, 30, 30,   2,   2, 34},  /* MOON 'A' */
+	{ 90,  59, 30, 30,   2,   2, 34},  /* MOON 'B' */
+	{120,  59, 30, 30,   2,   2, 34},  /* MOON 'C' */
+	{150,  59, 30, 30,   2,   2, 34},  /* MOON 'D' */
+	{180,  59, 30, 30,   2,   2, 34},  /* MOON 'E' */
+	{210,  59, 30, 30,   2,   2, 34},  /* MOON 'F' */
+	{  0,  89, 30, 30,   2,   2, 34},  /* MOON 'G' */
+	{ 30,  89, 30, 30,   2,   2, 34},  /* MOON 'H' */
+	{ 60,  89, 30, 30,   2,   2, 34},  /* MOON 'I' */
+	{ 90,  89, 30, 30,   2,   2, 34},  /* MOON 'J' */
+	{120,  89, 30, 30,   2,   2, 34},  /* MOON 'K' */
+	{150,  89, 31, 30,   1,   2, 34},  /* MOON 'L' */
+	{181,  89, 30, 30,   2,   2, 34},  /* MOON 'M' */
+	{211,  89, 30, 30,   2,   2, 34},  /* MOON 'N' */
+	{  0, 119, 30, 30,   2,   2, 34},  /* MOON 'O' */
+	{ 30, 119, 29, 30,   2,   2, 33},  /* MOON 'P' */
+	{ 59, 119, 30, 30,   2,   2, 34},  /* MOON 'Q' */
+	{ 89, 119, 30, 30,   2,   2, 33},  /* MOON 'R' */
+	{119, 119, 30, 30,   2,   2, 33},  /* MOON 'S' */
+	{149, 119, 30, 30,   2,   2, 33},  /* MOON 'T' */
+	{179, 119, 30, 30,   2,   2, 33},  /* MOON 'U' */
+	{209, 119, 30, 30,   2,   2, 33},  /* MOON 'V' */
+	{  0, 149, 30, 30,   2,   2, 33},  /* MOON 'W' */
+	{ 30, 149, 30, 30,   2,   2, 33},  /* MOON 'X' */
+	{ 60, 149, 30, 30,   2,   2, 33},  /* MOON 'Y' */
+	{ 90, 149, 30, 30,   2,   2, 33},  /* MOON 'Z' */
+	{  0, 179, 11, 15,   1,   8, 13},  /* DATE '0' */
+	{ 11, 179,  2, 15,   9,   8, 12},  /* DATE '1' */
+	{ 13, 179, 11, 15,   1,   8, 13},  /* DATE '2' */
+	{ 24, 179, 10, 15,   1,   8, 12},  /* DATE '3' */
+	{ 34, 179, 11, 15,   1,   8, 13},  /* DATE '4' */
+	{ 45, 179, 11, 15,   1,   8, 13},  /* DATE '5' */
+	{ 56, 179, 11, 15,   1,   8, 13},  /* DATE '6' */
+	{ 67, 179, 10, 15,   1,   8, 12},  /* DATE '7' */
+	{ 77, 179, 11, 15,   1,   8, 13},  /* DATE '8' */
+	{ 88, 179, 11, 15,   1,   8, 13},  /* DATE '9' */
+	{ 99, 179, 11, 15,   1,   8, 13},  /* DATE 'A' */
+	{110, 179, 11, 15,   1,   8, 13},  /* DATE 'D' */
+	{121, 179, 10, 15,   1,   8, 12},  /* DATE 'F' */
+	{131, 179, 11, 15,   1,   8, 13},  /* DATE 'J' */
+	{142, 179, 12, 15,   1,   8, 14},  /* DATE 'M' */
+	{154, 179, 11, 15,   1,   8, 13},  /* DATE 'N' */
+	{165, 179, 11, 15,   1,   8, 13},  /* DATE 'O' */
+	{176, 179, 11, 15,   1,   8, 13},  /* DATE 'S' */
+	{187, 179,  9, 10,   1,  13, 11},  /* DATE 'a' */
+	{196, 179,  9, 15,   1,   8, 11},  /* DATE 'b' */
+	{205, 179,  8, 10,   1,  13, 10},  /* DATE 'c' */
+	{213, 179,  9, 10,   1,  13, 11},  /* DATE 'e' */
+	{222, 179,  9, 15,   1,  13, 11},  /* DATE 'g' */
+	{231, 179,  2, 15,   1,   8,  4},  /* DATE 'l' */
+	{233, 179,  9, 10,   1,  13, 11},  /* DATE 'n' */
+	{242, 179,  9, 10,   1,  13, 11},  /* DATE 'o' */
+	{  0, 194,  9, 15,   1,  13, 11},  /* DATE 'p' */
+	{  9, 194,  8, 10,   1,  13, 10},  /* DATE 'r' */
+	{ 17, 194,  8, 15,   1,   8, 11},  /* DATE 't' */
+	{ 25, 194,  9, 10,   1,  13, 11},  /* DATE 'u' */
+	{ 34, 194, 10, 10,   1,  13, 12},  /* DATE 'v' */
+	{ 44, 194,  9, 15,   1,  13, 11},  /* DATE 'y' */
+	{  0, 209,  6,  7,   0,   4,  7},  /* AMPM 'A' */
+	{  6, 209,  6,  7,   0,   4,  7},  /* AMPM 'P' */
+	{ 12, 209,  5,  7,   0,   4,  6},  /* AMPM 'M' */
+};
+
+static const AtlasFont AtlasFonts[ATLAS_FONT_COUNT] =
+{
+	{"0123456789:",   0, 11},  /* ATLAS_FONT_TIME, 52 px */
+	{"FMSTWadehinortu",  11, 15},  /* ATLAS_FONT_DAY, 33 px */
+	{"01ABCDEFGHIJKLMNOPQRSTUVWXYZ",  26, 28},  /* ATLAS_FONT_MOON, 33 px */
+	{"0123456789ADFJMNOSabceglnoprtuvy",  54, 32},  /* ATLAS_FONT_DATE, 22 px */
+	{"APM",  86,  3},  /* ATLAS_FONT_AMPM, 10 px */
+};
@@ -0,0 +1,137 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	calendar.h
+
+   Purpose:	  		Integer proleptic Gregorian calendar conversions shared by the
+   					watchface, the worker and the util/ tools.  Julian day numbers
+   					count days from noon, so the JDN of a civil date names the
+   					day that starts at the preceding midnight.
+*/
+
+#ifndef CALENDAR_H
+#define CALENDAR_H
+
+#include <stdint.h>
+
+/* JDN of 1 March in year 0, the start of the 400-year era arithmetic */
+#define JDN_ERA_BASE 1721120
+
+typedef struct {
+	int32_t year;
+	int32_t month;	/* 1 - 12 */
+	int32_t day;	/* 1 - 31 */
+} CivilDate;
+
+/* Julian day number of a civil date; valid for any year that keeps the
+   result within 32 bits (about +/- 5.8 million years). */
+static inline int32_t jdn_from_civil(int32_t year, int32_t month, int32_t day)
+{
+	int32_t era, yoe, doy, doe;
+
+	year -= month <= 2;
+	era = (year >= 0 ? year : year - 399) / 400;
+	yoe = year - era * 400;
+	doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+	doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	return era * 146097 + doe + JDN_ERA_BASE;
+}
+
+/* Civil date of a Julian day number */
+static inline CivilDate civil_from_jdn(int32_t jdn)
+{
+	CivilDate c;
+	int32_t z, era, doe, yoe, doy, mp;
+
+	z = jdn - JDN_ERA_BASE;
+	era = (z >= 0 ? z : z - 146096) / 146097;
+	doe = z - era * 146097;
+	yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+	doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+	mp = (5 * doy + 2) / 153;
+	c.day = doy - (153 * mp + 2) / 5 + 1;
+	c.month = mp < 10 ? mp + 3 : mp - 9;
+	c.year = yoe + era * 400 + (c.month <= 2);
+	return c;
+}
+
+/* 64-bit forms for day counts beyond the 32-bit range */
+static inline int64_t jdn_from_civil64(int64_t year, int32_t month, int32_t day)
+{
+	int64_t era, yoe, doy, doe;
+
+	year -= month <= 2;
+	era = (year >= 0 ? year : year - 399) / 400;
+	yoe = year - era * 400;
+	doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+	doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	return era * 146097 + doe + JDN_ERA_BASE;
+}
+
+static inline void civil_from_jdn64(int64_t jdn, int64_t *year, int32_t *month, int32_t *day)
+{
+	int64_t z, era, doe, yoe, doy, mp;
+
+	z = jdn - JDN_ERA_BASE;
+	era = (z >= 0 ? z : z - 146096) / 146097;
+	doe = z - era * 146097;
+	yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+	doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+	mp = (5 * doy + 2) / 153;
+	*day = doy - (153 * mp + 2) / 5 + 1;
+	*month = mp < 10 ? mp + 3 : mp - 9;
+	*year = yoe + era * 400 + (*month <= 2);
+}
+
+/* Batch form: convert count consecutive array entries */
+static inline void civil_from_jdn_batch(const int32_t *jdn, CivilDate *out, int count)
+{
+	int i;
+
+	for (i = 0; i < count; i++)
+	{
+		out[i] = civil_from_jdn(jdn[i]);
+	}
+}
+
+/* Sequential cursor: steps one day at a time with carry, so a walk over
+   consecutive days costs a compare and an increment per day. */
+typedef struct {
+	int32_t jdn;
+	CivilDate date;
+	uint8_t leap;	/* 1 if date.year is a leap year */
+} CalendarCursor;
+
+static const uint8_t calendar_month_length[2][13] =
+{
+	{0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31},
+	{0, 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31}
+};
+
+static inline uint8_t calendar_is_leap(int32_t year)
+{
+	return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+static inline void calendar_cursor_init(CalendarCursor *cursor, int32_t jdn)
+{
+	cursor->jdn = jdn;
+	cursor->date = civil_from_jdn(jdn);
+	cursor->leap = calendar_is_leap(cursor->date.year);
+}
+
+static inline void calendar_cursor_next(CalendarCursor *cursor)
+{
+	cursor->jdn++;
+	if (++cursor->date.day > calendar_month_length[cursor->leap][cursor->date.month])
+	{
+		cursor->date.day = 1;
+		if (++cursor->date.month > 12)
+		{
+			cursor->date.month = 1;
+			cursor->date.year++;
+			cursor->leap = calendar_is_leap(cursor->date.year);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,65 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	fontcache.c
+
+   Purpose:	  		Reference counted custom font cache
+*/
+
+#include "fontcache.h"
+
+typedef struct
+{
+	uint32_t resource_id;
+	GFont font;
+	uint8_t refs;
+} FontCacheEntry;
+
+static FontCacheEntry entries[FONT_CACHE_SIZE];
+
+GFont font_cache_get(uint32_t resource_id)
+{
+	FontCacheEntry *free_entry = NULL;
+
+	for (int i = 0; i < FONT_CACHE_SIZE; i++)
+	{
+		if (entries[i].refs && entries[i].resource_id == resource_id)
+		{
+			entries[i].refs++;
+			return entries[i].font;
+		}
+		if (!entries[i].refs && !free_entry)
+		{
+			free_entry = &entries[i];
+		}
+	}
+
+	if (!free_entry)
+	{
+		APP_LOG(APP_LOG_LEVEL_ERROR, "Font cache full loading resource %d", (int) resource_id);
+		return NULL;
+	}
+	free_entry->font = fonts_load_custom_font(resource_get_handle(resource_id));
+	if (!free_entry->font)
+	{
+		return NULL;
+	}
+	free_entry->resource_id = resource_id;
+	free_entry->refs = 1;
+	return free_entry->font;
+}
+
+void font_cache_release(uint32_t resource_id)
+{
+	for (int i = 0; i < FONT_CACHE_SIZE; i++)
+	{
+		if (entries[i].refs && entries[i].resource_id == resource_id)
+		{
+			if (--entries[i].refs == 0)
+			{
+				fonts_unload_custom_font(entries[i].font);
+				entries[i].font = NULL;
+			}
+			return;
+		}
+	}
+}
@@ -0,0 +1,23 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	fontcache.h
+
+   Purpose:	  		Custom fonts shared between tiles: each resource is loaded
+   					once, counted per user and unloaded with its last user.
+*/
+
+#ifndef FONTCACHE_H
+#define FONTCACHE_H
+
+#include <pebble.h>
+
+/* Distinct font resources the face can hold at once */
+#define FONT_CACHE_SIZE 5
+
+// the font for resource_id, loading it on first use; NULL if the cache is full
+GFont font_cache_get(uint32_t resource_id);
+
+// drop one use of the font for resource_id, unloading it after the last
+void font_cache_release(uint32_t resource_id);
+
+#endif
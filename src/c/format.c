@@ -0,0 +1,92 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	format.c
+
+   Purpose:	  		Tile text formatting from lookup tables, for the tick path
+*/
+
+#include "format.h"
+
+/* "00" to "99", two characters per value */
+static const char DigitPairs[201] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+static const char WeekdayNames[7][4] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+
+static const char MonthNames[12][4] =
+{
+	"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+	"Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+};
+
+// write 0-99 without a leading zero; returns the next free position
+static char* put_number(char *p, int value)
+{
+	if (value >= 10)
+	{
+		*p++ = DigitPairs[value * 2];
+	}
+	*p++ = DigitPairs[value * 2 + 1];
+	return p;
+}
+
+void format_time(char *buffer, const struct tm *t, bool clock_24h)
+{
+	int hour = t->tm_hour;
+
+	if (!clock_24h)
+	{
+		hour = hour % 12 == 0 ? 12 : hour % 12;
+	}
+	buffer = put_number(buffer, hour);
+	*buffer++ = ':';
+	*buffer++ = DigitPairs[t->tm_min * 2];
+	*buffer++ = DigitPairs[t->tm_min * 2 + 1];
+	*buffer = '\0';
+}
+
+void format_ampm(char *buffer, const struct tm *t)
+{
+	buffer[0] = t->tm_hour < 12 ? 'A' : 'P';
+	buffer[1] = 'M';
+	buffer[2] = '\0';
+}
+
+void format_weekday(char *buffer, const struct tm *t)
+{
+	buffer[0] = WeekdayNames[t->tm_wday][0];
+	buffer[1] = WeekdayNames[t->tm_wday][1];
+	buffer[2] = WeekdayNames[t->tm_wday][2];
+	buffer[3] = '\0';
+}
+
+void format_date(char *buffer, const struct tm *t)
+{
+	*put_number(buffer, t->tm_mday) = '\0';
+}
+
+void format_month(char *buffer, const struct tm *t)
+{
+	buffer[0] = MonthNames[t->tm_mon][0];
+	buffer[1] = MonthNames[t->tm_mon][1];
+	buffer[2] = MonthNames[t->tm_mon][2];
+	buffer[3] = '\0';
+}
+
+void format_year(char *buffer, const struct tm *t)
+{
+	int year = t->tm_year % 100;
+
+	buffer[0] = DigitPairs[year * 2];
+	buffer[1] = DigitPairs[year * 2 + 1];
+	buffer[2] = '\0';
+}
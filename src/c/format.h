@@ -0,0 +1,34 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	format.h
+
+   Purpose:	  		Tile text built straight from struct tm fields, without strftime.
+   					Each function writes the text its tile shows, already stripped
+   					of the leading space or zero, into a buffer of at least 6 bytes.
+*/
+
+#ifndef FORMAT_H
+#define FORMAT_H
+
+#include <stdbool.h>
+#include <time.h>
+
+// "9:05" or "12:59" in 12-hour style, "0:05" or "23:59" in 24-hour style
+void format_time(char *buffer, const struct tm *t, bool clock_24h);
+
+// "AM" or "PM"
+void format_ampm(char *buffer, const struct tm *t);
+
+// "Sun" to "Sat"
+void format_weekday(char *buffer, const struct tm *t);
+
+// "1" to "31"
+void format_date(char *buffer, const struct tm *t);
+
+// "Jan" to "Dec"
+void format_month(char *buffer, const struct tm *t);
+
+// "00" to "99"
+void format_year(char *buffer, const struct tm *t);
+
+#endif
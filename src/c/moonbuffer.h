@@ -0,0 +1,88 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	moonbuffer.h
+
+   Purpose:	  		Moon glyphs for the days ahead, kept in persistent storage by
+   					the background worker and from the phone, and read by the
+   					watchface.  Each buffer has one writer, so the app and the
+   					worker never overwrite each other's days.
+*/
+
+#ifndef MOONBUFFER_H
+#define MOONBUFFER_H
+
+#include <stdint.h>
+
+/* Persistent storage keys of the buffers, next to the watchface's own keys:
+   the worker's, which only the worker writes, and the phone's, which only
+   the watchface writes and reads for the days the worker's lacks */
+#define PERSIST_KEY_MOON 2
+#define PERSIST_KEY_MOON_PHONE 4
+
+/* Worker message sent after the buffer is written */
+#define MOON_BUFFER_UPDATED 1
+
+#define MOON_BUFFER_VERSION 1
+
+/* Days held: the header and glyphs fill one 256 byte persistent value */
+#define MOON_BUFFER_DAYS 248
+
+/* A phone sync, as src/pkjs/index.js sends it: MOON_SYNC_DAYS glyphs from
+   today in AppMessages of MOON_BATCH_DAYS, each a MOON_FIRST JDN and the
+   MOON_GLYPHS bytes, so a dict_calc_buffer_size(2, 4, 64) = 83 byte inbox
+   and 249 bytes in all */
+#define MOON_SYNC_DAYS 192
+#define MOON_BATCH_DAYS 64
+
+/* A rolling buffer of the moon font character for each day from first on.
+   Day jdn lives in glyph[jdn % MOON_BUFFER_DAYS], so moving first on a day
+   frees the slot the new last day needs and nothing else moves. */
+typedef struct
+{
+	int32_t first;		/* Julian day number of the first day held */
+	uint16_t count;		/* Days held from first on */
+	uint8_t version;
+	uint8_t reserved;
+	char glyph[MOON_BUFFER_DAYS];
+} MoonBuffer;
+
+// the glyph for day jdn, or '\0' if the buffer does not hold it
+static inline char moon_buffer_glyph(const MoonBuffer *buffer, int32_t jdn)
+{
+	if (buffer->version != MOON_BUFFER_VERSION || jdn < buffer->first || jdn - buffer->first >= buffer->count)
+	{
+		return '\0';
+	}
+	return buffer->glyph[jdn % MOON_BUFFER_DAYS];
+}
+
+// put the glyphs for count days from JDN first into the buffer, which keeps the
+// days it held too where the two runs meet or overlap and the whole fits
+static inline void moon_buffer_merge(MoonBuffer *buffer, int32_t first, const char *glyphs, uint16_t count)
+{
+	if (count > MOON_BUFFER_DAYS)
+	{
+		glyphs += count - MOON_BUFFER_DAYS;
+		first += count - MOON_BUFFER_DAYS;
+		count = MOON_BUFFER_DAYS;
+	}
+
+	int32_t end = first + count, held_end = buffer->first + buffer->count;
+	int32_t start = first < buffer->first ? first : buffer->first;
+	int32_t stop = end > held_end ? end : held_end;
+	if (buffer->version != MOON_BUFFER_VERSION || first > held_end || end < buffer->first || stop - start > MOON_BUFFER_DAYS)
+	{
+		buffer->version = MOON_BUFFER_VERSION;
+		start = first;
+		stop = end;
+	}
+
+	for (uint16_t i = 0; i < count; i++)
+	{
+		buffer->glyph[(first + i) % MOON_BUFFER_DAYS] = glyphs[i];
+	}
+	buffer->first = start;
+	buffer->count = stop - start;
+}
+
+#endif
@@ -0,0 +1,180 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	moondecode.h
+
+   Purpose:	  		Decoders for the moon glyph encodings util/mooncodec
+   					compares, integer only, so a table it writes with -o can
+   					be read on the watch.  util/mooncodec decodes through
+   					these same functions when it checks and times them.
+*/
+
+#ifndef MOONDECODE_H
+#define MOONDECODE_H
+
+#include <stdint.h>
+
+#define MOON_DELTA_DAYS 32						/* Days in a delta block */
+#define MOON_DELTA_BLOCK (1 + MOON_DELTA_DAYS / 2)	/* Bytes in a delta block */
+#define MOON_POLY_STEP 5						/* Days between poly nodes */
+#define MOON_ANCHORS 4							/* Lunation anchors a synodic month */
+#define MOON_ANCHOR_MINUTES (42524 / MOON_ANCHORS)	/* Synodic month, minutes, between anchors */
+
+/* Moon font characters by phase (0-14), waxing and waning */
+static const char MoonWaxing[] = "0ABCDEFGHIJKLM1", MoonWaning[] = "0ZYXWVUTSRQPON1";
+
+// little-endian 16-bit field of an encoding
+static inline unsigned moon_rd16(const unsigned char *p)
+{
+	return p[0] | p[1] << 8;
+}
+
+// little-endian 32-bit field of an encoding
+static inline int32_t moon_rd32(const unsigned char *p)
+{
+	return (int32_t) ((uint32_t) p[0] | (uint32_t) p[1] << 8 | (uint32_t) p[2] << 16 | (uint32_t) p[3] << 24);
+}
+
+// the moon font character of a phase and waxing flag
+static inline int moon_glyph(int phase, int wax)
+{
+	return (wax ? MoonWaxing : MoonWaning)[phase];
+}
+
+// the glyph listed for a day in the exceptions of an encoding, or 0; the exceptions
+// start at the offset in the encoding's first field: a count, the days in order and
+// their glyphs
+static __attribute__((noinline, unused)) int moon_exception(const unsigned char *data, long day)
+{
+	const unsigned char *ex = data + moon_rd32(data);
+	long lo = 0, hi = moon_rd32(ex), n = hi, mid, d;
+
+	while (lo < hi)
+	{
+		mid = (lo + hi) / 2;
+		d = moon_rd32(ex + 4 + 4 * mid);
+		if (d == day)
+		{
+			return ex[4 + 4 * n + mid];
+		}
+		if (d < day)
+		{
+			lo = mid + 1;
+		}
+		else
+		{
+			hi = mid;
+		}
+	}
+	return 0;
+}
+
+// pair: MoonPhaseDateLookup[day][2]
+static inline int moon_decode_pair(const unsigned char *data, long day)
+{
+	return moon_glyph(data[2 * day], data[2 * day + 1]);
+}
+
+// byte: the character itself
+static inline int moon_decode_byte(const unsigned char *data, long day)
+{
+	return data[day];
+}
+
+// packed5: 5 bits a day, low bits first, with a byte of padding so a code can
+// always be read from two bytes
+static inline int moon_decode_packed5(const unsigned char *data, long day)
+{
+	long bit = 5 * day;
+	int c = moon_rd16(data + bit / 8) >> (bit % 8) & 31;
+
+	return moon_glyph(c / 2, c & 1);
+}
+
+// delta: per block the code of its first day, then a nibble for each later day,
+// the change in phase plus 4 in the low 3 bits and the waxing flag above
+static inline int moon_decode_delta(const unsigned char *data, long day)
+{
+	const unsigned char *block = data + day / MOON_DELTA_DAYS * MOON_DELTA_BLOCK;
+	int i, n = day % MOON_DELTA_DAYS, phase = block[0] / 2, wax = block[0] & 1, nibble;
+
+	for (i = 1; i <= n; i++)
+	{
+		nibble = block[1 + (i - 1) / 2] >> ((i - 1) % 2 * 4) & 15;
+		phase += (nibble & 7) - 4;
+		wax = nibble >> 3;
+	}
+	return moon_glyph(phase, wax);
+}
+
+// the glyph for the Moon's age as a fraction of a turn of 65536, from the 14
+// phase thresholds on its distance from new moon that the encodings carry
+static __attribute__((noinline, unused)) int moon_turnglyph(const unsigned char *thresholds, long f)
+{
+	long u = f < 32768 ? f : 65536 - f;
+	int phase;
+
+	for (phase = 0; phase < 14 && u >= moon_rd16(thresholds + 2 * phase); phase++)
+	{
+	}
+	return moon_glyph(phase, f < 32768);
+}
+
+// lunation: exceptions offset, the number of anchors, the thresholds, then the new
+// moons and quarters in turn, in minutes from noon UT of day 0; the Moon's age runs
+// evenly from one anchor to the next
+static __attribute__((noinline, unused)) int moon_lunation_model(const unsigned char *data, long day)
+{
+	long n = moon_rd32(data + 4), t = day * 1440, i, start, end;
+	const unsigned char *anchors = data + 8 + 2 * 14;
+
+	i = (t - moon_rd32(anchors)) / MOON_ANCHOR_MINUTES;
+	if (i > n - 2)
+	{
+		i = n - 2;
+	}
+	while (i < n - 2 && moon_rd32(anchors + 4 * (i + 1)) <= t)
+	{
+		i++;
+	}
+	while (i > 0 && moon_rd32(anchors + 4 * i) > t)
+	{
+		i--;
+	}
+	start = moon_rd32(anchors + 4 * i);
+	end = moon_rd32(anchors + 4 * (i + 1));
+	return moon_turnglyph(data + 8, i % MOON_ANCHORS * (65536 / MOON_ANCHORS) + (t - start) * (65536 / MOON_ANCHORS) / (end - start));
+}
+
+static inline int moon_decode_lunation(const unsigned char *data, long day)
+{
+	int g = moon_exception(data, day);
+
+	return g ? g : moon_lunation_model(data, day);
+}
+
+// poly: exceptions offset, the number of nodes, the thresholds, then the Moon's age
+// as a fraction of a turn every MOON_POLY_STEP days from day -2 * MOON_POLY_STEP;
+// each 2 * MOON_POLY_STEP days take the quadratic through three nodes, unwrapped
+// across whole turns
+static __attribute__((noinline, unused)) int moon_poly_model(const unsigned char *data, long day)
+{
+	const unsigned char *nodes = data + 8 + 2 * 14;
+	long x = day + 2 * MOON_POLY_STEP, s = x / (2 * MOON_POLY_STEP), h = MOON_POLY_STEP, v;
+	long q0 = moon_rd16(nodes + 4 * s), q1 = moon_rd16(nodes + 4 * s + 2), q2 = moon_rd16(nodes + 4 * s + 4);
+
+	q1 = q0 + ((q1 - q0) & 0xFFFF);
+	q2 = q1 + ((q2 - q1) & 0xFFFF);
+	x -= s * 2 * MOON_POLY_STEP;
+	v = q0 * (x - h) * (x - 2 * h) - 2 * q1 * x * (x - 2 * h) + q2 * x * (x - h);
+	v = (v + h * h) / (2 * h * h);
+	return moon_turnglyph(data + 8, v & 0xFFFF);
+}
+
+static inline int moon_decode_poly(const unsigned char *data, long day)
+{
+	int g = moon_exception(data, day);
+
+	return g ? g : moon_poly_model(data, day);
+}
+
+#endif
@@ -1,3657 +0,0 @@
-#define JULIAN_MOON_EPIC 2457629 /* 28 August 2016 */
-#define MOONPHASE_ARRAY_SIZE 3650
-
-static uint8_t MoonPhaseDateLookup[3650][2] =
-{
-	/* {Julian Date-JULIAN_MOON_EPIC = array position, Phase (0-14), Waxing (1 - Yes, 0 - Waning)} */
-	{2, 0}, /* 2457629 - 28 August 2016 - 15%  */
-	{1, 0}, /* 2457630 - 29 August 2016 - 8%  */
-	{1, 0}, /* 2457631 - 30 August 2016 - 3%  */
-	{0, 0}, /* 2457632 - 31 August 2016 - 0%  */
-	{0, 0}, /* 2457633 - 1 September 2016 - 0%  */
-	{0, 1}, /* 2457634 - 2 September 2016 - 1%  */
-	{1, 1}, /* 2457635 - 3 September 2016 - 4%  */
-	{1, 1}, /* 2457636 - 4 September 2016 - 9%  */
-	{2, 1}, /* 2457637 - 5 September 2016 - 15%  */
-	{3, 1}, /* 2457638 - 6 September 2016 - 23%  */
-	{4, 1}, /* 2457639 - 7 September 2016 - 31%  */
-	{6, 1}, /* 2457640 - 8 September 2016 - 40%  */
-	{7, 1}, /* 2457641 - 9 September 2016 - 50%  */
-	{8, 1}, /* 2457642 - 10 September 2016 - 59%  */
-	{10, 1}, /* 2457643 - 11 September 2016 - 69%  */
-	{11, 1}, /* 2457644 - 12 September 2016 - 78%  */
-	{12, 1}, /* 2457645 - 13 September 2016 - 86%  */
-	{13, 1}, /* 2457646 - 14 September 2016 - 93%  */
-	{14, 1}, /* 2457647 - 15 September 2016 - 97%  */
-	{14, 1}, /* 2457648 - 16 September 2016 - 99%  */
-	{14, 0}, /* 2457649 - 17 September 2016 - 99%  */
-	{13, 0}, /* 2457650 - 18 September 2016 - 95%  */
-	{13, 0}, /* 2457651 - 19 September 2016 - 89%  */
-	{11, 0}, /* 2457652 - 20 September 2016 - 81%  */
-	{10, 0}, /* 2457653 - 21 September 2016 - 71%  */
-	{8, 0}, /* 2457654 - 22 September 2016 - 60%  */
-	{7, 0}, /* 2457655 - 23 September 2016 - 49%  */
-	{5, 0}, /* 2457656 - 24 September 2016 - 38%  */
-	{4, 0}, /* 2457657 - 25 September 2016 - 28%  */
-	{3, 0}, /* 2457658 - 26 September 2016 - 19%  */
-	{2, 0}, /* 2457659 - 27 September 2016 - 11%  */
-	{1, 0}, /* 2457660 - 28 September 2016 - 6%  */
-	{0, 0}, /* 2457661 - 29 September 2016 - 2%  */
-	{0, 0}, /* 2457662 - 30 September 2016 - 0%  */
-	{0, 0}, /* 2457663 - 1 October 2016 - 0%  */
-	{0, 1}, /* 2457664 - 2 October 2016 - 2%  */
-	{1, 1}, /* 2457665 - 3 October 2016 - 5%  */
-	{2, 1}, /* 2457666 - 4 October 2016 - 10%  */
-	{2, 1}, /* 2457667 - 5 October 2016 - 17%  */
-	{4, 1}, /* 2457668 - 6 October 2016 - 25%  */
-	{5, 1}, /* 2457669 - 7 October 2016 - 33%  */
-	{6, 1}, /* 2457670 - 8 October 2016 - 43%  */
-	{7, 1}, /* 2457671 - 9 October 2016 - 53%  */
-	{9, 1}, /* 2457672 - 10 October 2016 - 63%  */
-	{10, 1}, /* 2457673 - 11 October 2016 - 73%  */
-	{11, 1}, /* 2457674 - 12 October 2016 - 82%  */
-	{13, 1}, /* 2457675 - 13 October 2016 - 89%  */
-	{13, 1}, /* 2457676 - 14 October 2016 - 95%  */
-	{14, 1}, /* 2457677 - 15 October 2016 - 99%  */
-	{14, 1}, /* 2457678 - 16 October 2016 - 99%  */
-	{14, 0}, /* 2457679 - 17 October 2016 - 97%  */
-	{13, 0}, /* 2457680 - 18 October 2016 - 91%  */
-	{12, 0}, /* 2457681 - 19 October 2016 - 84%  */
-	{10, 0}, /* 2457682 - 20 October 2016 - 74%  */
-	{9, 0}, /* 2457683 - 21 October 2016 - 64%  */
-	{7, 0}, /* 2457684 - 22 October 2016 - 53%  */
-	{6, 0}, /* 2457685 - 23 October 2016 - 42%  */
-	{5, 0}, /* 2457686 - 24 October 2016 - 32%  */
-	{3, 0}, /* 2457687 - 25 October 2016 - 23%  */
-	{2, 0}, /* 2457688 - 26 October 2016 - 15%  */
-	{1, 0}, /* 2457689 - 27 October 2016 - 9%  */
-	{1, 0}, /* 2457690 - 28 October 2016 - 4%  */
-	{0, 0}, /* 2457691 - 29 October 2016 - 1%  */
-	{0, 0}, /* 2457692 - 30 October 2016 - 0%  */
-	{0, 1}, /* 2457693 - 31 October 2016 - 0%  */
-	{0, 1}, /* 2457694 - 1 November 2016 - 2%  */
-	{1, 1}, /* 2457695 - 2 November 2016 - 6%  */
-	{2, 1}, /* 2457696 - 3 November 2016 - 12%  */
-	{3, 1}, /* 2457697 - 4 November 2016 - 19%  */
-	{4, 1}, /* 2457698 - 5 November 2016 - 27%  */
-	{5, 1}, /* 2457699 - 6 November 2016 - 36%  */
-	{7, 1}, /* 2457700 - 7 November 2016 - 46%  */
-	{8, 1}, /* 2457701 - 8 November 2016 - 57%  */
-	{9, 1}, /* 2457702 - 9 November 2016 - 67%  */
-	{11, 1}, /* 2457703 - 10 November 2016 - 77%  */
-	{12, 1}, /* 2457704 - 11 November 2016 - 86%  */
-	{13, 1}, /* 2457705 - 12 November 2016 - 93%  */
-	{14, 1}, /* 2457706 - 13 November 2016 - 98%  */
-	{14, 1}, /* 2457707 - 14 November 2016 - 99%  */
-	{14, 0}, /* 2457708 - 15 November 2016 - 98%  */
-	{13, 0}, /* 2457709 - 16 November 2016 - 94%  */
-	{12, 0}, /* 2457710 - 17 November 2016 - 87%  */
-	{11, 0}, /* 2457711 - 18 November 2016 - 79%  */
-	{10, 0}, /* 2457712 - 19 November 2016 - 69%  */
-	{8, 0}, /* 2457713 - 20 November 2016 - 59%  */
-	{7, 0}, /* 2457714 - 21 November 2016 - 48%  */
-	{5, 0}, /* 2457715 - 22 November 2016 - 38%  */
-	{4, 0}, /* 2457716 - 23 November 2016 - 29%  */
-	{3, 0}, /* 2457717 - 24 November 2016 - 21%  */
-	{2, 0}, /* 2457718 - 25 November 2016 - 13%  */
-	{1, 0}, /* 2457719 - 26 November 2016 - 7%  */
-	{1, 0}, /* 2457720 - 27 November 2016 - 3%  */
-	{0, 0}, /* 2457721 - 28 November 2016 - 0%  */
-	{0, 0}, /* 2457722 - 29 November 2016 - 0%  */
-	{0, 1}, /* 2457723 - 30 November 2016 - 0%  */
-	{0, 1}, /* 2457724 - 1 December 2016 - 3%  */
-	{1, 1}, /* 2457725 - 2 December 2016 - 8%  */
-	{2, 1}, /* 2457726 - 3 December 2016 - 14%  */
-	{3, 1}, /* 2457727 - 4 December 2016 - 21%  */
-	{4, 1}, /* 2457728 - 5 December 2016 - 30%  */
-	{6, 1}, /* 2457729 - 6 December 2016 - 40%  */
-	{7, 1}, /* 2457730 - 7 December 2016 - 51%  */
-	{9, 1}, /* 2457731 - 8 December 2016 - 62%  */
-	{10, 1}, /* 2457732 - 9 December 2016 - 73%  */
-	{12, 1}, /* 2457733 - 10 December 2016 - 82%  */
-	{13, 1}, /* 2457734 - 11 December 2016 - 90%  */
-	{14, 1}, /* 2457735 - 12 December 2016 - 96%  */
-	{14, 1}, /* 2457736 - 13 December 2016 - 99%  */
-	{14, 1}, /* 2457737 - 14 December 2016 - 99%  */
-	{14, 0}, /* 2457738 - 15 December 2016 - 96%  */
-	{13, 0}, /* 2457739 - 16 December 2016 - 91%  */
-	{12, 0}, /* 2457740 - 17 December 2016 - 84%  */
-	{11, 0}, /* 2457741 - 18 December 2016 - 75%  */
-	{9, 0}, /* 2457742 - 19 December 2016 - 65%  */
-	{8, 0}, /* 2457743 - 20 December 2016 - 55%  */
-	{6, 0}, /* 2457744 - 21 December 2016 - 46%  */
-	{5, 0}, /* 2457745 - 22 December 2016 - 36%  */
-	{4, 0}, /* 2457746 - 23 December 2016 - 27%  */
-	{3, 0}, /* 2457747 - 24 December 2016 - 19%  */
-	{2, 0}, /* 2457748 - 25 December 2016 - 12%  */
-	{1, 0}, /* 2457749 - 26 December 2016 - 7%  */
-	{0, 0}, /* 2457750 - 27 December 2016 - 3%  */
-	{0, 0}, /* 2457751 - 28 December 2016 - 0%  */
-	{0, 0}, /* 2457752 - 29 December 2016 - 0%  */
-	{0, 1}, /* 2457753 - 30 December 2016 - 1%  */
-	{1, 1}, /* 2457754 - 31 December 2016 - 4%  */
-	{1, 1}, /* 2457755 - 1 January 2017 - 10%  */
-	{2, 1}, /* 2457756 - 2 January 2017 - 17%  */
-	{4, 1}, /* 2457757 - 3 January 2017 - 25%  */
-	{5, 1}, /* 2457758 - 4 January 2017 - 35%  */
-	{7, 1}, /* 2457759 - 5 January 2017 - 46%  */
-	{8, 1}, /* 2457760 - 6 January 2017 - 57%  */
-	{10, 1}, /* 2457761 - 7 January 2017 - 68%  */
-	{11, 1}, /* 2457762 - 8 January 2017 - 79%  */
-	{12, 1}, /* 2457763 - 9 January 2017 - 87%  */
-	{13, 1}, /* 2457764 - 10 January 2017 - 94%  */
-	{14, 1}, /* 2457765 - 11 January 2017 - 98%  */
-	{14, 1}, /* 2457766 - 12 January 2017 - 99%  */
-	{14, 0}, /* 2457767 - 13 January 2017 - 98%  */
-	{13, 0}, /* 2457768 - 14 January 2017 - 94%  */
-	{12, 0}, /* 2457769 - 15 January 2017 - 88%  */
-	{11, 0}, /* 2457770 - 16 January 2017 - 81%  */
-	{10, 0}, /* 2457771 - 17 January 2017 - 72%  */
-	{9, 0}, /* 2457772 - 18 January 2017 - 63%  */
-	{8, 0}, /* 2457773 - 19 January 2017 - 54%  */
-	{6, 0}, /* 2457774 - 20 January 2017 - 44%  */
-	{5, 0}, /* 2457775 - 21 January 2017 - 35%  */
-	{4, 0}, /* 2457776 - 22 January 2017 - 26%  */
-	{3, 0}, /* 2457777 - 23 January 2017 - 18%  */
-	{2, 0}, /* 2457778 - 24 January 2017 - 11%  */
-	{1, 0}, /* 2457779 - 25 January 2017 - 6%  */
-	{0, 0}, /* 2457780 - 26 January 2017 - 2%  */
-	{0, 0}, /* 2457781 - 27 January 2017 - 0%  */
-	{0, 0}, /* 2457782 - 28 January 2017 - 0%  */
-	{0, 1}, /* 2457783 - 29 January 2017 - 2%  */
-	{1, 1}, /* 2457784 - 30 January 2017 - 6%  */
-	{2, 1}, /* 2457785 - 31 January 2017 - 13%  */
-	{3, 1}, /* 2457786 - 1 February 2017 - 21%  */
-	{4, 1}, /* 2457787 - 2 February 2017 - 31%  */
-	{6, 1}, /* 2457788 - 3 February 2017 - 42%  */
-	{8, 1}, /* 2457789 - 4 February 2017 - 53%  */
-	{9, 1}, /* 2457790 - 5 February 2017 - 65%  */
-	{11, 1}, /* 2457791 - 6 February 2017 - 75%  */
-	{12, 1}, /* 2457792 - 7 February 2017 - 84%  */
-	{13, 1}, /* 2457793 - 8 February 2017 - 92%  */
-	{14, 1}, /* 2457794 - 9 February 2017 - 97%  */
-	{14, 1}, /* 2457795 - 10 February 2017 - 99%  */
-	{14, 1}, /* 2457796 - 11 February 2017 - 99%  */
-	{14, 0}, /* 2457797 - 12 February 2017 - 97%  */
-	{13, 0}, /* 2457798 - 13 February 2017 - 93%  */
-	{12, 0}, /* 2457799 - 14 February 2017 - 87%  */
-	{11, 0}, /* 2457800 - 15 February 2017 - 79%  */
-	{10, 0}, /* 2457801 - 16 February 2017 - 71%  */
-	{9, 0}, /* 2457802 - 17 February 2017 - 62%  */
-	{7, 0}, /* 2457803 - 18 February 2017 - 53%  */
-	{6, 0}, /* 2457804 - 19 February 2017 - 43%  */
-	{5, 0}, /* 2457805 - 20 February 2017 - 34%  */
-	{4, 0}, /* 2457806 - 21 February 2017 - 25%  */
-	{2, 0}, /* 2457807 - 22 February 2017 - 17%  */
-	{1, 0}, /* 2457808 - 23 February 2017 - 10%  */
-	{1, 0}, /* 2457809 - 24 February 2017 - 5%  */
-	{0, 0}, /* 2457810 - 25 February 2017 - 1%  */
-	{0, 0}, /* 2457811 - 26 February 2017 - 0%  */
-	{0, 1}, /* 2457812 - 27 February 2017 - 0%  */
-	{1, 1}, /* 2457813 - 28 February 2017 - 4%  */
-	{1, 1}, /* 2457814 - 1 March 2017 - 10%  */
-	{3, 1}, /* 2457815 - 2 March 2017 - 18%  */
-	{4, 1}, /* 2457816 - 3 March 2017 - 27%  */
-	{5, 1}, /* 2457817 - 4 March 2017 - 38%  */
-	{7, 1}, /* 2457818 - 5 March 2017 - 50%  */
-	{9, 1}, /* 2457819 - 6 March 2017 - 61%  */
-	{10, 1}, /* 2457820 - 7 March 2017 - 72%  */
-	{11, 1}, /* 2457821 - 8 March 2017 - 81%  */
-	{12, 1}, /* 2457822 - 9 March 2017 - 89%  */
-	{13, 1}, /* 2457823 - 10 March 2017 - 95%  */
-	{14, 1}, /* 2457824 - 11 March 2017 - 98%  */
-	{14, 1}, /* 2457825 - 12 March 2017 - 99%  */
-	{14, 0}, /* 2457826 - 13 March 2017 - 99%  */
-	{13, 0}, /* 2457827 - 14 March 2017 - 96%  */
-	{13, 0}, /* 2457828 - 15 March 2017 - 91%  */
-	{12, 0}, /* 2457829 - 16 March 2017 - 85%  */
-	{11, 0}, /* 2457830 - 17 March 2017 - 78%  */
-	{10, 0}, /* 2457831 - 18 March 2017 - 69%  */
-	{9, 0}, /* 2457832 - 19 March 2017 - 61%  */
-	{7, 0}, /* 2457833 - 20 March 2017 - 51%  */
-	{6, 0}, /* 2457834 - 21 March 2017 - 42%  */
-	{5, 0}, /* 2457835 - 22 March 2017 - 32%  */
-	{3, 0}, /* 2457836 - 23 March 2017 - 23%  */
-	{2, 0}, /* 2457837 - 24 March 2017 - 15%  */
-	{1, 0}, /* 2457838 - 25 March 2017 - 8%  */
-	{0, 0}, /* 2457839 - 26 March 2017 - 3%  */
-	{0, 0}, /* 2457840 - 27 March 2017 - 0%  */
-	{0, 0}, /* 2457841 - 28 March 2017 - 0%  */
-	{0, 1}, /* 2457842 - 29 March 2017 - 2%  */
-	{1, 1}, /* 2457843 - 30 March 2017 - 7%  */
-	{2, 1}, /* 2457844 - 31 March 2017 - 15%  */
-	{3, 1}, /* 2457845 - 1 April 2017 - 24%  */
-	{5, 1}, /* 2457846 - 2 April 2017 - 35%  */
-	{7, 1}, /* 2457847 - 3 April 2017 - 46%  */
-	{8, 1}, /* 2457848 - 4 April 2017 - 57%  */
-	{10, 1}, /* 2457849 - 5 April 2017 - 68%  */
-	{11, 1}, /* 2457850 - 6 April 2017 - 78%  */
-	{12, 1}, /* 2457851 - 7 April 2017 - 86%  */
-	{13, 1}, /* 2457852 - 8 April 2017 - 92%  */
-	{14, 1}, /* 2457853 - 9 April 2017 - 96%  */
-	{14, 1}, /* 2457854 - 10 April 2017 - 99%  */
-	{14, 1}, /* 2457855 - 11 April 2017 - 99%  */
-	{14, 0}, /* 2457856 - 12 April 2017 - 98%  */
-	{13, 0}, /* 2457857 - 13 April 2017 - 95%  */
-	{13, 0}, /* 2457858 - 14 April 2017 - 90%  */
-	{12, 0}, /* 2457859 - 15 April 2017 - 84%  */
-	{11, 0}, /* 2457860 - 16 April 2017 - 76%  */
-	{10, 0}, /* 2457861 - 17 April 2017 - 68%  */
-	{8, 0}, /* 2457862 - 18 April 2017 - 58%  */
-	{7, 0}, /* 2457863 - 19 April 2017 - 49%  */
-	{6, 0}, /* 2457864 - 20 April 2017 - 39%  */
-	{4, 0}, /* 2457865 - 21 April 2017 - 29%  */
-	{3, 0}, /* 2457866 - 22 April 2017 - 20%  */
-	{2, 0}, /* 2457867 - 23 April 2017 - 12%  */
-	{1, 0}, /* 2457868 - 24 April 2017 - 5%  */
-	{0, 0}, /* 2457869 - 25 April 2017 - 1%  */
-	{0, 0}, /* 2457870 - 26 April 2017 - 0%  */
-	{0, 1}, /* 2457871 - 27 April 2017 - 1%  */
-	{1, 1}, /* 2457872 - 28 April 2017 - 5%  */
-	{2, 1}, /* 2457873 - 29 April 2017 - 12%  */
-	{3, 1}, /* 2457874 - 30 April 2017 - 21%  */
-	{5, 1}, /* 2457875 - 1 May 2017 - 32%  */
-	{6, 1}, /* 2457876 - 2 May 2017 - 43%  */
-	{8, 1}, /* 2457877 - 3 May 2017 - 54%  */
-	{9, 1}, /* 2457878 - 4 May 2017 - 64%  */
-	{10, 1}, /* 2457879 - 5 May 2017 - 74%  */
-	{12, 1}, /* 2457880 - 6 May 2017 - 82%  */
-	{13, 1}, /* 2457881 - 7 May 2017 - 89%  */
-	{13, 1}, /* 2457882 - 8 May 2017 - 94%  */
-	{14, 1}, /* 2457883 - 9 May 2017 - 98%  */
-	{14, 1}, /* 2457884 - 10 May 2017 - 99%  */
-	{14, 0}, /* 2457885 - 11 May 2017 - 99%  */
-	{14, 0}, /* 2457886 - 12 May 2017 - 97%  */
-	{13, 0}, /* 2457887 - 13 May 2017 - 93%  */
-	{12, 0}, /* 2457888 - 14 May 2017 - 88%  */
-	{11, 0}, /* 2457889 - 15 May 2017 - 81%  */
-	{10, 0}, /* 2457890 - 16 May 2017 - 74%  */
-	{9, 0}, /* 2457891 - 17 May 2017 - 65%  */
-	{8, 0}, /* 2457892 - 18 May 2017 - 55%  */
-	{6, 0}, /* 2457893 - 19 May 2017 - 45%  */
-	{5, 0}, /* 2457894 - 20 May 2017 - 34%  */
-	{3, 0}, /* 2457895 - 21 May 2017 - 24%  */
-	{2, 0}, /* 2457896 - 22 May 2017 - 15%  */
-	{1, 0}, /* 2457897 - 23 May 2017 - 8%  */
-	{0, 0}, /* 2457898 - 24 May 2017 - 2%  */
-	{0, 0}, /* 2457899 - 25 May 2017 - 0%  */
-	{0, 1}, /* 2457900 - 26 May 2017 - 0%  */
-	{1, 1}, /* 2457901 - 27 May 2017 - 4%  */
-	{1, 1}, /* 2457902 - 28 May 2017 - 10%  */
-	{3, 1}, /* 2457903 - 29 May 2017 - 18%  */
-	{4, 1}, /* 2457904 - 30 May 2017 - 28%  */
-	{5, 1}, /* 2457905 - 31 May 2017 - 39%  */
-	{7, 1}, /* 2457906 - 1 June 2017 - 49%  */
-	{8, 1}, /* 2457907 - 2 June 2017 - 60%  */
-	{10, 1}, /* 2457908 - 3 June 2017 - 69%  */
-	{11, 1}, /* 2457909 - 4 June 2017 - 78%  */
-	{12, 1}, /* 2457910 - 5 June 2017 - 85%  */
-	{13, 1}, /* 2457911 - 6 June 2017 - 91%  */
-	{13, 1}, /* 2457912 - 7 June 2017 - 96%  */
-	{14, 1}, /* 2457913 - 8 June 2017 - 98%  */
-	{14, 1}, /* 2457914 - 9 June 2017 - 99%  */
-	{14, 0}, /* 2457915 - 10 June 2017 - 99%  */
-	{14, 0}, /* 2457916 - 11 June 2017 - 96%  */
-	{13, 0}, /* 2457917 - 12 June 2017 - 92%  */
-	{12, 0}, /* 2457918 - 13 June 2017 - 86%  */
-	{11, 0}, /* 2457919 - 14 June 2017 - 78%  */
-	{10, 0}, /* 2457920 - 15 June 2017 - 70%  */
-	{8, 0}, /* 2457921 - 16 June 2017 - 60%  */
-	{7, 0}, /* 2457922 - 17 June 2017 - 49%  */
-	{5, 0}, /* 2457923 - 18 June 2017 - 38%  */
-	{4, 0}, /* 2457924 - 19 June 2017 - 28%  */
-	{3, 0}, /* 2457925 - 20 June 2017 - 18%  */
-	{1, 0}, /* 2457926 - 21 June 2017 - 10%  */
-	{1, 0}, /* 2457927 - 22 June 2017 - 3%  */
-	{0, 0}, /* 2457928 - 23 June 2017 - 0%  */
-	{0, 0}, /* 2457929 - 24 June 2017 - 0%  */
-	{0, 1}, /* 2457930 - 25 June 2017 - 2%  */
-	{1, 1}, /* 2457931 - 26 June 2017 - 8%  */
-	{2, 1}, /* 2457932 - 27 June 2017 - 15%  */
-	{3, 1}, /* 2457933 - 28 June 2017 - 24%  */
-	{5, 1}, /* 2457934 - 29 June 2017 - 34%  */
-	{6, 1}, /* 2457935 - 30 June 2017 - 44%  */
-	{8, 1}, /* 2457936 - 1 July 2017 - 54%  */
-	{9, 1}, /* 2457937 - 2 July 2017 - 64%  */
-	{10, 1}, /* 2457938 - 3 July 2017 - 73%  */
-	{11, 1}, /* 2457939 - 4 July 2017 - 81%  */
-	{12, 1}, /* 2457940 - 5 July 2017 - 88%  */
-	{13, 1}, /* 2457941 - 6 July 2017 - 93%  */
-	{14, 1}, /* 2457942 - 7 July 2017 - 97%  */
-	{14, 1}, /* 2457943 - 8 July 2017 - 99%  */
-	{14, 1}, /* 2457944 - 9 July 2017 - 99%  */
-	{14, 0}, /* 2457945 - 10 July 2017 - 98%  */
-	{13, 0}, /* 2457946 - 11 July 2017 - 94%  */
-	{13, 0}, /* 2457947 - 12 July 2017 - 89%  */
-	{12, 0}, /* 2457948 - 13 July 2017 - 82%  */
-	{10, 0}, /* 2457949 - 14 July 2017 - 73%  */
-	{9, 0}, /* 2457950 - 15 July 2017 - 64%  */
-	{7, 0}, /* 2457951 - 16 July 2017 - 53%  */
-	{6, 0}, /* 2457952 - 17 July 2017 - 42%  */
-	{4, 0}, /* 2457953 - 18 July 2017 - 31%  */
-	{3, 0}, /* 2457954 - 19 July 2017 - 20%  */
-	{2, 0}, /* 2457955 - 20 July 2017 - 12%  */
-	{1, 0}, /* 2457956 - 21 July 2017 - 5%  */
-	{0, 0}, /* 2457957 - 22 July 2017 - 1%  */
-	{0, 0}, /* 2457958 - 23 July 2017 - 0%  */
-	{0, 1}, /* 2457959 - 24 July 2017 - 1%  */
-	{1, 1}, /* 2457960 - 25 July 2017 - 5%  */
-	{2, 1}, /* 2457961 - 26 July 2017 - 12%  */
-	{3, 1}, /* 2457962 - 27 July 2017 - 20%  */
-	{4, 1}, /* 2457963 - 28 July 2017 - 29%  */
-	{5, 1}, /* 2457964 - 29 July 2017 - 38%  */
-	{7, 1}, /* 2457965 - 30 July 2017 - 48%  */
-	{8, 1}, /* 2457966 - 31 July 2017 - 58%  */
-	{9, 1}, /* 2457967 - 1 August 2017 - 67%  */
-	{11, 1}, /* 2457968 - 2 August 2017 - 76%  */
-	{12, 1}, /* 2457969 - 3 August 2017 - 83%  */
-	{13, 1}, /* 2457970 - 4 August 2017 - 90%  */
-	{13, 1}, /* 2457971 - 5 August 2017 - 95%  */
-	{14, 1}, /* 2457972 - 6 August 2017 - 98%  */
-	{14, 1}, /* 2457973 - 7 August 2017 - 99%  */
-	{14, 0}, /* 2457974 - 8 August 2017 - 99%  */
-	{14, 0}, /* 2457975 - 9 August 2017 - 96%  */
-	{13, 0}, /* 2457976 - 10 August 2017 - 92%  */
-	{12, 0}, /* 2457977 - 11 August 2017 - 85%  */
-	{11, 0}, /* 2457978 - 12 August 2017 - 77%  */
-	{9, 0}, /* 2457979 - 13 August 2017 - 67%  */
-	{8, 0}, /* 2457980 - 14 August 2017 - 56%  */
-	{6, 0}, /* 2457981 - 15 August 2017 - 44%  */
-	{5, 0}, /* 2457982 - 16 August 2017 - 33%  */
-	{3, 0}, /* 2457983 - 17 August 2017 - 23%  */
-	{2, 0}, /* 2457984 - 18 August 2017 - 14%  */
-	{1, 0}, /* 2457985 - 19 August 2017 - 6%  */
-	{0, 0}, /* 2457986 - 20 August 2017 - 2%  */
-	{0, 0}, /* 2457987 - 21 August 2017 - 0%  */
-	{0, 1}, /* 2457988 - 22 August 2017 - 0%  */
-	{1, 1}, /* 2457989 - 23 August 2017 - 3%  */
-	{1, 1}, /* 2457990 - 24 August 2017 - 8%  */
-	{2, 1}, /* 2457991 - 25 August 2017 - 15%  */
-	{3, 1}, /* 2457992 - 26 August 2017 - 23%  */
-	{5, 1}, /* 2457993 - 27 August 2017 - 32%  */
-	{6, 1}, /* 2457994 - 28 August 2017 - 41%  */
-	{7, 1}, /* 2457995 - 29 August 2017 - 51%  */
-	{9, 1}, /* 2457996 - 30 August 2017 - 60%  */
-	{10, 1}, /* 2457997 - 31 August 2017 - 69%  */
-	{11, 1}, /* 2457998 - 1 September 2017 - 78%  */
-	{12, 1}, /* 2457999 - 2 September 2017 - 85%  */
-	{13, 1}, /* 2458000 - 3 September 2017 - 91%  */
-	{14, 1}, /* 2458001 - 4 September 2017 - 96%  */
-	{14, 1}, /* 2458002 - 5 September 2017 - 99%  */
-	{14, 1}, /* 2458003 - 6 September 2017 - 99%  */
-	{14, 0}, /* 2458004 - 7 September 2017 - 98%  */
-	{13, 0}, /* 2458005 - 8 September 2017 - 94%  */
-	{12, 0}, /* 2458006 - 9 September 2017 - 87%  */
-	{11, 0}, /* 2458007 - 10 September 2017 - 79%  */
-	{10, 0}, /* 2458008 - 11 September 2017 - 69%  */
-	{8, 0}, /* 2458009 - 12 September 2017 - 58%  */
-	{7, 0}, /* 2458010 - 13 September 2017 - 47%  */
-	{5, 0}, /* 2458011 - 14 September 2017 - 36%  */
-	{4, 0}, /* 2458012 - 15 September 2017 - 25%  */
-	{2, 0}, /* 2458013 - 16 September 2017 - 16%  */
-	{1, 0}, /* 2458014 - 17 September 2017 - 8%  */
-	{0, 0}, /* 2458015 - 18 September 2017 - 3%  */
-	{0, 0}, /* 2458016 - 19 September 2017 - 0%  */
-	{0, 0}, /* 2458017 - 20 September 2017 - 0%  */
-	{0, 1}, /* 2458018 - 21 September 2017 - 1%  */
-	{1, 1}, /* 2458019 - 22 September 2017 - 5%  */
-	{2, 1}, /* 2458020 - 23 September 2017 - 11%  */
-	{3, 1}, /* 2458021 - 24 September 2017 - 18%  */
-	{4, 1}, /* 2458022 - 25 September 2017 - 26%  */
-	{5, 1}, /* 2458023 - 26 September 2017 - 34%  */
-	{6, 1}, /* 2458024 - 27 September 2017 - 44%  */
-	{8, 1}, /* 2458025 - 28 September 2017 - 53%  */
-	{9, 1}, /* 2458026 - 29 September 2017 - 62%  */
-	{10, 1}, /* 2458027 - 30 September 2017 - 72%  */
-	{11, 1}, /* 2458028 - 1 October 2017 - 80%  */
-	{12, 1}, /* 2458029 - 2 October 2017 - 87%  */
-	{13, 1}, /* 2458030 - 3 October 2017 - 93%  */
-	{14, 1}, /* 2458031 - 4 October 2017 - 97%  */
-	{14, 1}, /* 2458032 - 5 October 2017 - 99%  */
-	{14, 0}, /* 2458033 - 6 October 2017 - 99%  */
-	{13, 0}, /* 2458034 - 7 October 2017 - 96%  */
-	{13, 0}, /* 2458035 - 8 October 2017 - 90%  */
-	{12, 0}, /* 2458036 - 9 October 2017 - 82%  */
-	{10, 0}, /* 2458037 - 10 October 2017 - 72%  */
-	{9, 0}, /* 2458038 - 11 October 2017 - 61%  */
-	{7, 0}, /* 2458039 - 12 October 2017 - 50%  */
-	{5, 0}, /* 2458040 - 13 October 2017 - 39%  */
-	{4, 0}, /* 2458041 - 14 October 2017 - 28%  */
-	{3, 0}, /* 2458042 - 15 October 2017 - 19%  */
-	{2, 0}, /* 2458043 - 16 October 2017 - 11%  */
-	{1, 0}, /* 2458044 - 17 October 2017 - 5%  */
-	{0, 0}, /* 2458045 - 18 October 2017 - 1%  */
-	{0, 0}, /* 2458046 - 19 October 2017 - 0%  */
-	{0, 1}, /* 2458047 - 20 October 2017 - 0%  */
-	{0, 1}, /* 2458048 - 21 October 2017 - 2%  */
-	{1, 1}, /* 2458049 - 22 October 2017 - 7%  */
-	{2, 1}, /* 2458050 - 23 October 2017 - 12%  */
-	{3, 1}, /* 2458051 - 24 October 2017 - 19%  */
-	{4, 1}, /* 2458052 - 25 October 2017 - 27%  */
-	{5, 1}, /* 2458053 - 26 October 2017 - 36%  */
-	{6, 1}, /* 2458054 - 27 October 2017 - 45%  */
-	{8, 1}, /* 2458055 - 28 October 2017 - 55%  */
-	{9, 1}, /* 2458056 - 29 October 2017 - 65%  */
-	{10, 1}, /* 2458057 - 30 October 2017 - 74%  */
-	{12, 1}, /* 2458058 - 31 October 2017 - 83%  */
-	{13, 1}, /* 2458059 - 1 November 2017 - 90%  */
-	{13, 1}, /* 2458060 - 2 November 2017 - 95%  */
-	{14, 1}, /* 2458061 - 3 November 2017 - 99%  */
-	{14, 1}, /* 2458062 - 4 November 2017 - 99%  */
-	{14, 0}, /* 2458063 - 5 November 2017 - 97%  */
-	{13, 0}, /* 2458064 - 6 November 2017 - 92%  */
-	{12, 0}, /* 2458065 - 7 November 2017 - 85%  */
-	{11, 0}, /* 2458066 - 8 November 2017 - 75%  */
-	{9, 0}, /* 2458067 - 9 November 2017 - 65%  */
-	{8, 0}, /* 2458068 - 10 November 2017 - 54%  */
-	{6, 0}, /* 2458069 - 11 November 2017 - 43%  */
-	{5, 0}, /* 2458070 - 12 November 2017 - 32%  */
-	{3, 0}, /* 2458071 - 13 November 2017 - 23%  */
-	{2, 0}, /* 2458072 - 14 November 2017 - 15%  */
-	{1, 0}, /* 2458073 - 15 November 2017 - 8%  */
-	{1, 0}, /* 2458074 - 16 November 2017 - 3%  */
-	{0, 0}, /* 2458075 - 17 November 2017 - 0%  */
-	{0, 0}, /* 2458076 - 18 November 2017 - 0%  */
-	{0, 1}, /* 2458077 - 19 November 2017 - 0%  */
-	{1, 1}, /* 2458078 - 20 November 2017 - 3%  */
-	{1, 1}, /* 2458079 - 21 November 2017 - 8%  */
-	{2, 1}, /* 2458080 - 22 November 2017 - 13%  */
-	{3, 1}, /* 2458081 - 23 November 2017 - 21%  */
-	{4, 1}, /* 2458082 - 24 November 2017 - 29%  */
-	{5, 1}, /* 2458083 - 25 November 2017 - 38%  */
-	{7, 1}, /* 2458084 - 26 November 2017 - 48%  */
-	{8, 1}, /* 2458085 - 27 November 2017 - 58%  */
-	{10, 1}, /* 2458086 - 28 November 2017 - 68%  */
-	{11, 1}, /* 2458087 - 29 November 2017 - 77%  */
-	{12, 1}, /* 2458088 - 30 November 2017 - 86%  */
-	{13, 1}, /* 2458089 - 1 December 2017 - 93%  */
-	{14, 1}, /* 2458090 - 2 December 2017 - 97%  */
-	{14, 1}, /* 2458091 - 3 December 2017 - 99%  */
-	{14, 0}, /* 2458092 - 4 December 2017 - 98%  */
-	{13, 0}, /* 2458093 - 5 December 2017 - 94%  */
-	{12, 0}, /* 2458094 - 6 December 2017 - 88%  */
-	{11, 0}, /* 2458095 - 7 December 2017 - 79%  */
-	{10, 0}, /* 2458096 - 8 December 2017 - 69%  */
-	{8, 0}, /* 2458097 - 9 December 2017 - 59%  */
-	{7, 0}, /* 2458098 - 10 December 2017 - 48%  */
-	{5, 0}, /* 2458099 - 11 December 2017 - 37%  */
-	{4, 0}, /* 2458100 - 12 December 2017 - 28%  */
-	{3, 0}, /* 2458101 - 13 December 2017 - 19%  */
-	{2, 0}, /* 2458102 - 14 December 2017 - 12%  */
-	{1, 0}, /* 2458103 - 15 December 2017 - 6%  */
-	{0, 0}, /* 2458104 - 16 December 2017 - 2%  */
-	{0, 0}, /* 2458105 - 17 December 2017 - 0%  */
-	{0, 0}, /* 2458106 - 18 December 2017 - 0%  */
-	{0, 1}, /* 2458107 - 19 December 2017 - 1%  */
-	{1, 1}, /* 2458108 - 20 December 2017 - 4%  */
-	{1, 1}, /* 2458109 - 21 December 2017 - 9%  */
-	{2, 1}, /* 2458110 - 22 December 2017 - 15%  */
-	{3, 1}, /* 2458111 - 23 December 2017 - 22%  */
-	{4, 1}, /* 2458112 - 24 December 2017 - 31%  */
-	{6, 1}, /* 2458113 - 25 December 2017 - 41%  */
-	{7, 1}, /* 2458114 - 26 December 2017 - 51%  */
-	{9, 1}, /* 2458115 - 27 December 2017 - 61%  */
-	{10, 1}, /* 2458116 - 28 December 2017 - 72%  */
-	{11, 1}, /* 2458117 - 29 December 2017 - 81%  */
-	{13, 1}, /* 2458118 - 30 December 2017 - 89%  */
-	{13, 1}, /* 2458119 - 31 December 2017 - 96%  */
-	{14, 1}, /* 2458120 - 1 January 2018 - 99%  */
-	{14, 1}, /* 2458121 - 2 January 2018 - 99%  */
-	{14, 0}, /* 2458122 - 3 January 2018 - 97%  */
-	{13, 0}, /* 2458123 - 4 January 2018 - 91%  */
-	{12, 0}, /* 2458124 - 5 January 2018 - 84%  */
-	{10, 0}, /* 2458125 - 6 January 2018 - 74%  */
-	{9, 0}, /* 2458126 - 7 January 2018 - 64%  */
-	{8, 0}, /* 2458127 - 8 January 2018 - 54%  */
-	{6, 0}, /* 2458128 - 9 January 2018 - 44%  */
-	{5, 0}, /* 2458129 - 10 January 2018 - 34%  */
-	{4, 0}, /* 2458130 - 11 January 2018 - 25%  */
-	{3, 0}, /* 2458131 - 12 January 2018 - 17%  */
-	{2, 0}, /* 2458132 - 13 January 2018 - 11%  */
-	{1, 0}, /* 2458133 - 14 January 2018 - 5%  */
-	{0, 0}, /* 2458134 - 15 January 2018 - 2%  */
-	{0, 0}, /* 2458135 - 16 January 2018 - 0%  */
-	{0, 0}, /* 2458136 - 17 January 2018 - 0%  */
-	{0, 1}, /* 2458137 - 18 January 2018 - 1%  */
-	{1, 1}, /* 2458138 - 19 January 2018 - 5%  */
-	{1, 1}, /* 2458139 - 20 January 2018 - 10%  */
-	{2, 1}, /* 2458140 - 21 January 2018 - 17%  */
-	{4, 1}, /* 2458141 - 22 January 2018 - 25%  */
-	{5, 1}, /* 2458142 - 23 January 2018 - 35%  */
-	{6, 1}, /* 2458143 - 24 January 2018 - 45%  */
-	{8, 1}, /* 2458144 - 25 January 2018 - 56%  */
-	{9, 1}, /* 2458145 - 26 January 2018 - 67%  */
-	{11, 1}, /* 2458146 - 27 January 2018 - 77%  */
-	{12, 1}, /* 2458147 - 28 January 2018 - 86%  */
-	{13, 1}, /* 2458148 - 29 January 2018 - 93%  */
-	{14, 1}, /* 2458149 - 30 January 2018 - 98%  */
-	{14, 1}, /* 2458150 - 31 January 2018 - 99%  */
-	{14, 0}, /* 2458151 - 1 February 2018 - 98%  */
-	{13, 0}, /* 2458152 - 2 February 2018 - 94%  */
-	{12, 0}, /* 2458153 - 3 February 2018 - 88%  */
-	{11, 0}, /* 2458154 - 4 February 2018 - 80%  */
-	{10, 0}, /* 2458155 - 5 February 2018 - 71%  */
-	{9, 0}, /* 2458156 - 6 February 2018 - 61%  */
-	{7, 0}, /* 2458157 - 7 February 2018 - 51%  */
-	{6, 0}, /* 2458158 - 8 February 2018 - 42%  */
-	{5, 0}, /* 2458159 - 9 February 2018 - 32%  */
-	{3, 0}, /* 2458160 - 10 February 2018 - 24%  */
-	{2, 0}, /* 2458161 - 11 February 2018 - 16%  */
-	{1, 0}, /* 2458162 - 12 February 2018 - 10%  */
-	{1, 0}, /* 2458163 - 13 February 2018 - 5%  */
-	{0, 0}, /* 2458164 - 14 February 2018 - 1%  */
-	{0, 0}, /* 2458165 - 15 February 2018 - 0%  */
-	{0, 1}, /* 2458166 - 16 February 2018 - 0%  */
-	{0, 1}, /* 2458167 - 17 February 2018 - 2%  */
-	{1, 1}, /* 2458168 - 18 February 2018 - 6%  */
-	{2, 1}, /* 2458169 - 19 February 2018 - 12%  */
-	{3, 1}, /* 2458170 - 20 February 2018 - 20%  */
-	{4, 1}, /* 2458171 - 21 February 2018 - 30%  */
-	{6, 1}, /* 2458172 - 22 February 2018 - 40%  */
-	{7, 1}, /* 2458173 - 23 February 2018 - 51%  */
-	{9, 1}, /* 2458174 - 24 February 2018 - 63%  */
-	{10, 1}, /* 2458175 - 25 February 2018 - 73%  */
-	{12, 1}, /* 2458176 - 26 February 2018 - 83%  */
-	{13, 1}, /* 2458177 - 27 February 2018 - 91%  */
-	{14, 1}, /* 2458178 - 28 February 2018 - 96%  */
-	{14, 1}, /* 2458179 - 1 March 2018 - 99%  */
-	{14, 1}, /* 2458180 - 2 March 2018 - 99%  */
-	{14, 0}, /* 2458181 - 3 March 2018 - 97%  */
-	{13, 0}, /* 2458182 - 4 March 2018 - 92%  */
-	{12, 0}, /* 2458183 - 5 March 2018 - 85%  */
-	{11, 0}, /* 2458184 - 6 March 2018 - 77%  */
-	{10, 0}, /* 2458185 - 7 March 2018 - 68%  */
-	{8, 0}, /* 2458186 - 8 March 2018 - 59%  */
-	{7, 0}, /* 2458187 - 9 March 2018 - 49%  */
-	{6, 0}, /* 2458188 - 10 March 2018 - 40%  */
-	{4, 0}, /* 2458189 - 11 March 2018 - 31%  */
-	{3, 0}, /* 2458190 - 12 March 2018 - 23%  */
-	{2, 0}, /* 2458191 - 13 March 2018 - 15%  */
-	{1, 0}, /* 2458192 - 14 March 2018 - 9%  */
-	{1, 0}, /* 2458193 - 15 March 2018 - 4%  */
-	{0, 0}, /* 2458194 - 16 March 2018 - 1%  */
-	{0, 0}, /* 2458195 - 17 March 2018 - 0%  */
-	{0, 1}, /* 2458196 - 18 March 2018 - 1%  */
-	{1, 1}, /* 2458197 - 19 March 2018 - 4%  */
-	{1, 1}, /* 2458198 - 20 March 2018 - 9%  */
-	{2, 1}, /* 2458199 - 21 March 2018 - 17%  */
-	{4, 1}, /* 2458200 - 22 March 2018 - 26%  */
-	{5, 1}, /* 2458201 - 23 March 2018 - 37%  */
-	{7, 1}, /* 2458202 - 24 March 2018 - 48%  */
-	{8, 1}, /* 2458203 - 25 March 2018 - 59%  */
-	{10, 1}, /* 2458204 - 26 March 2018 - 70%  */
-	{11, 1}, /* 2458205 - 27 March 2018 - 80%  */
-	{12, 1}, /* 2458206 - 28 March 2018 - 88%  */
-	{13, 1}, /* 2458207 - 29 March 2018 - 94%  */
-	{14, 1}, /* 2458208 - 30 March 2018 - 98%  */
-	{14, 1}, /* 2458209 - 31 March 2018 - 99%  */
-	{14, 0}, /* 2458210 - 1 April 2018 - 98%  */
-	{13, 0}, /* 2458211 - 2 April 2018 - 95%  */
-	{13, 0}, /* 2458212 - 3 April 2018 - 90%  */
-	{12, 0}, /* 2458213 - 4 April 2018 - 83%  */
-	{11, 0}, /* 2458214 - 5 April 2018 - 75%  */
-	{9, 0}, /* 2458215 - 6 April 2018 - 66%  */
-	{8, 0}, /* 2458216 - 7 April 2018 - 57%  */
-	{7, 0}, /* 2458217 - 8 April 2018 - 48%  */
-	{5, 0}, /* 2458218 - 9 April 2018 - 38%  */
-	{4, 0}, /* 2458219 - 10 April 2018 - 29%  */
-	{3, 0}, /* 2458220 - 11 April 2018 - 21%  */
-	{2, 0}, /* 2458221 - 12 April 2018 - 13%  */
-	{1, 0}, /* 2458222 - 13 April 2018 - 7%  */
-	{0, 0}, /* 2458223 - 14 April 2018 - 2%  */
-	{0, 0}, /* 2458224 - 15 April 2018 - 0%  */
-	{0, 0}, /* 2458225 - 16 April 2018 - 0%  */
-	{0, 1}, /* 2458226 - 17 April 2018 - 2%  */
-	{1, 1}, /* 2458227 - 18 April 2018 - 7%  */
-	{2, 1}, /* 2458228 - 19 April 2018 - 14%  */
-	{3, 1}, /* 2458229 - 20 April 2018 - 23%  */
-	{5, 1}, /* 2458230 - 21 April 2018 - 34%  */
-	{6, 1}, /* 2458231 - 22 April 2018 - 45%  */
-	{8, 1}, /* 2458232 - 23 April 2018 - 56%  */
-	{9, 1}, /* 2458233 - 24 April 2018 - 67%  */
-	{11, 1}, /* 2458234 - 25 April 2018 - 77%  */
-	{12, 1}, /* 2458235 - 26 April 2018 - 86%  */
-	{13, 1}, /* 2458236 - 27 April 2018 - 92%  */
-	{14, 1}, /* 2458237 - 28 April 2018 - 97%  */
-	{14, 1}, /* 2458238 - 29 April 2018 - 99%  */
-	{14, 1}, /* 2458239 - 30 April 2018 - 99%  */
-	{14, 0}, /* 2458240 - 1 May 2018 - 97%  */
-	{13, 0}, /* 2458241 - 2 May 2018 - 93%  */
-	{12, 0}, /* 2458242 - 3 May 2018 - 88%  */
-	{11, 0}, /* 2458243 - 4 May 2018 - 81%  */
-	{10, 0}, /* 2458244 - 5 May 2018 - 73%  */
-	{9, 0}, /* 2458245 - 6 May 2018 - 64%  */
-	{8, 0}, /* 2458246 - 7 May 2018 - 55%  */
-	{6, 0}, /* 2458247 - 8 May 2018 - 46%  */
-	{5, 0}, /* 2458248 - 9 May 2018 - 36%  */
-	{4, 0}, /* 2458249 - 10 May 2018 - 27%  */
-	{3, 0}, /* 2458250 - 11 May 2018 - 18%  */
-	{2, 0}, /* 2458251 - 12 May 2018 - 11%  */
-	{1, 0}, /* 2458252 - 13 May 2018 - 5%  */
-	{0, 0}, /* 2458253 - 14 May 2018 - 1%  */
-	{0, 0}, /* 2458254 - 15 May 2018 - 0%  */
-	{0, 1}, /* 2458255 - 16 May 2018 - 1%  */
-	{1, 1}, /* 2458256 - 17 May 2018 - 5%  */
-	{2, 1}, /* 2458257 - 18 May 2018 - 12%  */
-	{3, 1}, /* 2458258 - 19 May 2018 - 21%  */
-	{4, 1}, /* 2458259 - 20 May 2018 - 31%  */
-	{6, 1}, /* 2458260 - 21 May 2018 - 42%  */
-	{8, 1}, /* 2458261 - 22 May 2018 - 53%  */
-	{9, 1}, /* 2458262 - 23 May 2018 - 64%  */
-	{10, 1}, /* 2458263 - 24 May 2018 - 74%  */
-	{12, 1}, /* 2458264 - 25 May 2018 - 83%  */
-	{13, 1}, /* 2458265 - 26 May 2018 - 90%  */
-	{13, 1}, /* 2458266 - 27 May 2018 - 95%  */
-	{14, 1}, /* 2458267 - 28 May 2018 - 98%  */
-	{14, 1}, /* 2458268 - 29 May 2018 - 99%  */
-	{14, 0}, /* 2458269 - 30 May 2018 - 99%  */
-	{14, 0}, /* 2458270 - 31 May 2018 - 96%  */
-	{13, 0}, /* 2458271 - 1 June 2018 - 92%  */
-	{12, 0}, /* 2458272 - 2 June 2018 - 86%  */
-	{11, 0}, /* 2458273 - 3 June 2018 - 79%  */
-	{10, 0}, /* 2458274 - 4 June 2018 - 71%  */
-	{9, 0}, /* 2458275 - 5 June 2018 - 62%  */
-	{7, 0}, /* 2458276 - 6 June 2018 - 52%  */
-	{6, 0}, /* 2458277 - 7 June 2018 - 42%  */
-	{5, 0}, /* 2458278 - 8 June 2018 - 32%  */
-	{3, 0}, /* 2458279 - 9 June 2018 - 23%  */
-	{2, 0}, /* 2458280 - 10 June 2018 - 14%  */
-	{1, 0}, /* 2458281 - 11 June 2018 - 7%  */
-	{0, 0}, /* 2458282 - 12 June 2018 - 2%  */
-	{0, 0}, /* 2458283 - 13 June 2018 - 0%  */
-	{0, 1}, /* 2458284 - 14 June 2018 - 0%  */
-	{1, 1}, /* 2458285 - 15 June 2018 - 4%  */
-	{1, 1}, /* 2458286 - 16 June 2018 - 10%  */
-	{3, 1}, /* 2458287 - 17 June 2018 - 18%  */
-	{4, 1}, /* 2458288 - 18 June 2018 - 28%  */
-	{6, 1}, /* 2458289 - 19 June 2018 - 39%  */
-	{7, 1}, /* 2458290 - 20 June 2018 - 50%  */
-	{9, 1}, /* 2458291 - 21 June 2018 - 61%  */
-	{10, 1}, /* 2458292 - 22 June 2018 - 71%  */
-	{11, 1}, /* 2458293 - 23 June 2018 - 80%  */
-	{12, 1}, /* 2458294 - 24 June 2018 - 87%  */
-	{13, 1}, /* 2458295 - 25 June 2018 - 93%  */
-	{14, 1}, /* 2458296 - 26 June 2018 - 97%  */
-	{14, 1}, /* 2458297 - 27 June 2018 - 99%  */
-	{14, 1}, /* 2458298 - 28 June 2018 - 99%  */
-	{14, 0}, /* 2458299 - 29 June 2018 - 98%  */
-	{13, 0}, /* 2458300 - 30 June 2018 - 95%  */
-	{13, 0}, /* 2458301 - 1 July 2018 - 90%  */
-	{12, 0}, /* 2458302 - 2 July 2018 - 84%  */
-	{11, 0}, /* 2458303 - 3 July 2018 - 76%  */
-	{10, 0}, /* 2458304 - 4 July 2018 - 67%  */
-	{8, 0}, /* 2458305 - 5 July 2018 - 58%  */
-	{7, 0}, /* 2458306 - 6 July 2018 - 48%  */
-	{5, 0}, /* 2458307 - 7 July 2018 - 37%  */
-	{4, 0}, /* 2458308 - 8 July 2018 - 27%  */
-	{3, 0}, /* 2458309 - 9 July 2018 - 18%  */
-	{1, 0}, /* 2458310 - 10 July 2018 - 10%  */
-	{1, 0}, /* 2458311 - 11 July 2018 - 4%  */
-	{0, 0}, /* 2458312 - 12 July 2018 - 0%  */
-	{0, 0}, /* 2458313 - 13 July 2018 - 0%  */
-	{0, 1}, /* 2458314 - 14 July 2018 - 2%  */
-	{1, 1}, /* 2458315 - 15 July 2018 - 8%  */
-	{2, 1}, /* 2458316 - 16 July 2018 - 16%  */
-	{4, 1}, /* 2458317 - 17 July 2018 - 25%  */
-	{5, 1}, /* 2458318 - 18 July 2018 - 35%  */
-	{7, 1}, /* 2458319 - 19 July 2018 - 46%  */
-	{8, 1}, /* 2458320 - 20 July 2018 - 57%  */
-	{9, 1}, /* 2458321 - 21 July 2018 - 66%  */
-	{11, 1}, /* 2458322 - 22 July 2018 - 75%  */
-	{12, 1}, /* 2458323 - 23 July 2018 - 83%  */
-	{13, 1}, /* 2458324 - 24 July 2018 - 90%  */
-	{13, 1}, /* 2458325 - 25 July 2018 - 95%  */
-	{14, 1}, /* 2458326 - 26 July 2018 - 98%  */
-	{14, 1}, /* 2458327 - 27 July 2018 - 99%  */
-	{14, 0}, /* 2458328 - 28 July 2018 - 99%  */
-	{14, 0}, /* 2458329 - 29 July 2018 - 97%  */
-	{13, 0}, /* 2458330 - 30 July 2018 - 93%  */
-	{12, 0}, /* 2458331 - 31 July 2018 - 88%  */
-	{11, 0}, /* 2458332 - 1 August 2018 - 81%  */
-	{10, 0}, /* 2458333 - 2 August 2018 - 72%  */
-	{9, 0}, /* 2458334 - 3 August 2018 - 63%  */
-	{7, 0}, /* 2458335 - 4 August 2018 - 52%  */
-	{6, 0}, /* 2458336 - 5 August 2018 - 42%  */
-	{4, 0}, /* 2458337 - 6 August 2018 - 31%  */
-	{3, 0}, /* 2458338 - 7 August 2018 - 21%  */
-	{2, 0}, /* 2458339 - 8 August 2018 - 12%  */
-	{1, 0}, /* 2458340 - 9 August 2018 - 5%  */
-	{0, 0}, /* 2458341 - 10 August 2018 - 1%  */
-	{0, 0}, /* 2458342 - 11 August 2018 - 0%  */
-	{0, 1}, /* 2458343 - 12 August 2018 - 1%  */
-	{1, 1}, /* 2458344 - 13 August 2018 - 6%  */
-	{2, 1}, /* 2458345 - 14 August 2018 - 13%  */
-	{3, 1}, /* 2458346 - 15 August 2018 - 21%  */
-	{4, 1}, /* 2458347 - 16 August 2018 - 31%  */
-	{6, 1}, /* 2458348 - 17 August 2018 - 41%  */
-	{7, 1}, /* 2458349 - 18 August 2018 - 51%  */
-	{9, 1}, /* 2458350 - 19 August 2018 - 61%  */
-	{10, 1}, /* 2458351 - 20 August 2018 - 70%  */
-	{11, 1}, /* 2458352 - 21 August 2018 - 78%  */
-	{12, 1}, /* 2458353 - 22 August 2018 - 86%  */
-	{13, 1}, /* 2458354 - 23 August 2018 - 92%  */
-	{13, 1}, /* 2458355 - 24 August 2018 - 96%  */
-	{14, 1}, /* 2458356 - 25 August 2018 - 99%  */
-	{14, 1}, /* 2458357 - 26 August 2018 - 99%  */
-	{14, 0}, /* 2458358 - 27 August 2018 - 99%  */
-	{13, 0}, /* 2458359 - 28 August 2018 - 96%  */
-	{13, 0}, /* 2458360 - 29 August 2018 - 91%  */
-	{12, 0}, /* 2458361 - 30 August 2018 - 84%  */
-	{11, 0}, /* 2458362 - 31 August 2018 - 76%  */
-	{9, 0}, /* 2458363 - 1 September 2018 - 67%  */
-	{8, 0}, /* 2458364 - 2 September 2018 - 56%  */
-	{6, 0}, /* 2458365 - 3 September 2018 - 45%  */
-	{5, 0}, /* 2458366 - 4 September 2018 - 34%  */
-	{3, 0}, /* 2458367 - 5 September 2018 - 24%  */
-	{2, 0}, /* 2458368 - 6 September 2018 - 14%  */
-	{1, 0}, /* 2458369 - 7 September 2018 - 7%  */
-	{0, 0}, /* 2458370 - 8 September 2018 - 2%  */
-	{0, 0}, /* 2458371 - 9 September 2018 - 0%  */
-	{0, 1}, /* 2458372 - 10 September 2018 - 0%  */
-	{1, 1}, /* 2458373 - 11 September 2018 - 4%  */
-	{1, 1}, /* 2458374 - 12 September 2018 - 10%  */
-	{2, 1}, /* 2458375 - 13 September 2018 - 17%  */
-	{4, 1}, /* 2458376 - 14 September 2018 - 26%  */
-	{5, 1}, /* 2458377 - 15 September 2018 - 35%  */
-	{6, 1}, /* 2458378 - 16 September 2018 - 45%  */
-	{8, 1}, /* 2458379 - 17 September 2018 - 55%  */
-	{9, 1}, /* 2458380 - 18 September 2018 - 64%  */
-	{10, 1}, /* 2458381 - 19 September 2018 - 73%  */
-	{11, 1}, /* 2458382 - 20 September 2018 - 81%  */
-	{12, 1}, /* 2458383 - 21 September 2018 - 87%  */
-	{13, 1}, /* 2458384 - 22 September 2018 - 93%  */
-	{14, 1}, /* 2458385 - 23 September 2018 - 97%  */
-	{14, 1}, /* 2458386 - 24 September 2018 - 99%  */
-	{14, 1}, /* 2458387 - 25 September 2018 - 99%  */
-	{14, 0}, /* 2458388 - 26 September 2018 - 98%  */
-	{13, 0}, /* 2458389 - 27 September 2018 - 94%  */
-	{12, 0}, /* 2458390 - 28 September 2018 - 88%  */
-	{11, 0}, /* 2458391 - 29 September 2018 - 80%  */
-	{10, 0}, /* 2458392 - 30 September 2018 - 70%  */
-	{8, 0}, /* 2458393 - 1 October 2018 - 60%  */
-	{7, 0}, /* 2458394 - 2 October 2018 - 49%  */
-	{5, 0}, /* 2458395 - 3 October 2018 - 37%  */
-	{4, 0}, /* 2458396 - 4 October 2018 - 26%  */
-	{2, 0}, /* 2458397 - 5 October 2018 - 17%  */
-	{1, 0}, /* 2458398 - 6 October 2018 - 9%  */
-	{1, 0}, /* 2458399 - 7 October 2018 - 3%  */
-	{0, 0}, /* 2458400 - 8 October 2018 - 0%  */
-	{0, 0}, /* 2458401 - 9 October 2018 - 0%  */
-	{0, 1}, /* 2458402 - 10 October 2018 - 2%  */
-	{1, 1}, /* 2458403 - 11 October 2018 - 6%  */
-	{2, 1}, /* 2458404 - 12 October 2018 - 12%  */
-	{3, 1}, /* 2458405 - 13 October 2018 - 20%  */
-	{4, 1}, /* 2458406 - 14 October 2018 - 29%  */
-	{5, 1}, /* 2458407 - 15 October 2018 - 38%  */
-	{7, 1}, /* 2458408 - 16 October 2018 - 47%  */
-	{8, 1}, /* 2458409 - 17 October 2018 - 57%  */
-	{9, 1}, /* 2458410 - 18 October 2018 - 66%  */
-	{10, 1}, /* 2458411 - 19 October 2018 - 74%  */
-	{12, 1}, /* 2458412 - 20 October 2018 - 82%  */
-	{13, 1}, /* 2458413 - 21 October 2018 - 89%  */
-	{13, 1}, /* 2458414 - 22 October 2018 - 94%  */
-	{14, 1}, /* 2458415 - 23 October 2018 - 98%  */
-	{14, 1}, /* 2458416 - 24 October 2018 - 99%  */
-	{14, 0}, /* 2458417 - 25 October 2018 - 99%  */
-	{13, 0}, /* 2458418 - 26 October 2018 - 96%  */
-	{13, 0}, /* 2458419 - 27 October 2018 - 90%  */
-	{12, 0}, /* 2458420 - 28 October 2018 - 83%  */
-	{10, 0}, /* 2458421 - 29 October 2018 - 74%  */
-	{9, 0}, /* 2458422 - 30 October 2018 - 63%  */
-	{7, 0}, /* 2458423 - 31 October 2018 - 52%  */
-	{6, 0}, /* 2458424 - 1 November 2018 - 40%  */
-	{4, 0}, /* 2458425 - 2 November 2018 - 29%  */
-	{3, 0}, /* 2458426 - 3 November 2018 - 20%  */
-	{2, 0}, /* 2458427 - 4 November 2018 - 11%  */
-	{1, 0}, /* 2458428 - 5 November 2018 - 5%  */
-	{0, 0}, /* 2458429 - 6 November 2018 - 1%  */
-	{0, 0}, /* 2458430 - 7 November 2018 - 0%  */
-	{0, 1}, /* 2458431 - 8 November 2018 - 0%  */
-	{1, 1}, /* 2458432 - 9 November 2018 - 3%  */
-	{1, 1}, /* 2458433 - 10 November 2018 - 8%  */
-	{2, 1}, /* 2458434 - 11 November 2018 - 14%  */
-	{3, 1}, /* 2458435 - 12 November 2018 - 22%  */
-	{4, 1}, /* 2458436 - 13 November 2018 - 30%  */
-	{6, 1}, /* 2458437 - 14 November 2018 - 39%  */
-	{7, 1}, /* 2458438 - 15 November 2018 - 48%  */
-	{8, 1}, /* 2458439 - 16 November 2018 - 58%  */
-	{9, 1}, /* 2458440 - 17 November 2018 - 67%  */
-	{11, 1}, /* 2458441 - 18 November 2018 - 76%  */
-	{12, 1}, /* 2458442 - 19 November 2018 - 84%  */
-	{13, 1}, /* 2458443 - 20 November 2018 - 91%  */
-	{13, 1}, /* 2458444 - 21 November 2018 - 96%  */
-	{14, 1}, /* 2458445 - 22 November 2018 - 99%  */
-	{14, 1}, /* 2458446 - 23 November 2018 - 99%  */
-	{14, 0}, /* 2458447 - 24 November 2018 - 97%  */
-	{13, 0}, /* 2458448 - 25 November 2018 - 93%  */
-	{12, 0}, /* 2458449 - 26 November 2018 - 86%  */
-	{11, 0}, /* 2458450 - 27 November 2018 - 77%  */
-	{9, 0}, /* 2458451 - 28 November 2018 - 67%  */
-	{8, 0}, /* 2458452 - 29 November 2018 - 55%  */
-	{6, 0}, /* 2458453 - 30 November 2018 - 44%  */
-	{5, 0}, /* 2458454 - 1 December 2018 - 33%  */
-	{3, 0}, /* 2458455 - 2 December 2018 - 23%  */
-	{2, 0}, /* 2458456 - 3 December 2018 - 15%  */
-	{1, 0}, /* 2458457 - 4 December 2018 - 8%  */
-	{0, 0}, /* 2458458 - 5 December 2018 - 3%  */
-	{0, 0}, /* 2458459 - 6 December 2018 - 0%  */
-	{0, 0}, /* 2458460 - 7 December 2018 - 0%  */
-	{0, 1}, /* 2458461 - 8 December 2018 - 1%  */
-	{1, 1}, /* 2458462 - 9 December 2018 - 4%  */
-	{1, 1}, /* 2458463 - 10 December 2018 - 9%  */
-	{2, 1}, /* 2458464 - 11 December 2018 - 15%  */
-	{3, 1}, /* 2458465 - 12 December 2018 - 23%  */
-	{4, 1}, /* 2458466 - 13 December 2018 - 31%  */
-	{6, 1}, /* 2458467 - 14 December 2018 - 40%  */
-	{7, 1}, /* 2458468 - 15 December 2018 - 50%  */
-	{8, 1}, /* 2458469 - 16 December 2018 - 59%  */
-	{10, 1}, /* 2458470 - 17 December 2018 - 69%  */
-	{11, 1}, /* 2458471 - 18 December 2018 - 78%  */
-	{12, 1}, /* 2458472 - 19 December 2018 - 86%  */
-	{13, 1}, /* 2458473 - 20 December 2018 - 93%  */
-	{14, 1}, /* 2458474 - 21 December 2018 - 97%  */
-	{14, 1}, /* 2458475 - 22 December 2018 - 99%  */
-	{14, 0}, /* 2458476 - 23 December 2018 - 99%  */
-	{13, 0}, /* 2458477 - 24 December 2018 - 95%  */
-	{13, 0}, /* 2458478 - 25 December 2018 - 89%  */
-	{11, 0}, /* 2458479 - 26 December 2018 - 80%  */
-	{10, 0}, /* 2458480 - 27 December 2018 - 70%  */
-	{8, 0}, /* 2458481 - 28 December 2018 - 60%  */
-	{7, 0}, /* 2458482 - 29 December 2018 - 48%  */
-	{5, 0}, /* 2458483 - 30 December 2018 - 38%  */
-	{4, 0}, /* 2458484 - 31 December 2018 - 28%  */
-	{3, 0}, /* 2458485 - 1 January 2019 - 19%  */
-	{2, 0}, /* 2458486 - 2 January 2019 - 11%  */
-	{1, 0}, /* 2458487 - 3 January 2019 - 6%  */
-	{0, 0}, /* 2458488 - 4 January 2019 - 2%  */
-	{0, 0}, /* 2458489 - 5 January 2019 - 0%  */
-	{0, 0}, /* 2458490 - 6 January 2019 - 0%  */
-	{0, 1}, /* 2458491 - 7 January 2019 - 1%  */
-	{1, 1}, /* 2458492 - 8 January 2019 - 5%  */
-	{1, 1}, /* 2458493 - 9 January 2019 - 10%  */
-	{2, 1}, /* 2458494 - 10 January 2019 - 16%  */
-	{3, 1}, /* 2458495 - 11 January 2019 - 24%  */
-	{5, 1}, /* 2458496 - 12 January 2019 - 32%  */
-	{6, 1}, /* 2458497 - 13 January 2019 - 42%  */
-	{7, 1}, /* 2458498 - 14 January 2019 - 52%  */
-	{9, 1}, /* 2458499 - 15 January 2019 - 62%  */
-	{10, 1}, /* 2458500 - 16 January 2019 - 72%  */
-	{11, 1}, /* 2458501 - 17 January 2019 - 81%  */
-	{13, 1}, /* 2458502 - 18 January 2019 - 89%  */
-	{13, 1}, /* 2458503 - 19 January 2019 - 95%  */
-	{14, 1}, /* 2458504 - 20 January 2019 - 99%  */
-	{14, 1}, /* 2458505 - 21 January 2019 - 99%  */
-	{14, 0}, /* 2458506 - 22 January 2019 - 97%  */
-	{13, 0}, /* 2458507 - 23 January 2019 - 92%  */
-	{12, 0}, /* 2458508 - 24 January 2019 - 84%  */
-	{11, 0}, /* 2458509 - 25 January 2019 - 75%  */
-	{9, 0}, /* 2458510 - 26 January 2019 - 65%  */
-	{8, 0}, /* 2458511 - 27 January 2019 - 54%  */
-	{6, 0}, /* 2458512 - 28 January 2019 - 43%  */
-	{5, 0}, /* 2458513 - 29 January 2019 - 33%  */
-	{3, 0}, /* 2458514 - 30 January 2019 - 24%  */
-	{2, 0}, /* 2458515 - 31 January 2019 - 16%  */
-	{1, 0}, /* 2458516 - 1 February 2019 - 10%  */
-	{1, 0}, /* 2458517 - 2 February 2019 - 5%  */
-	{0, 0}, /* 2458518 - 3 February 2019 - 1%  */
-	{0, 0}, /* 2458519 - 4 February 2019 - 0%  */
-	{0, 1}, /* 2458520 - 5 February 2019 - 0%  */
-	{0, 1}, /* 2458521 - 6 February 2019 - 2%  */
-	{1, 1}, /* 2458522 - 7 February 2019 - 6%  */
-	{2, 1}, /* 2458523 - 8 February 2019 - 11%  */
-	{3, 1}, /* 2458524 - 9 February 2019 - 18%  */
-	{4, 1}, /* 2458525 - 10 February 2019 - 26%  */
-	{5, 1}, /* 2458526 - 11 February 2019 - 35%  */
-	{6, 1}, /* 2458527 - 12 February 2019 - 45%  */
-	{8, 1}, /* 2458528 - 13 February 2019 - 56%  */
-	{9, 1}, /* 2458529 - 14 February 2019 - 66%  */
-	{11, 1}, /* 2458530 - 15 February 2019 - 76%  */
-	{12, 1}, /* 2458531 - 16 February 2019 - 85%  */
-	{13, 1}, /* 2458532 - 17 February 2019 - 93%  */
-	{14, 1}, /* 2458533 - 18 February 2019 - 97%  */
-	{14, 1}, /* 2458534 - 19 February 2019 - 99%  */
-	{14, 0}, /* 2458535 - 20 February 2019 - 98%  */
-	{13, 0}, /* 2458536 - 21 February 2019 - 94%  */
-	{12, 0}, /* 2458537 - 22 February 2019 - 88%  */
-	{11, 0}, /* 2458538 - 23 February 2019 - 80%  */
-	{10, 0}, /* 2458539 - 24 February 2019 - 70%  */
-	{8, 0}, /* 2458540 - 25 February 2019 - 60%  */
-	{7, 0}, /* 2458541 - 26 February 2019 - 50%  */
-	{6, 0}, /* 2458542 - 27 February 2019 - 40%  */
-	{4, 0}, /* 2458543 - 28 February 2019 - 30%  */
-	{3, 0}, /* 2458544 - 1 March 2019 - 22%  */
-	{2, 0}, /* 2458545 - 2 March 2019 - 14%  */
-	{1, 0}, /* 2458546 - 3 March 2019 - 8%  */
-	{1, 0}, /* 2458547 - 4 March 2019 - 4%  */
-	{0, 0}, /* 2458548 - 5 March 2019 - 1%  */
-	{0, 0}, /* 2458549 - 6 March 2019 - 0%  */
-	{0, 1}, /* 2458550 - 7 March 2019 - 0%  */
-	{0, 1}, /* 2458551 - 8 March 2019 - 3%  */
-	{1, 1}, /* 2458552 - 9 March 2019 - 7%  */
-	{2, 1}, /* 2458553 - 10 March 2019 - 13%  */
-	{3, 1}, /* 2458554 - 11 March 2019 - 20%  */
-	{4, 1}, /* 2458555 - 12 March 2019 - 29%  */
-	{6, 1}, /* 2458556 - 13 March 2019 - 39%  */
-	{7, 1}, /* 2458557 - 14 March 2019 - 50%  */
-	{9, 1}, /* 2458558 - 15 March 2019 - 61%  */
-	{10, 1}, /* 2458559 - 16 March 2019 - 72%  */
-	{12, 1}, /* 2458560 - 17 March 2019 - 82%  */
-	{13, 1}, /* 2458561 - 18 March 2019 - 90%  */
-	{13, 1}, /* 2458562 - 19 March 2019 - 96%  */
-	{14, 1}, /* 2458563 - 20 March 2019 - 99%  */
-	{14, 1}, /* 2458564 - 21 March 2019 - 99%  */
-	{14, 0}, /* 2458565 - 22 March 2019 - 97%  */
-	{13, 0}, /* 2458566 - 23 March 2019 - 91%  */
-	{12, 0}, /* 2458567 - 24 March 2019 - 84%  */
-	{11, 0}, /* 2458568 - 25 March 2019 - 76%  */
-	{9, 0}, /* 2458569 - 26 March 2019 - 66%  */
-	{8, 0}, /* 2458570 - 27 March 2019 - 56%  */
-	{7, 0}, /* 2458571 - 28 March 2019 - 47%  */
-	{5, 0}, /* 2458572 - 29 March 2019 - 37%  */
-	{4, 0}, /* 2458573 - 30 March 2019 - 28%  */
-	{3, 0}, /* 2458574 - 31 March 2019 - 20%  */
-	{2, 0}, /* 2458575 - 1 April 2019 - 13%  */
-	{1, 0}, /* 2458576 - 2 April 2019 - 7%  */
-	{0, 0}, /* 2458577 - 3 April 2019 - 3%  */
-	{0, 0}, /* 2458578 - 4 April 2019 - 0%  */
-	{0, 0}, /* 2458579 - 5 April 2019 - 0%  */
-	{0, 1}, /* 2458580 - 6 April 2019 - 1%  */
-	{1, 1}, /* 2458581 - 7 April 2019 - 4%  */
-	{1, 1}, /* 2458582 - 8 April 2019 - 9%  */
-	{2, 1}, /* 2458583 - 9 April 2019 - 16%  */
-	{4, 1}, /* 2458584 - 10 April 2019 - 25%  */
-	{5, 1}, /* 2458585 - 11 April 2019 - 35%  */
-	{7, 1}, /* 2458586 - 12 April 2019 - 46%  */
-	{8, 1}, /* 2458587 - 13 April 2019 - 58%  */
-	{10, 1}, /* 2458588 - 14 April 2019 - 69%  */
-	{11, 1}, /* 2458589 - 15 April 2019 - 79%  */
-	{12, 1}, /* 2458590 - 16 April 2019 - 88%  */
-	{13, 1}, /* 2458591 - 17 April 2019 - 94%  */
-	{14, 1}, /* 2458592 - 18 April 2019 - 98%  */
-	{14, 1}, /* 2458593 - 19 April 2019 - 99%  */
-	{14, 0}, /* 2458594 - 20 April 2019 - 98%  */
-	{13, 0}, /* 2458595 - 21 April 2019 - 94%  */
-	{12, 0}, /* 2458596 - 22 April 2019 - 88%  */
-	{11, 0}, /* 2458597 - 23 April 2019 - 81%  */
-	{10, 0}, /* 2458598 - 24 April 2019 - 72%  */
-	{9, 0}, /* 2458599 - 25 April 2019 - 63%  */
-	{8, 0}, /* 2458600 - 26 April 2019 - 54%  */
-	{6, 0}, /* 2458601 - 27 April 2019 - 44%  */
-	{5, 0}, /* 2458602 - 28 April 2019 - 35%  */
-	{4, 0}, /* 2458603 - 29 April 2019 - 26%  */
-	{3, 0}, /* 2458604 - 30 April 2019 - 18%  */
-	{2, 0}, /* 2458605 - 1 May 2019 - 11%  */
-	{1, 0}, /* 2458606 - 2 May 2019 - 6%  */
-	{0, 0}, /* 2458607 - 3 May 2019 - 2%  */
-	{0, 0}, /* 2458608 - 4 May 2019 - 0%  */
-	{0, 1}, /* 2458609 - 5 May 2019 - 0%  */
-	{0, 1}, /* 2458610 - 6 May 2019 - 2%  */
-	{1, 1}, /* 2458611 - 7 May 2019 - 7%  */
-	{2, 1}, /* 2458612 - 8 May 2019 - 14%  */
-	{3, 1}, /* 2458613 - 9 May 2019 - 22%  */
-	{5, 1}, /* 2458614 - 10 May 2019 - 32%  */
-	{6, 1}, /* 2458615 - 11 May 2019 - 43%  */
-	{8, 1}, /* 2458616 - 12 May 2019 - 55%  */
-	{9, 1}, /* 2458617 - 13 May 2019 - 66%  */
-	{11, 1}, /* 2458618 - 14 May 2019 - 76%  */
-	{12, 1}, /* 2458619 - 15 May 2019 - 85%  */
-	{13, 1}, /* 2458620 - 16 May 2019 - 92%  */
-	{14, 1}, /* 2458621 - 17 May 2019 - 97%  */
-	{14, 1}, /* 2458622 - 18 May 2019 - 99%  */
-	{14, 0}, /* 2458623 - 19 May 2019 - 99%  */
-	{14, 0}, /* 2458624 - 20 May 2019 - 96%  */
-	{13, 0}, /* 2458625 - 21 May 2019 - 92%  */
-	{12, 0}, /* 2458626 - 22 May 2019 - 86%  */
-	{11, 0}, /* 2458627 - 23 May 2019 - 78%  */
-	{10, 0}, /* 2458628 - 24 May 2019 - 70%  */
-	{9, 0}, /* 2458629 - 25 May 2019 - 61%  */
-	{7, 0}, /* 2458630 - 26 May 2019 - 51%  */
-	{6, 0}, /* 2458631 - 27 May 2019 - 42%  */
-	{5, 0}, /* 2458632 - 28 May 2019 - 33%  */
-	{3, 0}, /* 2458633 - 29 May 2019 - 24%  */
-	{2, 0}, /* 2458634 - 30 May 2019 - 16%  */
-	{1, 0}, /* 2458635 - 31 May 2019 - 9%  */
-	{1, 0}, /* 2458636 - 1 June 2019 - 4%  */
-	{0, 0}, /* 2458637 - 2 June 2019 - 1%  */
-	{0, 0}, /* 2458638 - 3 June 2019 - 0%  */
-	{0, 1}, /* 2458639 - 4 June 2019 - 1%  */
-	{1, 1}, /* 2458640 - 5 June 2019 - 5%  */
-	{2, 1}, /* 2458641 - 6 June 2019 - 11%  */
-	{3, 1}, /* 2458642 - 7 June 2019 - 20%  */
-	{4, 1}, /* 2458643 - 8 June 2019 - 30%  */
-	{6, 1}, /* 2458644 - 9 June 2019 - 41%  */
-	{7, 1}, /* 2458645 - 10 June 2019 - 53%  */
-	{9, 1}, /* 2458646 - 11 June 2019 - 64%  */
-	{10, 1}, /* 2458647 - 12 June 2019 - 74%  */
-	{12, 1}, /* 2458648 - 13 June 2019 - 83%  */
-	{13, 1}, /* 2458649 - 14 June 2019 - 90%  */
-	{13, 1}, /* 2458650 - 15 June 2019 - 96%  */
-	{14, 1}, /* 2458651 - 16 June 2019 - 99%  */
-	{14, 1}, /* 2458652 - 17 June 2019 - 99%  */
-	{14, 0}, /* 2458653 - 18 June 2019 - 98%  */
-	{13, 0}, /* 2458654 - 19 June 2019 - 95%  */
-	{13, 0}, /* 2458655 - 20 June 2019 - 90%  */
-	{12, 0}, /* 2458656 - 21 June 2019 - 83%  */
-	{11, 0}, /* 2458657 - 22 June 2019 - 76%  */
-	{9, 0}, /* 2458658 - 23 June 2019 - 67%  */
-	{8, 0}, /* 2458659 - 24 June 2019 - 58%  */
-	{7, 0}, /* 2458660 - 25 June 2019 - 49%  */
-	{6, 0}, /* 2458661 - 26 June 2019 - 39%  */
-	{4, 0}, /* 2458662 - 27 June 2019 - 30%  */
-	{3, 0}, /* 2458663 - 28 June 2019 - 21%  */
-	{2, 0}, /* 2458664 - 29 June 2019 - 13%  */
-	{1, 0}, /* 2458665 - 30 June 2019 - 6%  */
-	{0, 0}, /* 2458666 - 1 July 2019 - 2%  */
-	{0, 0}, /* 2458667 - 2 July 2019 - 0%  */
-	{0, 1}, /* 2458668 - 3 July 2019 - 0%  */
-	{1, 1}, /* 2458669 - 4 July 2019 - 4%  */
-	{1, 1}, /* 2458670 - 5 July 2019 - 10%  */
-	{3, 1}, /* 2458671 - 6 July 2019 - 18%  */
-	{4, 1}, /* 2458672 - 7 July 2019 - 28%  */
-	{5, 1}, /* 2458673 - 8 July 2019 - 39%  */
-	{7, 1}, /* 2458674 - 9 July 2019 - 50%  */
-	{9, 1}, /* 2458675 - 10 July 2019 - 61%  */
-	{10, 1}, /* 2458676 - 11 July 2019 - 71%  */
-	{11, 1}, /* 2458677 - 12 July 2019 - 80%  */
-	{12, 1}, /* 2458678 - 13 July 2019 - 88%  */
-	{13, 1}, /* 2458679 - 14 July 2019 - 94%  */
-	{14, 1}, /* 2458680 - 15 July 2019 - 98%  */
-	{14, 1}, /* 2458681 - 16 July 2019 - 99%  */
-	{14, 0}, /* 2458682 - 17 July 2019 - 99%  */
-	{14, 0}, /* 2458683 - 18 July 2019 - 97%  */
-	{13, 0}, /* 2458684 - 19 July 2019 - 93%  */
-	{12, 0}, /* 2458685 - 20 July 2019 - 88%  */
-	{11, 0}, /* 2458686 - 21 July 2019 - 81%  */
-	{10, 0}, /* 2458687 - 22 July 2019 - 73%  */
-	{9, 0}, /* 2458688 - 23 July 2019 - 64%  */
-	{8, 0}, /* 2458689 - 24 July 2019 - 55%  */
-	{6, 0}, /* 2458690 - 25 July 2019 - 45%  */
-	{5, 0}, /* 2458691 - 26 July 2019 - 35%  */
-	{4, 0}, /* 2458692 - 27 July 2019 - 26%  */
-	{2, 0}, /* 2458693 - 28 July 2019 - 17%  */
-	{1, 0}, /* 2458694 - 29 July 2019 - 9%  */
-	{1, 0}, /* 2458695 - 30 July 2019 - 3%  */
-	{0, 0}, /* 2458696 - 31 July 2019 - 0%  */
-	{0, 0}, /* 2458697 - 1 August 2019 - 0%  */
-	{0, 1}, /* 2458698 - 2 August 2019 - 2%  */
-	{1, 1}, /* 2458699 - 3 August 2019 - 8%  */
-	{2, 1}, /* 2458700 - 4 August 2019 - 16%  */
-	{4, 1}, /* 2458701 - 5 August 2019 - 25%  */
-	{5, 1}, /* 2458702 - 6 August 2019 - 36%  */
-	{7, 1}, /* 2458703 - 7 August 2019 - 47%  */
-	{8, 1}, /* 2458704 - 8 August 2019 - 58%  */
-	{10, 1}, /* 2458705 - 9 August 2019 - 68%  */
-	{11, 1}, /* 2458706 - 10 August 2019 - 77%  */
-	{12, 1}, /* 2458707 - 11 August 2019 - 85%  */
-	{13, 1}, /* 2458708 - 12 August 2019 - 91%  */
-	{13, 1}, /* 2458709 - 13 August 2019 - 96%  */
-	{14, 1}, /* 2458710 - 14 August 2019 - 99%  */
-	{14, 1}, /* 2458711 - 15 August 2019 - 99%  */
-	{14, 0}, /* 2458712 - 16 August 2019 - 99%  */
-	{14, 0}, /* 2458713 - 17 August 2019 - 96%  */
-	{13, 0}, /* 2458714 - 18 August 2019 - 92%  */
-	{12, 0}, /* 2458715 - 19 August 2019 - 86%  */
-	{11, 0}, /* 2458716 - 20 August 2019 - 79%  */
-	{10, 0}, /* 2458717 - 21 August 2019 - 70%  */
-	{9, 0}, /* 2458718 - 22 August 2019 - 61%  */
-	{7, 0}, /* 2458719 - 23 August 2019 - 51%  */
-	{6, 0}, /* 2458720 - 24 August 2019 - 40%  */
-	{4, 0}, /* 2458721 - 25 August 2019 - 30%  */
-	{3, 0}, /* 2458722 - 26 August 2019 - 20%  */
-	{2, 0}, /* 2458723 - 27 August 2019 - 12%  */
-	{1, 0}, /* 2458724 - 28 August 2019 - 5%  */
-	{0, 0}, /* 2458725 - 29 August 2019 - 1%  */
-	{0, 0}, /* 2458726 - 30 August 2019 - 0%  */
-	{0, 1}, /* 2458727 - 31 August 2019 - 1%  */
-	{1, 1}, /* 2458728 - 1 September 2019 - 6%  */
-	{2, 1}, /* 2458729 - 2 September 2019 - 13%  */
-	{3, 1}, /* 2458730 - 3 September 2019 - 22%  */
-	{5, 1}, /* 2458731 - 4 September 2019 - 32%  */
-	{6, 1}, /* 2458732 - 5 September 2019 - 43%  */
-	{8, 1}, /* 2458733 - 6 September 2019 - 53%  */
-	{9, 1}, /* 2458734 - 7 September 2019 - 63%  */
-	{10, 1}, /* 2458735 - 8 September 2019 - 73%  */
-	{11, 1}, /* 2458736 - 9 September 2019 - 81%  */
-	{12, 1}, /* 2458737 - 10 September 2019 - 88%  */
-	{13, 1}, /* 2458738 - 11 September 2019 - 93%  */
-	{14, 1}, /* 2458739 - 12 September 2019 - 97%  */
-	{14, 1}, /* 2458740 - 13 September 2019 - 99%  */
-	{14, 1}, /* 2458741 - 14 September 2019 - 99%  */
-	{14, 0}, /* 2458742 - 15 September 2019 - 98%  */
-	{13, 0}, /* 2458743 - 16 September 2019 - 95%  */
-	{13, 0}, /* 2458744 - 17 September 2019 - 90%  */
-	{12, 0}, /* 2458745 - 18 September 2019 - 83%  */
-	{11, 0}, /* 2458746 - 19 September 2019 - 75%  */
-	{9, 0}, /* 2458747 - 20 September 2019 - 66%  */
-	{8, 0}, /* 2458748 - 21 September 2019 - 56%  */
-	{6, 0}, /* 2458749 - 22 September 2019 - 45%  */
-	{5, 0}, /* 2458750 - 23 September 2019 - 35%  */
-	{3, 0}, /* 2458751 - 24 September 2019 - 24%  */
-	{2, 0}, /* 2458752 - 25 September 2019 - 15%  */
-	{1, 0}, /* 2458753 - 26 September 2019 - 7%  */
-	{0, 0}, /* 2458754 - 27 September 2019 - 2%  */
-	{0, 0}, /* 2458755 - 28 September 2019 - 0%  */
-	{0, 1}, /* 2458756 - 29 September 2019 - 0%  */
-	{1, 1}, /* 2458757 - 30 September 2019 - 4%  */
-	{1, 1}, /* 2458758 - 1 October 2019 - 10%  */
-	{3, 1}, /* 2458759 - 2 October 2019 - 18%  */
-	{4, 1}, /* 2458760 - 3 October 2019 - 27%  */
-	{5, 1}, /* 2458761 - 4 October 2019 - 37%  */
-	{7, 1}, /* 2458762 - 5 October 2019 - 47%  */
-	{8, 1}, /* 2458763 - 6 October 2019 - 57%  */
-	{9, 1}, /* 2458764 - 7 October 2019 - 67%  */
-	{11, 1}, /* 2458765 - 8 October 2019 - 75%  */
-	{12, 1}, /* 2458766 - 9 October 2019 - 83%  */
-	{13, 1}, /* 2458767 - 10 October 2019 - 89%  */
-	{13, 1}, /* 2458768 - 11 October 2019 - 94%  */
-	{14, 1}, /* 2458769 - 12 October 2019 - 98%  */
-	{14, 1}, /* 2458770 - 13 October 2019 - 99%  */
-	{14, 0}, /* 2458771 - 14 October 2019 - 99%  */
-	{14, 0}, /* 2458772 - 15 October 2019 - 97%  */
-	{13, 0}, /* 2458773 - 16 October 2019 - 93%  */
-	{12, 0}, /* 2458774 - 17 October 2019 - 87%  */
-	{11, 0}, /* 2458775 - 18 October 2019 - 80%  */
-	{10, 0}, /* 2458776 - 19 October 2019 - 71%  */
-	{9, 0}, /* 2458777 - 20 October 2019 - 61%  */
-	{7, 0}, /* 2458778 - 21 October 2019 - 50%  */
-	{5, 0}, /* 2458779 - 22 October 2019 - 39%  */
-	{4, 0}, /* 2458780 - 23 October 2019 - 28%  */
-	{3, 0}, /* 2458781 - 24 October 2019 - 18%  */
-	{1, 0}, /* 2458782 - 25 October 2019 - 10%  */
-	{1, 0}, /* 2458783 - 26 October 2019 - 3%  */
-	{0, 0}, /* 2458784 - 27 October 2019 - 0%  */
-	{0, 0}, /* 2458785 - 28 October 2019 - 0%  */
-	{0, 1}, /* 2458786 - 29 October 2019 - 2%  */
-	{1, 1}, /* 2458787 - 30 October 2019 - 7%  */
-	{2, 1}, /* 2458788 - 31 October 2019 - 14%  */
-	{3, 1}, /* 2458789 - 1 November 2019 - 22%  */
-	{4, 1}, /* 2458790 - 2 November 2019 - 31%  */
-	{6, 1}, /* 2458791 - 3 November 2019 - 40%  */
-	{7, 1}, /* 2458792 - 4 November 2019 - 50%  */
-	{8, 1}, /* 2458793 - 5 November 2019 - 60%  */
-	{10, 1}, /* 2458794 - 6 November 2019 - 69%  */
-	{11, 1}, /* 2458795 - 7 November 2019 - 77%  */
-	{12, 1}, /* 2458796 - 8 November 2019 - 84%  */
-	{13, 1}, /* 2458797 - 9 November 2019 - 91%  */
-	{13, 1}, /* 2458798 - 10 November 2019 - 95%  */
-	{14, 1}, /* 2458799 - 11 November 2019 - 98%  */
-	{14, 1}, /* 2458800 - 12 November 2019 - 99%  */
-	{14, 0}, /* 2458801 - 13 November 2019 - 99%  */
-	{13, 0}, /* 2458802 - 14 November 2019 - 96%  */
-	{13, 0}, /* 2458803 - 15 November 2019 - 91%  */
-	{12, 0}, /* 2458804 - 16 November 2019 - 84%  */
-	{11, 0}, /* 2458805 - 17 November 2019 - 75%  */
-	{9, 0}, /* 2458806 - 18 November 2019 - 65%  */
-	{8, 0}, /* 2458807 - 19 November 2019 - 54%  */
-	{6, 0}, /* 2458808 - 20 November 2019 - 42%  */
-	{4, 0}, /* 2458809 - 21 November 2019 - 31%  */
-	{3, 0}, /* 2458810 - 22 November 2019 - 21%  */
-	{2, 0}, /* 2458811 - 23 November 2019 - 12%  */
-	{1, 0}, /* 2458812 - 24 November 2019 - 6%  */
-	{0, 0}, /* 2458813 - 25 November 2019 - 1%  */
-	{0, 0}, /* 2458814 - 26 November 2019 - 0%  */
-	{0, 1}, /* 2458815 - 27 November 2019 - 0%  */
-	{1, 1}, /* 2458816 - 28 November 2019 - 4%  */
-	{1, 1}, /* 2458817 - 29 November 2019 - 9%  */
-	{2, 1}, /* 2458818 - 30 November 2019 - 16%  */
-	{3, 1}, /* 2458819 - 1 December 2019 - 24%  */
-	{5, 1}, /* 2458820 - 2 December 2019 - 33%  */
-	{6, 1}, /* 2458821 - 3 December 2019 - 42%  */
-	{7, 1}, /* 2458822 - 4 December 2019 - 51%  */
-	{9, 1}, /* 2458823 - 5 December 2019 - 61%  */
-	{10, 1}, /* 2458824 - 6 December 2019 - 70%  */
-	{11, 1}, /* 2458825 - 7 December 2019 - 78%  */
-	{12, 1}, /* 2458826 - 8 December 2019 - 85%  */
-	{13, 1}, /* 2458827 - 9 December 2019 - 92%  */
-	{14, 1}, /* 2458828 - 10 December 2019 - 96%  */
-	{14, 1}, /* 2458829 - 11 December 2019 - 99%  */
-	{14, 1}, /* 2458830 - 12 December 2019 - 99%  */
-	{14, 0}, /* 2458831 - 13 December 2019 - 98%  */
-	{13, 0}, /* 2458832 - 14 December 2019 - 93%  */
-	{12, 0}, /* 2458833 - 15 December 2019 - 87%  */
-	{11, 0}, /* 2458834 - 16 December 2019 - 79%  */
-	{10, 0}, /* 2458835 - 17 December 2019 - 69%  */
-	{8, 0}, /* 2458836 - 18 December 2019 - 58%  */
-	{7, 0}, /* 2458837 - 19 December 2019 - 46%  */
-	{5, 0}, /* 2458838 - 20 December 2019 - 35%  */
-	{4, 0}, /* 2458839 - 21 December 2019 - 25%  */
-	{2, 0}, /* 2458840 - 22 December 2019 - 15%  */
-	{1, 0}, /* 2458841 - 23 December 2019 - 8%  */
-	{0, 0}, /* 2458842 - 24 December 2019 - 3%  */
-	{0, 0}, /* 2458843 - 25 December 2019 - 0%  */
-	{0, 0}, /* 2458844 - 26 December 2019 - 0%  */
-	{0, 1}, /* 2458845 - 27 December 2019 - 1%  */
-	{1, 1}, /* 2458846 - 28 December 2019 - 5%  */
-	{2, 1}, /* 2458847 - 29 December 2019 - 10%  */
-	{2, 1}, /* 2458848 - 30 December 2019 - 17%  */
-	{4, 1}, /* 2458849 - 31 December 2019 - 25%  */
-	{5, 1}, /* 2458850 - 1 January 2020 - 34%  */
-	{6, 1}, /* 2458851 - 2 January 2020 - 43%  */
-	{7, 1}, /* 2458852 - 3 January 2020 - 52%  */
-	{9, 1}, /* 2458853 - 4 January 2020 - 62%  */
-	{10, 1}, /* 2458854 - 5 January 2020 - 71%  */
-	{11, 1}, /* 2458855 - 6 January 2020 - 79%  */
-	{12, 1}, /* 2458856 - 7 January 2020 - 87%  */
-	{13, 1}, /* 2458857 - 8 January 2020 - 93%  */
-	{14, 1}, /* 2458858 - 9 January 2020 - 97%  */
-	{14, 1}, /* 2458859 - 10 January 2020 - 99%  */
-	{14, 0}, /* 2458860 - 11 January 2020 - 99%  */
-	{13, 0}, /* 2458861 - 12 January 2020 - 96%  */
-	{13, 0}, /* 2458862 - 13 January 2020 - 90%  */
-	{12, 0}, /* 2458863 - 14 January 2020 - 82%  */
-	{10, 0}, /* 2458864 - 15 January 2020 - 72%  */
-	{9, 0}, /* 2458865 - 16 January 2020 - 61%  */
-	{7, 0}, /* 2458866 - 17 January 2020 - 50%  */
-	{6, 0}, /* 2458867 - 18 January 2020 - 39%  */
-	{4, 0}, /* 2458868 - 19 January 2020 - 28%  */
-	{3, 0}, /* 2458869 - 20 January 2020 - 19%  */
-	{2, 0}, /* 2458870 - 21 January 2020 - 11%  */
-	{1, 0}, /* 2458871 - 22 January 2020 - 5%  */
-	{0, 0}, /* 2458872 - 23 January 2020 - 1%  */
-	{0, 0}, /* 2458873 - 24 January 2020 - 0%  */
-	{0, 1}, /* 2458874 - 25 January 2020 - 0%  */
-	{0, 1}, /* 2458875 - 26 January 2020 - 2%  */
-	{1, 1}, /* 2458876 - 27 January 2020 - 6%  */
-	{2, 1}, /* 2458877 - 28 January 2020 - 11%  */
-	{3, 1}, /* 2458878 - 29 January 2020 - 18%  */
-	{4, 1}, /* 2458879 - 30 January 2020 - 26%  */
-	{5, 1}, /* 2458880 - 31 January 2020 - 35%  */
-	{6, 1}, /* 2458881 - 1 February 2020 - 44%  */
-	{8, 1}, /* 2458882 - 2 February 2020 - 54%  */
-	{9, 1}, /* 2458883 - 3 February 2020 - 63%  */
-	{10, 1}, /* 2458884 - 4 February 2020 - 73%  */
-	{11, 1}, /* 2458885 - 5 February 2020 - 82%  */
-	{13, 1}, /* 2458886 - 6 February 2020 - 89%  */
-	{13, 1}, /* 2458887 - 7 February 2020 - 95%  */
-	{14, 1}, /* 2458888 - 8 February 2020 - 99%  */
-	{14, 1}, /* 2458889 - 9 February 2020 - 99%  */
-	{14, 0}, /* 2458890 - 10 February 2020 - 97%  */
-	{13, 0}, /* 2458891 - 11 February 2020 - 93%  */
-	{12, 0}, /* 2458892 - 12 February 2020 - 85%  */
-	{11, 0}, /* 2458893 - 13 February 2020 - 76%  */
-	{9, 0}, /* 2458894 - 14 February 2020 - 66%  */
-	{8, 0}, /* 2458895 - 15 February 2020 - 55%  */
-	{6, 0}, /* 2458896 - 16 February 2020 - 43%  */
-	{5, 0}, /* 2458897 - 17 February 2020 - 33%  */
-	{3, 0}, /* 2458898 - 18 February 2020 - 24%  */
-	{2, 0}, /* 2458899 - 19 February 2020 - 15%  */
-	{1, 0}, /* 2458900 - 20 February 2020 - 9%  */
-	{1, 0}, /* 2458901 - 21 February 2020 - 4%  */
-	{0, 0}, /* 2458902 - 22 February 2020 - 1%  */
-	{0, 0}, /* 2458903 - 23 February 2020 - 0%  */
-	{0, 1}, /* 2458904 - 24 February 2020 - 0%  */
-	{0, 1}, /* 2458905 - 25 February 2020 - 3%  */
-	{1, 1}, /* 2458906 - 26 February 2020 - 7%  */
-	{2, 1}, /* 2458907 - 27 February 2020 - 12%  */
-	{3, 1}, /* 2458908 - 28 February 2020 - 19%  */
-	{4, 1}, /* 2458909 - 29 February 2020 - 27%  */
-	{5, 1}, /* 2458910 - 1 March 2020 - 37%  */
-	{7, 1}, /* 2458911 - 2 March 2020 - 46%  */
-	{8, 1}, /* 2458912 - 3 March 2020 - 56%  */
-	{9, 1}, /* 2458913 - 4 March 2020 - 66%  */
-	{11, 1}, /* 2458914 - 5 March 2020 - 76%  */
-	{12, 1}, /* 2458915 - 6 March 2020 - 85%  */
-	{13, 1}, /* 2458916 - 7 March 2020 - 92%  */
-	{14, 1}, /* 2458917 - 8 March 2020 - 97%  */
-	{14, 1}, /* 2458918 - 9 March 2020 - 99%  */
-	{14, 0}, /* 2458919 - 10 March 2020 - 99%  */
-	{13, 0}, /* 2458920 - 11 March 2020 - 95%  */
-	{12, 0}, /* 2458921 - 12 March 2020 - 88%  */
-	{11, 0}, /* 2458922 - 13 March 2020 - 80%  */
-	{10, 0}, /* 2458923 - 14 March 2020 - 70%  */
-	{8, 0}, /* 2458924 - 15 March 2020 - 59%  */
-	{7, 0}, /* 2458925 - 16 March 2020 - 49%  */
-	{5, 0}, /* 2458926 - 17 March 2020 - 38%  */
-	{4, 0}, /* 2458927 - 18 March 2020 - 29%  */
-	{3, 0}, /* 2458928 - 19 March 2020 - 20%  */
-	{2, 0}, /* 2458929 - 20 March 2020 - 13%  */
-	{1, 0}, /* 2458930 - 21 March 2020 - 7%  */
-	{0, 0}, /* 2458931 - 22 March 2020 - 3%  */
-	{0, 0}, /* 2458932 - 23 March 2020 - 0%  */
-	{0, 0}, /* 2458933 - 24 March 2020 - 0%  */
-	{0, 1}, /* 2458934 - 25 March 2020 - 1%  */
-	{1, 1}, /* 2458935 - 26 March 2020 - 3%  */
-	{1, 1}, /* 2458936 - 27 March 2020 - 8%  */
-	{2, 1}, /* 2458937 - 28 March 2020 - 14%  */
-	{3, 1}, /* 2458938 - 29 March 2020 - 22%  */
-	{4, 1}, /* 2458939 - 30 March 2020 - 30%  */
-	{6, 1}, /* 2458940 - 31 March 2020 - 40%  */
-	{7, 1}, /* 2458941 - 1 April 2020 - 50%  */
-	{9, 1}, /* 2458942 - 2 April 2020 - 61%  */
-	{10, 1}, /* 2458943 - 3 April 2020 - 71%  */
-	{11, 1}, /* 2458944 - 4 April 2020 - 81%  */
-	{13, 1}, /* 2458945 - 5 April 2020 - 89%  */
-	{13, 1}, /* 2458946 - 6 April 2020 - 96%  */
-	{14, 1}, /* 2458947 - 7 April 2020 - 99%  */
-	{14, 1}, /* 2458948 - 8 April 2020 - 99%  */
-	{14, 0}, /* 2458949 - 9 April 2020 - 97%  */
-	{13, 0}, /* 2458950 - 10 April 2020 - 91%  */
-	{12, 0}, /* 2458951 - 11 April 2020 - 84%  */
-	{11, 0}, /* 2458952 - 12 April 2020 - 75%  */
-	{9, 0}, /* 2458953 - 13 April 2020 - 65%  */
-	{8, 0}, /* 2458954 - 14 April 2020 - 54%  */
-	{6, 0}, /* 2458955 - 15 April 2020 - 44%  */
-	{5, 0}, /* 2458956 - 16 April 2020 - 34%  */
-	{4, 0}, /* 2458957 - 17 April 2020 - 25%  */
-	{3, 0}, /* 2458958 - 18 April 2020 - 18%  */
-	{2, 0}, /* 2458959 - 19 April 2020 - 11%  */
-	{1, 0}, /* 2458960 - 20 April 2020 - 6%  */
-	{0, 0}, /* 2458961 - 21 April 2020 - 2%  */
-	{0, 0}, /* 2458962 - 22 April 2020 - 0%  */
-	{0, 0}, /* 2458963 - 23 April 2020 - 0%  */
-	{0, 1}, /* 2458964 - 24 April 2020 - 1%  */
-	{1, 1}, /* 2458965 - 25 April 2020 - 5%  */
-	{1, 1}, /* 2458966 - 26 April 2020 - 10%  */
-	{2, 1}, /* 2458967 - 27 April 2020 - 17%  */
-	{4, 1}, /* 2458968 - 28 April 2020 - 26%  */
-	{5, 1}, /* 2458969 - 29 April 2020 - 35%  */
-	{6, 1}, /* 2458970 - 30 April 2020 - 46%  */
-	{8, 1}, /* 2458971 - 1 May 2020 - 57%  */
-	{10, 1}, /* 2458972 - 2 May 2020 - 68%  */
-	{11, 1}, /* 2458973 - 3 May 2020 - 78%  */
-	{12, 1}, /* 2458974 - 4 May 2020 - 87%  */
-	{13, 1}, /* 2458975 - 5 May 2020 - 94%  */
-	{14, 1}, /* 2458976 - 6 May 2020 - 98%  */
-	{14, 1}, /* 2458977 - 7 May 2020 - 99%  */
-	{14, 0}, /* 2458978 - 8 May 2020 - 98%  */
-	{13, 0}, /* 2458979 - 9 May 2020 - 94%  */
-	{12, 0}, /* 2458980 - 10 May 2020 - 87%  */
-	{11, 0}, /* 2458981 - 11 May 2020 - 79%  */
-	{10, 0}, /* 2458982 - 12 May 2020 - 70%  */
-	{9, 0}, /* 2458983 - 13 May 2020 - 60%  */
-	{7, 0}, /* 2458984 - 14 May 2020 - 50%  */
-	{6, 0}, /* 2458985 - 15 May 2020 - 41%  */
-	{4, 0}, /* 2458986 - 16 May 2020 - 31%  */
-	{3, 0}, /* 2458987 - 17 May 2020 - 23%  */
-	{2, 0}, /* 2458988 - 18 May 2020 - 15%  */
-	{1, 0}, /* 2458989 - 19 May 2020 - 9%  */
-	{1, 0}, /* 2458990 - 20 May 2020 - 4%  */
-	{0, 0}, /* 2458991 - 21 May 2020 - 1%  */
-	{0, 0}, /* 2458992 - 22 May 2020 - 0%  */
-	{0, 1}, /* 2458993 - 23 May 2020 - 0%  */
-	{0, 1}, /* 2458994 - 24 May 2020 - 3%  */
-	{1, 1}, /* 2458995 - 25 May 2020 - 7%  */
-	{2, 1}, /* 2458996 - 26 May 2020 - 14%  */
-	{3, 1}, /* 2458997 - 27 May 2020 - 22%  */
-	{5, 1}, /* 2458998 - 28 May 2020 - 32%  */
-	{6, 1}, /* 2458999 - 29 May 2020 - 42%  */
-	{8, 1}, /* 2459000 - 30 May 2020 - 54%  */
-	{9, 1}, /* 2459001 - 31 May 2020 - 65%  */
-	{11, 1}, /* 2459002 - 1 June 2020 - 75%  */
-	{12, 1}, /* 2459003 - 2 June 2020 - 85%  */
-	{13, 1}, /* 2459004 - 3 June 2020 - 92%  */
-	{14, 1}, /* 2459005 - 4 June 2020 - 97%  */
-	{14, 1}, /* 2459006 - 5 June 2020 - 99%  */
-	{14, 0}, /* 2459007 - 6 June 2020 - 99%  */
-	{13, 0}, /* 2459008 - 7 June 2020 - 96%  */
-	{13, 0}, /* 2459009 - 8 June 2020 - 91%  */
-	{12, 0}, /* 2459010 - 9 June 2020 - 84%  */
-	{11, 0}, /* 2459011 - 10 June 2020 - 75%  */
-	{9, 0}, /* 2459012 - 11 June 2020 - 66%  */
-	{8, 0}, /* 2459013 - 12 June 2020 - 57%  */
-	{7, 0}, /* 2459014 - 13 June 2020 - 47%  */
-	{5, 0}, /* 2459015 - 14 June 2020 - 38%  */
-	{4, 0}, /* 2459016 - 15 June 2020 - 29%  */
-	{3, 0}, /* 2459017 - 16 June 2020 - 21%  */
-	{2, 0}, /* 2459018 - 17 June 2020 - 13%  */
-	{1, 0}, /* 2459019 - 18 June 2020 - 7%  */
-	{0, 0}, /* 2459020 - 19 June 2020 - 3%  */
-	{0, 0}, /* 2459021 - 20 June 2020 - 0%  */
-	{0, 0}, /* 2459022 - 21 June 2020 - 0%  */
-	{0, 1}, /* 2459023 - 22 June 2020 - 1%  */
-	{1, 1}, /* 2459024 - 23 June 2020 - 5%  */
-	{2, 1}, /* 2459025 - 24 June 2020 - 11%  */
-	{3, 1}, /* 2459026 - 25 June 2020 - 19%  */
-	{4, 1}, /* 2459027 - 26 June 2020 - 29%  */
-	{6, 1}, /* 2459028 - 27 June 2020 - 40%  */
-	{7, 1}, /* 2459029 - 28 June 2020 - 51%  */
-	{9, 1}, /* 2459030 - 29 June 2020 - 63%  */
-	{10, 1}, /* 2459031 - 30 June 2020 - 73%  */
-	{12, 1}, /* 2459032 - 1 July 2020 - 83%  */
-	{13, 1}, /* 2459033 - 2 July 2020 - 90%  */
-	{13, 1}, /* 2459034 - 3 July 2020 - 96%  */
-	{14, 1}, /* 2459035 - 4 July 2020 - 99%  */
-	{14, 1}, /* 2459036 - 5 July 2020 - 99%  */
-	{14, 0}, /* 2459037 - 6 July 2020 - 97%  */
-	{13, 0}, /* 2459038 - 7 July 2020 - 93%  */
-	{12, 0}, /* 2459039 - 8 July 2020 - 88%  */
-	{11, 0}, /* 2459040 - 9 July 2020 - 81%  */
-	{10, 0}, /* 2459041 - 10 July 2020 - 72%  */
-	{9, 0}, /* 2459042 - 11 July 2020 - 63%  */
-	{8, 0}, /* 2459043 - 12 July 2020 - 54%  */
-	{6, 0}, /* 2459044 - 13 July 2020 - 45%  */
-	{5, 0}, /* 2459045 - 14 July 2020 - 35%  */
-	{4, 0}, /* 2459046 - 15 July 2020 - 26%  */
-	{3, 0}, /* 2459047 - 16 July 2020 - 18%  */
-	{2, 0}, /* 2459048 - 17 July 2020 - 11%  */
-	{1, 0}, /* 2459049 - 18 July 2020 - 5%  */
-	{0, 0}, /* 2459050 - 19 July 2020 - 1%  */
-	{0, 0}, /* 2459051 - 20 July 2020 - 0%  */
-	{0, 1}, /* 2459052 - 21 July 2020 - 0%  */
-	{1, 1}, /* 2459053 - 22 July 2020 - 4%  */
-	{1, 1}, /* 2459054 - 23 July 2020 - 9%  */
-	{2, 1}, /* 2459055 - 24 July 2020 - 17%  */
-	{4, 1}, /* 2459056 - 25 July 2020 - 27%  */
-	{5, 1}, /* 2459057 - 26 July 2020 - 38%  */
-	{7, 1}, /* 2459058 - 27 July 2020 - 49%  */
-	{9, 1}, /* 2459059 - 28 July 2020 - 60%  */
-	{10, 1}, /* 2459060 - 29 July 2020 - 71%  */
-	{11, 1}, /* 2459061 - 30 July 2020 - 81%  */
-	{12, 1}, /* 2459062 - 31 July 2020 - 88%  */
-	{13, 1}, /* 2459063 - 1 August 2020 - 94%  */
-	{14, 1}, /* 2459064 - 2 August 2020 - 98%  */
-	{14, 1}, /* 2459065 - 3 August 2020 - 99%  */
-	{14, 0}, /* 2459066 - 4 August 2020 - 99%  */
-	{14, 0}, /* 2459067 - 5 August 2020 - 96%  */
-	{13, 0}, /* 2459068 - 6 August 2020 - 91%  */
-	{12, 0}, /* 2459069 - 7 August 2020 - 85%  */
-	{11, 0}, /* 2459070 - 8 August 2020 - 78%  */
-	{10, 0}, /* 2459071 - 9 August 2020 - 70%  */
-	{9, 0}, /* 2459072 - 10 August 2020 - 61%  */
-	{7, 0}, /* 2459073 - 11 August 2020 - 51%  */
-	{6, 0}, /* 2459074 - 12 August 2020 - 42%  */
-	{5, 0}, /* 2459075 - 13 August 2020 - 32%  */
-	{3, 0}, /* 2459076 - 14 August 2020 - 23%  */
-	{2, 0}, /* 2459077 - 15 August 2020 - 15%  */
-	{1, 0}, /* 2459078 - 16 August 2020 - 8%  */
-	{0, 0}, /* 2459079 - 17 August 2020 - 3%  */
-	{0, 0}, /* 2459080 - 18 August 2020 - 0%  */
-	{0, 0}, /* 2459081 - 19 August 2020 - 0%  */
-	{0, 1}, /* 2459082 - 20 August 2020 - 2%  */
-	{1, 1}, /* 2459083 - 21 August 2020 - 8%  */
-	{2, 1}, /* 2459084 - 22 August 2020 - 15%  */
-	{4, 1}, /* 2459085 - 23 August 2020 - 25%  */
-	{5, 1}, /* 2459086 - 24 August 2020 - 35%  */
-	{7, 1}, /* 2459087 - 25 August 2020 - 47%  */
-	{8, 1}, /* 2459088 - 26 August 2020 - 58%  */
-	{10, 1}, /* 2459089 - 27 August 2020 - 68%  */
-	{11, 1}, /* 2459090 - 28 August 2020 - 78%  */
-	{12, 1}, /* 2459091 - 29 August 2020 - 86%  */
-	{13, 1}, /* 2459092 - 30 August 2020 - 92%  */
-	{14, 1}, /* 2459093 - 31 August 2020 - 97%  */
-	{14, 1}, /* 2459094 - 1 September 2020 - 99%  */
-	{14, 1}, /* 2459095 - 2 September 2020 - 99%  */
-	{14, 0}, /* 2459096 - 3 September 2020 - 98%  */
-	{13, 0}, /* 2459097 - 4 September 2020 - 95%  */
-	{13, 0}, /* 2459098 - 5 September 2020 - 90%  */
-	{12, 0}, /* 2459099 - 6 September 2020 - 83%  */
-	{11, 0}, /* 2459100 - 7 September 2020 - 76%  */
-	{10, 0}, /* 2459101 - 8 September 2020 - 67%  */
-	{8, 0}, /* 2459102 - 9 September 2020 - 58%  */
-	{7, 0}, /* 2459103 - 10 September 2020 - 48%  */
-	{5, 0}, /* 2459104 - 11 September 2020 - 38%  */
-	{4, 0}, /* 2459105 - 12 September 2020 - 29%  */
-	{3, 0}, /* 2459106 - 13 September 2020 - 19%  */
-	{2, 0}, /* 2459107 - 14 September 2020 - 11%  */
-	{1, 0}, /* 2459108 - 15 September 2020 - 5%  */
-	{0, 0}, /* 2459109 - 16 September 2020 - 1%  */
-	{0, 0}, /* 2459110 - 17 September 2020 - 0%  */
-	{0, 1}, /* 2459111 - 18 September 2020 - 1%  */
-	{1, 1}, /* 2459112 - 19 September 2020 - 6%  */
-	{2, 1}, /* 2459113 - 20 September 2020 - 13%  */
-	{3, 1}, /* 2459114 - 21 September 2020 - 22%  */
-	{5, 1}, /* 2459115 - 22 September 2020 - 32%  */
-	{6, 1}, /* 2459116 - 23 September 2020 - 43%  */
-	{8, 1}, /* 2459117 - 24 September 2020 - 54%  */
-	{9, 1}, /* 2459118 - 25 September 2020 - 64%  */
-	{10, 1}, /* 2459119 - 26 September 2020 - 74%  */
-	{12, 1}, /* 2459120 - 27 September 2020 - 82%  */
-	{13, 1}, /* 2459121 - 28 September 2020 - 89%  */
-	{13, 1}, /* 2459122 - 29 September 2020 - 94%  */
-	{14, 1}, /* 2459123 - 30 September 2020 - 98%  */
-	{14, 1}, /* 2459124 - 1 October 2020 - 99%  */
-	{14, 0}, /* 2459125 - 2 October 2020 - 99%  */
-	{14, 0}, /* 2459126 - 3 October 2020 - 97%  */
-	{13, 0}, /* 2459127 - 4 October 2020 - 93%  */
-	{12, 0}, /* 2459128 - 5 October 2020 - 88%  */
-	{11, 0}, /* 2459129 - 6 October 2020 - 81%  */
-	{10, 0}, /* 2459130 - 7 October 2020 - 73%  */
-	{9, 0}, /* 2459131 - 8 October 2020 - 65%  */
-	{8, 0}, /* 2459132 - 9 October 2020 - 55%  */
-	{6, 0}, /* 2459133 - 10 October 2020 - 44%  */
-	{5, 0}, /* 2459134 - 11 October 2020 - 34%  */
-	{3, 0}, /* 2459135 - 12 October 2020 - 24%  */
-	{2, 0}, /* 2459136 - 13 October 2020 - 15%  */
-	{1, 0}, /* 2459137 - 14 October 2020 - 7%  */
-	{0, 0}, /* 2459138 - 15 October 2020 - 2%  */
-	{0, 0}, /* 2459139 - 16 October 2020 - 0%  */
-	{0, 1}, /* 2459140 - 17 October 2020 - 0%  */
-	{1, 1}, /* 2459141 - 18 October 2020 - 4%  */
-	{1, 1}, /* 2459142 - 19 October 2020 - 10%  */
-	{3, 1}, /* 2459143 - 20 October 2020 - 18%  */
-	{4, 1}, /* 2459144 - 21 October 2020 - 28%  */
-	{5, 1}, /* 2459145 - 22 October 2020 - 38%  */
-	{7, 1}, /* 2459146 - 23 October 2020 - 49%  */
-	{8, 1}, /* 2459147 - 24 October 2020 - 59%  */
-	{10, 1}, /* 2459148 - 25 October 2020 - 69%  */
-	{11, 1}, /* 2459149 - 26 October 2020 - 77%  */
-	{12, 1}, /* 2459150 - 27 October 2020 - 85%  */
-	{13, 1}, /* 2459151 - 28 October 2020 - 91%  */
-	{13, 1}, /* 2459152 - 29 October 2020 - 95%  */
-	{14, 1}, /* 2459153 - 30 October 2020 - 98%  */
-	{14, 1}, /* 2459154 - 31 October 2020 - 99%  */
-	{14, 0}, /* 2459155 - 1 November 2020 - 99%  */
-	{14, 0}, /* 2459156 - 2 November 2020 - 96%  */
-	{13, 0}, /* 2459157 - 3 November 2020 - 92%  */
-	{12, 0}, /* 2459158 - 4 November 2020 - 86%  */
-	{11, 0}, /* 2459159 - 5 November 2020 - 79%  */
-	{10, 0}, /* 2459160 - 6 November 2020 - 70%  */
-	{9, 0}, /* 2459161 - 7 November 2020 - 61%  */
-	{7, 0}, /* 2459162 - 8 November 2020 - 50%  */
-	{6, 0}, /* 2459163 - 9 November 2020 - 39%  */
-	{4, 0}, /* 2459164 - 10 November 2020 - 29%  */
-	{3, 0}, /* 2459165 - 11 November 2020 - 19%  */
-	{2, 0}, /* 2459166 - 12 November 2020 - 10%  */
-	{1, 0}, /* 2459167 - 13 November 2020 - 4%  */
-	{0, 0}, /* 2459168 - 14 November 2020 - 0%  */
-	{0, 0}, /* 2459169 - 15 November 2020 - 0%  */
-	{0, 1}, /* 2459170 - 16 November 2020 - 2%  */
-	{1, 1}, /* 2459171 - 17 November 2020 - 7%  */
-	{2, 1}, /* 2459172 - 18 November 2020 - 14%  */
-	{3, 1}, /* 2459173 - 19 November 2020 - 23%  */
-	{5, 1}, /* 2459174 - 20 November 2020 - 32%  */
-	{6, 1}, /* 2459175 - 21 November 2020 - 42%  */
-	{7, 1}, /* 2459176 - 22 November 2020 - 52%  */
-	{9, 1}, /* 2459177 - 23 November 2020 - 62%  */
-	{10, 1}, /* 2459178 - 24 November 2020 - 71%  */
-	{11, 1}, /* 2459179 - 25 November 2020 - 79%  */
-	{12, 1}, /* 2459180 - 26 November 2020 - 86%  */
-	{13, 1}, /* 2459181 - 27 November 2020 - 92%  */
-	{14, 1}, /* 2459182 - 28 November 2020 - 96%  */
-	{14, 1}, /* 2459183 - 29 November 2020 - 99%  */
-	{14, 1}, /* 2459184 - 30 November 2020 - 99%  */
-	{14, 0}, /* 2459185 - 1 December 2020 - 98%  */
-	{13, 0}, /* 2459186 - 2 December 2020 - 95%  */
-	{13, 0}, /* 2459187 - 3 December 2020 - 90%  */
-	{12, 0}, /* 2459188 - 4 December 2020 - 84%  */
-	{11, 0}, /* 2459189 - 5 December 2020 - 75%  */
-	{9, 0}, /* 2459190 - 6 December 2020 - 66%  */
-	{8, 0}, /* 2459191 - 7 December 2020 - 55%  */
-	{6, 0}, /* 2459192 - 8 December 2020 - 44%  */
-	{5, 0}, /* 2459193 - 9 December 2020 - 33%  */
-	{3, 0}, /* 2459194 - 10 December 2020 - 23%  */
-	{2, 0}, /* 2459195 - 11 December 2020 - 13%  */
-	{1, 0}, /* 2459196 - 12 December 2020 - 6%  */
-	{0, 0}, /* 2459197 - 13 December 2020 - 1%  */
-	{0, 0}, /* 2459198 - 14 December 2020 - 0%  */
-	{0, 1}, /* 2459199 - 15 December 2020 - 0%  */
-	{1, 1}, /* 2459200 - 16 December 2020 - 4%  */
-	{1, 1}, /* 2459201 - 17 December 2020 - 10%  */
-	{2, 1}, /* 2459202 - 18 December 2020 - 17%  */
-	{4, 1}, /* 2459203 - 19 December 2020 - 26%  */
-	{5, 1}, /* 2459204 - 20 December 2020 - 35%  */
-	{6, 1}, /* 2459205 - 21 December 2020 - 45%  */
-	{8, 1}, /* 2459206 - 22 December 2020 - 54%  */
-	{9, 1}, /* 2459207 - 23 December 2020 - 64%  */
-	{10, 1}, /* 2459208 - 24 December 2020 - 72%  */
-	{11, 1}, /* 2459209 - 25 December 2020 - 80%  */
-	{12, 1}, /* 2459210 - 26 December 2020 - 87%  */
-	{13, 1}, /* 2459211 - 27 December 2020 - 93%  */
-	{14, 1}, /* 2459212 - 28 December 2020 - 97%  */
-	{14, 1}, /* 2459213 - 29 December 2020 - 99%  */
-	{14, 1}, /* 2459214 - 30 December 2020 - 99%  */
-	{14, 0}, /* 2459215 - 31 December 2020 - 98%  */
-	{13, 0}, /* 2459216 - 1 January 2021 - 94%  */
-	{12, 0}, /* 2459217 - 2 January 2021 - 88%  */
-	{11, 0}, /* 2459218 - 3 January 2021 - 80%  */
-	{10, 0}, /* 2459219 - 4 January 2021 - 70%  */
-	{8, 0}, /* 2459220 - 5 January 2021 - 60%  */
-	{7, 0}, /* 2459221 - 6 January 2021 - 48%  */
-	{5, 0}, /* 2459222 - 7 January 2021 - 37%  */
-	{4, 0}, /* 2459223 - 8 January 2021 - 26%  */
-	{2, 0}, /* 2459224 - 9 January 2021 - 17%  */
-	{1, 0}, /* 2459225 - 10 January 2021 - 9%  */
-	{1, 0}, /* 2459226 - 11 January 2021 - 3%  */
-	{0, 0}, /* 2459227 - 12 January 2021 - 0%  */
-	{0, 0}, /* 2459228 - 13 January 2021 - 0%  */
-	{0, 1}, /* 2459229 - 14 January 2021 - 2%  */
-	{1, 1}, /* 2459230 - 15 January 2021 - 6%  */
-	{2, 1}, /* 2459231 - 16 January 2021 - 12%  */
-	{3, 1}, /* 2459232 - 17 January 2021 - 19%  */
-	{4, 1}, /* 2459233 - 18 January 2021 - 27%  */
-	{5, 1}, /* 2459234 - 19 January 2021 - 36%  */
-	{6, 1}, /* 2459235 - 20 January 2021 - 46%  */
-	{8, 1}, /* 2459236 - 21 January 2021 - 55%  */
-	{9, 1}, /* 2459237 - 22 January 2021 - 64%  */
-	{10, 1}, /* 2459238 - 23 January 2021 - 73%  */
-	{11, 1}, /* 2459239 - 24 January 2021 - 81%  */
-	{12, 1}, /* 2459240 - 25 January 2021 - 88%  */
-	{13, 1}, /* 2459241 - 26 January 2021 - 94%  */
-	{14, 1}, /* 2459242 - 27 January 2021 - 98%  */
-	{14, 1}, /* 2459243 - 28 January 2021 - 99%  */
-	{14, 0}, /* 2459244 - 29 January 2021 - 99%  */
-	{14, 0}, /* 2459245 - 30 January 2021 - 96%  */
-	{13, 0}, /* 2459246 - 31 January 2021 - 91%  */
-	{12, 0}, /* 2459247 - 1 February 2021 - 83%  */
-	{10, 0}, /* 2459248 - 2 February 2021 - 74%  */
-	{9, 0}, /* 2459249 - 3 February 2021 - 64%  */
-	{7, 0}, /* 2459250 - 4 February 2021 - 52%  */
-	{6, 0}, /* 2459251 - 5 February 2021 - 41%  */
-	{4, 0}, /* 2459252 - 6 February 2021 - 30%  */
-	{3, 0}, /* 2459253 - 7 February 2021 - 20%  */
-	{2, 0}, /* 2459254 - 8 February 2021 - 12%  */
-	{1, 0}, /* 2459255 - 9 February 2021 - 6%  */
-	{0, 0}, /* 2459256 - 10 February 2021 - 1%  */
-	{0, 0}, /* 2459257 - 11 February 2021 - 0%  */
-	{0, 1}, /* 2459258 - 12 February 2021 - 0%  */
-	{0, 1}, /* 2459259 - 13 February 2021 - 3%  */
-	{1, 1}, /* 2459260 - 14 February 2021 - 7%  */
-	{2, 1}, /* 2459261 - 15 February 2021 - 13%  */
-	{3, 1}, /* 2459262 - 16 February 2021 - 20%  */
-	{4, 1}, /* 2459263 - 17 February 2021 - 29%  */
-	{5, 1}, /* 2459264 - 18 February 2021 - 38%  */
-	{7, 1}, /* 2459265 - 19 February 2021 - 47%  */
-	{8, 1}, /* 2459266 - 20 February 2021 - 56%  */
-	{9, 1}, /* 2459267 - 21 February 2021 - 66%  */
-	{11, 1}, /* 2459268 - 22 February 2021 - 75%  */
-	{12, 1}, /* 2459269 - 23 February 2021 - 83%  */
-	{13, 1}, /* 2459270 - 24 February 2021 - 90%  */
-	{13, 1}, /* 2459271 - 25 February 2021 - 95%  */
-	{14, 1}, /* 2459272 - 26 February 2021 - 99%  */
-	{14, 1}, /* 2459273 - 27 February 2021 - 99%  */
-	{14, 0}, /* 2459274 - 28 February 2021 - 98%  */
-	{13, 0}, /* 2459275 - 1 March 2021 - 93%  */
-	{12, 0}, /* 2459276 - 2 March 2021 - 86%  */
-	{11, 0}, /* 2459277 - 3 March 2021 - 77%  */
-	{9, 0}, /* 2459278 - 4 March 2021 - 67%  */
-	{8, 0}, /* 2459279 - 5 March 2021 - 56%  */
-	{6, 0}, /* 2459280 - 6 March 2021 - 45%  */
-	{5, 0}, /* 2459281 - 7 March 2021 - 34%  */
-	{3, 0}, /* 2459282 - 8 March 2021 - 24%  */
-	{2, 0}, /* 2459283 - 9 March 2021 - 15%  */
-	{1, 0}, /* 2459284 - 10 March 2021 - 8%  */
-	{1, 0}, /* 2459285 - 11 March 2021 - 3%  */
-	{0, 0}, /* 2459286 - 12 March 2021 - 0%  */
-	{0, 0}, /* 2459287 - 13 March 2021 - 0%  */
-	{0, 1}, /* 2459288 - 14 March 2021 - 1%  */
-	{1, 1}, /* 2459289 - 15 March 2021 - 4%  */
-	{1, 1}, /* 2459290 - 16 March 2021 - 8%  */
-	{2, 1}, /* 2459291 - 17 March 2021 - 14%  */
-	{3, 1}, /* 2459292 - 18 March 2021 - 22%  */
-	{4, 1}, /* 2459293 - 19 March 2021 - 30%  */
-	{6, 1}, /* 2459294 - 20 March 2021 - 39%  */
-	{7, 1}, /* 2459295 - 21 March 2021 - 49%  */
-	{8, 1}, /* 2459296 - 22 March 2021 - 58%  */
-	{10, 1}, /* 2459297 - 23 March 2021 - 68%  */
-	{11, 1}, /* 2459298 - 24 March 2021 - 77%  */
-	{12, 1}, /* 2459299 - 25 March 2021 - 85%  */
-	{13, 1}, /* 2459300 - 26 March 2021 - 92%  */
-	{14, 1}, /* 2459301 - 27 March 2021 - 97%  */
-	{14, 1}, /* 2459302 - 28 March 2021 - 99%  */
-	{14, 0}, /* 2459303 - 29 March 2021 - 99%  */
-	{13, 0}, /* 2459304 - 30 March 2021 - 95%  */
-	{13, 0}, /* 2459305 - 31 March 2021 - 89%  */
-	{11, 0}, /* 2459306 - 1 April 2021 - 81%  */
-	{10, 0}, /* 2459307 - 2 April 2021 - 71%  */
-	{8, 0}, /* 2459308 - 3 April 2021 - 60%  */
-	{7, 0}, /* 2459309 - 4 April 2021 - 49%  */
-	{5, 0}, /* 2459310 - 5 April 2021 - 38%  */
-	{4, 0}, /* 2459311 - 6 April 2021 - 28%  */
-	{3, 0}, /* 2459312 - 7 April 2021 - 19%  */
-	{2, 0}, /* 2459313 - 8 April 2021 - 12%  */
-	{1, 0}, /* 2459314 - 9 April 2021 - 6%  */
-	{0, 0}, /* 2459315 - 10 April 2021 - 2%  */
-	{0, 0}, /* 2459316 - 11 April 2021 - 0%  */
-	{0, 0}, /* 2459317 - 12 April 2021 - 0%  */
-	{0, 1}, /* 2459318 - 13 April 2021 - 1%  */
-	{1, 1}, /* 2459319 - 14 April 2021 - 5%  */
-	{1, 1}, /* 2459320 - 15 April 2021 - 10%  */
-	{2, 1}, /* 2459321 - 16 April 2021 - 16%  */
-	{3, 1}, /* 2459322 - 17 April 2021 - 24%  */
-	{5, 1}, /* 2459323 - 18 April 2021 - 32%  */
-	{6, 1}, /* 2459324 - 19 April 2021 - 42%  */
-	{7, 1}, /* 2459325 - 20 April 2021 - 52%  */
-	{9, 1}, /* 2459326 - 21 April 2021 - 62%  */
-	{10, 1}, /* 2459327 - 22 April 2021 - 72%  */
-	{11, 1}, /* 2459328 - 23 April 2021 - 81%  */
-	{13, 1}, /* 2459329 - 24 April 2021 - 89%  */
-	{13, 1}, /* 2459330 - 25 April 2021 - 95%  */
-	{14, 1}, /* 2459331 - 26 April 2021 - 99%  */
-	{14, 1}, /* 2459332 - 27 April 2021 - 99%  */
-	{14, 0}, /* 2459333 - 28 April 2021 - 97%  */
-	{13, 0}, /* 2459334 - 29 April 2021 - 91%  */
-	{12, 0}, /* 2459335 - 30 April 2021 - 84%  */
-	{10, 0}, /* 2459336 - 1 May 2021 - 74%  */
-	{9, 0}, /* 2459337 - 2 May 2021 - 64%  */
-	{7, 0}, /* 2459338 - 3 May 2021 - 53%  */
-	{6, 0}, /* 2459339 - 4 May 2021 - 42%  */
-	{5, 0}, /* 2459340 - 5 May 2021 - 32%  */
-	{3, 0}, /* 2459341 - 6 May 2021 - 23%  */
-	{2, 0}, /* 2459342 - 7 May 2021 - 16%  */
-	{1, 0}, /* 2459343 - 8 May 2021 - 9%  */
-	{1, 0}, /* 2459344 - 9 May 2021 - 4%  */
-	{0, 0}, /* 2459345 - 10 May 2021 - 1%  */
-	{0, 0}, /* 2459346 - 11 May 2021 - 0%  */
-	{0, 1}, /* 2459347 - 12 May 2021 - 0%  */
-	{0, 1}, /* 2459348 - 13 May 2021 - 2%  */
-	{1, 1}, /* 2459349 - 14 May 2021 - 6%  */
-	{2, 1}, /* 2459350 - 15 May 2021 - 12%  */
-	{3, 1}, /* 2459351 - 16 May 2021 - 19%  */
-	{4, 1}, /* 2459352 - 17 May 2021 - 27%  */
-	{5, 1}, /* 2459353 - 18 May 2021 - 36%  */
-	{7, 1}, /* 2459354 - 19 May 2021 - 46%  */
-	{8, 1}, /* 2459355 - 20 May 2021 - 57%  */
-	{10, 1}, /* 2459356 - 21 May 2021 - 68%  */
-	{11, 1}, /* 2459357 - 22 May 2021 - 78%  */
-	{12, 1}, /* 2459358 - 23 May 2021 - 87%  */
-	{13, 1}, /* 2459359 - 24 May 2021 - 94%  */
-	{14, 1}, /* 2459360 - 25 May 2021 - 98%  */
-	{14, 1}, /* 2459361 - 26 May 2021 - 99%  */
-	{14, 0}, /* 2459362 - 27 May 2021 - 98%  */
-	{13, 0}, /* 2459363 - 28 May 2021 - 93%  */
-	{12, 0}, /* 2459364 - 29 May 2021 - 86%  */
-	{11, 0}, /* 2459365 - 30 May 2021 - 78%  */
-	{10, 0}, /* 2459366 - 31 May 2021 - 68%  */
-	{8, 0}, /* 2459367 - 1 June 2021 - 58%  */
-	{7, 0}, /* 2459368 - 2 June 2021 - 48%  */
-	{5, 0}, /* 2459369 - 3 June 2021 - 38%  */
-	{4, 0}, /* 2459370 - 4 June 2021 - 28%  */
-	{3, 0}, /* 2459371 - 5 June 2021 - 20%  */
-	{2, 0}, /* 2459372 - 6 June 2021 - 13%  */
-	{1, 0}, /* 2459373 - 7 June 2021 - 7%  */
-	{0, 0}, /* 2459374 - 8 June 2021 - 3%  */
-	{0, 0}, /* 2459375 - 9 June 2021 - 0%  */
-	{0, 0}, /* 2459376 - 10 June 2021 - 0%  */
-	{0, 1}, /* 2459377 - 11 June 2021 - 1%  */
-	{1, 1}, /* 2459378 - 12 June 2021 - 3%  */
-	{1, 1}, /* 2459379 - 13 June 2021 - 8%  */
-	{2, 1}, /* 2459380 - 14 June 2021 - 15%  */
-	{3, 1}, /* 2459381 - 15 June 2021 - 23%  */
-	{5, 1}, /* 2459382 - 16 June 2021 - 32%  */
-	{6, 1}, /* 2459383 - 17 June 2021 - 42%  */
-	{8, 1}, /* 2459384 - 18 June 2021 - 53%  */
-	{9, 1}, /* 2459385 - 19 June 2021 - 64%  */
-	{11, 1}, /* 2459386 - 20 June 2021 - 75%  */
-	{12, 1}, /* 2459387 - 21 June 2021 - 84%  */
-	{13, 1}, /* 2459388 - 22 June 2021 - 92%  */
-	{14, 1}, /* 2459389 - 23 June 2021 - 97%  */
-	{14, 1}, /* 2459390 - 24 June 2021 - 99%  */
-	{14, 0}, /* 2459391 - 25 June 2021 - 99%  */
-	{13, 0}, /* 2459392 - 26 June 2021 - 95%  */
-	{13, 0}, /* 2459393 - 27 June 2021 - 89%  */
-	{12, 0}, /* 2459394 - 28 June 2021 - 82%  */
-	{10, 0}, /* 2459395 - 29 June 2021 - 73%  */
-	{9, 0}, /* 2459396 - 30 June 2021 - 63%  */
-	{8, 0}, /* 2459397 - 1 July 2021 - 53%  */
-	{6, 0}, /* 2459398 - 2 July 2021 - 44%  */
-	{5, 0}, /* 2459399 - 3 July 2021 - 34%  */
-	{4, 0}, /* 2459400 - 4 July 2021 - 25%  */
-	{3, 0}, /* 2459401 - 5 July 2021 - 18%  */
-	{2, 0}, /* 2459402 - 6 July 2021 - 11%  */
-	{1, 0}, /* 2459403 - 7 July 2021 - 6%  */
-	{0, 0}, /* 2459404 - 8 July 2021 - 2%  */
-	{0, 0}, /* 2459405 - 9 July 2021 - 0%  */
-	{0, 0}, /* 2459406 - 10 July 2021 - 0%  */
-	{0, 1}, /* 2459407 - 11 July 2021 - 2%  */
-	{1, 1}, /* 2459408 - 12 July 2021 - 6%  */
-	{2, 1}, /* 2459409 - 13 July 2021 - 12%  */
-	{3, 1}, /* 2459410 - 14 July 2021 - 19%  */
-	{4, 1}, /* 2459411 - 15 July 2021 - 29%  */
-	{6, 1}, /* 2459412 - 16 July 2021 - 39%  */
-	{7, 1}, /* 2459413 - 17 July 2021 - 50%  */
-	{9, 1}, /* 2459414 - 18 July 2021 - 62%  */
-	{10, 1}, /* 2459415 - 19 July 2021 - 72%  */
-	{12, 1}, /* 2459416 - 20 July 2021 - 82%  */
-	{13, 1}, /* 2459417 - 21 July 2021 - 90%  */
-	{14, 1}, /* 2459418 - 22 July 2021 - 96%  */
-	{14, 1}, /* 2459419 - 23 July 2021 - 99%  */
-	{14, 1}, /* 2459420 - 24 July 2021 - 99%  */
-	{14, 0}, /* 2459421 - 25 July 2021 - 97%  */
-	{13, 0}, /* 2459422 - 26 July 2021 - 92%  */
-	{12, 0}, /* 2459423 - 27 July 2021 - 86%  */
-	{11, 0}, /* 2459424 - 28 July 2021 - 78%  */
-	{10, 0}, /* 2459425 - 29 July 2021 - 69%  */
-	{8, 0}, /* 2459426 - 30 July 2021 - 60%  */
-	{7, 0}, /* 2459427 - 31 July 2021 - 50%  */
-	{6, 0}, /* 2459428 - 1 August 2021 - 41%  */
-	{4, 0}, /* 2459429 - 2 August 2021 - 32%  */
-	{3, 0}, /* 2459430 - 3 August 2021 - 23%  */
-	{2, 0}, /* 2459431 - 4 August 2021 - 15%  */
-	{1, 0}, /* 2459432 - 5 August 2021 - 9%  */
-	{1, 0}, /* 2459433 - 6 August 2021 - 4%  */
-	{0, 0}, /* 2459434 - 7 August 2021 - 1%  */
-	{0, 0}, /* 2459435 - 8 August 2021 - 0%  */
-	{0, 1}, /* 2459436 - 9 August 2021 - 0%  */
-	{1, 1}, /* 2459437 - 10 August 2021 - 4%  */
-	{1, 1}, /* 2459438 - 11 August 2021 - 9%  */
-	{2, 1}, /* 2459439 - 12 August 2021 - 17%  */
-	{4, 1}, /* 2459440 - 13 August 2021 - 26%  */
-	{5, 1}, /* 2459441 - 14 August 2021 - 37%  */
-	{7, 1}, /* 2459442 - 15 August 2021 - 48%  */
-	{8, 1}, /* 2459443 - 16 August 2021 - 59%  */
-	{10, 1}, /* 2459444 - 17 August 2021 - 70%  */
-	{11, 1}, /* 2459445 - 18 August 2021 - 80%  */
-	{12, 1}, /* 2459446 - 19 August 2021 - 88%  */
-	{13, 1}, /* 2459447 - 20 August 2021 - 95%  */
-	{14, 1}, /* 2459448 - 21 August 2021 - 98%  */
-	{14, 1}, /* 2459449 - 22 August 2021 - 99%  */
-	{14, 0}, /* 2459450 - 23 August 2021 - 98%  */
-	{13, 0}, /* 2459451 - 24 August 2021 - 95%  */
-	{13, 0}, /* 2459452 - 25 August 2021 - 90%  */
-	{12, 0}, /* 2459453 - 26 August 2021 - 83%  */
-	{11, 0}, /* 2459454 - 27 August 2021 - 75%  */
-	{9, 0}, /* 2459455 - 28 August 2021 - 66%  */
-	{8, 0}, /* 2459456 - 29 August 2021 - 57%  */
-	{7, 0}, /* 2459457 - 30 August 2021 - 48%  */
-	{5, 0}, /* 2459458 - 31 August 2021 - 38%  */
-	{4, 0}, /* 2459459 - 1 September 2021 - 29%  */
-	{3, 0}, /* 2459460 - 2 September 2021 - 21%  */
-	{2, 0}, /* 2459461 - 3 September 2021 - 13%  */
-	{1, 0}, /* 2459462 - 4 September 2021 - 7%  */
-	{0, 0}, /* 2459463 - 5 September 2021 - 2%  */
-	{0, 0}, /* 2459464 - 6 September 2021 - 0%  */
-	{0, 0}, /* 2459465 - 7 September 2021 - 0%  */
-	{0, 1}, /* 2459466 - 8 September 2021 - 2%  */
-	{1, 1}, /* 2459467 - 9 September 2021 - 7%  */
-	{2, 1}, /* 2459468 - 10 September 2021 - 14%  */
-	{3, 1}, /* 2459469 - 11 September 2021 - 24%  */
-	{5, 1}, /* 2459470 - 12 September 2021 - 34%  */
-	{6, 1}, /* 2459471 - 13 September 2021 - 45%  */
-	{8, 1}, /* 2459472 - 14 September 2021 - 57%  */
-	{10, 1}, /* 2459473 - 15 September 2021 - 68%  */
-	{11, 1}, /* 2459474 - 16 September 2021 - 78%  */
-	{12, 1}, /* 2459475 - 17 September 2021 - 86%  */
-	{13, 1}, /* 2459476 - 18 September 2021 - 93%  */
-	{14, 1}, /* 2459477 - 19 September 2021 - 97%  */
-	{14, 1}, /* 2459478 - 20 September 2021 - 99%  */
-	{14, 1}, /* 2459479 - 21 September 2021 - 99%  */
-	{14, 0}, /* 2459480 - 22 September 2021 - 97%  */
-	{13, 0}, /* 2459481 - 23 September 2021 - 93%  */
-	{12, 0}, /* 2459482 - 24 September 2021 - 88%  */
-	{11, 0}, /* 2459483 - 25 September 2021 - 81%  */
-	{10, 0}, /* 2459484 - 26 September 2021 - 73%  */
-	{9, 0}, /* 2459485 - 27 September 2021 - 64%  */
-	{8, 0}, /* 2459486 - 28 September 2021 - 55%  */
-	{6, 0}, /* 2459487 - 29 September 2021 - 45%  */
-	{5, 0}, /* 2459488 - 30 September 2021 - 36%  */
-	{4, 0}, /* 2459489 - 1 October 2021 - 27%  */
-	{3, 0}, /* 2459490 - 2 October 2021 - 18%  */
-	{2, 0}, /* 2459491 - 3 October 2021 - 10%  */
-	{1, 0}, /* 2459492 - 4 October 2021 - 5%  */
-	{0, 0}, /* 2459493 - 5 October 2021 - 1%  */
-	{0, 0}, /* 2459494 - 6 October 2021 - 0%  */
-	{0, 1}, /* 2459495 - 7 October 2021 - 1%  */
-	{1, 1}, /* 2459496 - 8 October 2021 - 5%  */
-	{2, 1}, /* 2459497 - 9 October 2021 - 12%  */
-	{3, 1}, /* 2459498 - 10 October 2021 - 21%  */
-	{4, 1}, /* 2459499 - 11 October 2021 - 31%  */
-	{6, 1}, /* 2459500 - 12 October 2021 - 42%  */
-	{8, 1}, /* 2459501 - 13 October 2021 - 54%  */
-	{9, 1}, /* 2459502 - 14 October 2021 - 64%  */
-	{10, 1}, /* 2459503 - 15 October 2021 - 74%  */
-	{12, 1}, /* 2459504 - 16 October 2021 - 83%  */
-	{13, 1}, /* 2459505 - 17 October 2021 - 90%  */
-	{13, 1}, /* 2459506 - 18 October 2021 - 95%  */
-	{14, 1}, /* 2459507 - 19 October 2021 - 98%  */
-	{14, 1}, /* 2459508 - 20 October 2021 - 99%  */
-	{14, 0}, /* 2459509 - 21 October 2021 - 99%  */
-	{14, 0}, /* 2459510 - 22 October 2021 - 96%  */
-	{13, 0}, /* 2459511 - 23 October 2021 - 92%  */
-	{12, 0}, /* 2459512 - 24 October 2021 - 86%  */
-	{11, 0}, /* 2459513 - 25 October 2021 - 79%  */
-	{10, 0}, /* 2459514 - 26 October 2021 - 71%  */
-	{9, 0}, /* 2459515 - 27 October 2021 - 62%  */
-	{7, 0}, /* 2459516 - 28 October 2021 - 53%  */
-	{6, 0}, /* 2459517 - 29 October 2021 - 43%  */
-	{5, 0}, /* 2459518 - 30 October 2021 - 33%  */
-	{3, 0}, /* 2459519 - 31 October 2021 - 23%  */
-	{2, 0}, /* 2459520 - 1 November 2021 - 15%  */
-	{1, 0}, /* 2459521 - 2 November 2021 - 8%  */
-	{0, 0}, /* 2459522 - 3 November 2021 - 2%  */
-	{0, 0}, /* 2459523 - 4 November 2021 - 0%  */
-	{0, 1}, /* 2459524 - 5 November 2021 - 0%  */
-	{1, 1}, /* 2459525 - 6 November 2021 - 3%  */
-	{1, 1}, /* 2459526 - 7 November 2021 - 9%  */
-	{3, 1}, /* 2459527 - 8 November 2021 - 18%  */
-	{4, 1}, /* 2459528 - 9 November 2021 - 27%  */
-	{5, 1}, /* 2459529 - 10 November 2021 - 38%  */
-	{7, 1}, /* 2459530 - 11 November 2021 - 49%  */
-	{8, 1}, /* 2459531 - 12 November 2021 - 60%  */
-	{10, 1}, /* 2459532 - 13 November 2021 - 70%  */
-	{11, 1}, /* 2459533 - 14 November 2021 - 79%  */
-	{12, 1}, /* 2459534 - 15 November 2021 - 86%  */
-	{13, 1}, /* 2459535 - 16 November 2021 - 92%  */
-	{14, 1}, /* 2459536 - 17 November 2021 - 96%  */
-	{14, 1}, /* 2459537 - 18 November 2021 - 99%  */
-	{14, 1}, /* 2459538 - 19 November 2021 - 99%  */
-	{14, 0}, /* 2459539 - 20 November 2021 - 98%  */
-	{13, 0}, /* 2459540 - 21 November 2021 - 96%  */
-	{13, 0}, /* 2459541 - 22 November 2021 - 91%  */
-	{12, 0}, /* 2459542 - 23 November 2021 - 85%  */
-	{11, 0}, /* 2459543 - 24 November 2021 - 78%  */
-	{10, 0}, /* 2459544 - 25 November 2021 - 69%  */
-	{8, 0}, /* 2459545 - 26 November 2021 - 60%  */
-	{7, 0}, /* 2459546 - 27 November 2021 - 50%  */
-	{6, 0}, /* 2459547 - 28 November 2021 - 39%  */
-	{4, 0}, /* 2459548 - 29 November 2021 - 29%  */
-	{3, 0}, /* 2459549 - 30 November 2021 - 19%  */
-	{2, 0}, /* 2459550 - 1 December 2021 - 11%  */
-	{1, 0}, /* 2459551 - 2 December 2021 - 4%  */
-	{0, 0}, /* 2459552 - 3 December 2021 - 1%  */
-	{0, 0}, /* 2459553 - 4 December 2021 - 0%  */
-	{0, 1}, /* 2459554 - 5 December 2021 - 2%  */
-	{1, 1}, /* 2459555 - 6 December 2021 - 7%  */
-	{2, 1}, /* 2459556 - 7 December 2021 - 14%  */
-	{3, 1}, /* 2459557 - 8 December 2021 - 23%  */
-	{5, 1}, /* 2459558 - 9 December 2021 - 33%  */
-	{6, 1}, /* 2459559 - 10 December 2021 - 43%  */
-	{8, 1}, /* 2459560 - 11 December 2021 - 54%  */
-	{9, 1}, /* 2459561 - 12 December 2021 - 64%  */
-	{10, 1}, /* 2459562 - 13 December 2021 - 73%  */
-	{11, 1}, /* 2459563 - 14 December 2021 - 81%  */
-	{12, 1}, /* 2459564 - 15 December 2021 - 88%  */
-	{13, 1}, /* 2459565 - 16 December 2021 - 93%  */
-	{14, 1}, /* 2459566 - 17 December 2021 - 97%  */
-	{14, 1}, /* 2459567 - 18 December 2021 - 99%  */
-	{14, 1}, /* 2459568 - 19 December 2021 - 99%  */
-	{14, 0}, /* 2459569 - 20 December 2021 - 98%  */
-	{13, 0}, /* 2459570 - 21 December 2021 - 95%  */
-	{13, 0}, /* 2459571 - 22 December 2021 - 90%  */
-	{12, 0}, /* 2459572 - 23 December 2021 - 83%  */
-	{11, 0}, /* 2459573 - 24 December 2021 - 75%  */
-	{9, 0}, /* 2459574 - 25 December 2021 - 66%  */
-	{8, 0}, /* 2459575 - 26 December 2021 - 56%  */
-	{6, 0}, /* 2459576 - 27 December 2021 - 45%  */
-	{5, 0}, /* 2459577 - 28 December 2021 - 34%  */
-	{3, 0}, /* 2459578 - 29 December 2021 - 24%  */
-	{2, 0}, /* 2459579 - 30 December 2021 - 15%  */
-	{1, 0}, /* 2459580 - 31 December 2021 - 7%  */
-	{0, 0}, /* 2459581 - 1 January 2022 - 2%  */
-	{0, 0}, /* 2459582 - 2 January 2022 - 0%  */
-	{0, 1}, /* 2459583 - 3 January 2022 - 0%  */
-	{1, 1}, /* 2459584 - 4 January 2022 - 4%  */
-	{1, 1}, /* 2459585 - 5 January 2022 - 10%  */
-	{3, 1}, /* 2459586 - 6 January 2022 - 18%  */
-	{4, 1}, /* 2459587 - 7 January 2022 - 27%  */
-	{5, 1}, /* 2459588 - 8 January 2022 - 37%  */
-	{7, 1}, /* 2459589 - 9 January 2022 - 47%  */
-	{8, 1}, /* 2459590 - 10 January 2022 - 57%  */
-	{9, 1}, /* 2459591 - 11 January 2022 - 66%  */
-	{11, 1}, /* 2459592 - 12 January 2022 - 75%  */
-	{12, 1}, /* 2459593 - 13 January 2022 - 82%  */
-	{12, 1}, /* 2459594 - 14 January 2022 - 89%  */
-	{13, 1}, /* 2459595 - 15 January 2022 - 94%  */
-	{14, 1}, /* 2459596 - 16 January 2022 - 97%  */
-	{14, 1}, /* 2459597 - 17 January 2022 - 99%  */
-	{14, 0}, /* 2459598 - 18 January 2022 - 99%  */
-	{14, 0}, /* 2459599 - 19 January 2022 - 97%  */
-	{13, 0}, /* 2459600 - 20 January 2022 - 93%  */
-	{12, 0}, /* 2459601 - 21 January 2022 - 88%  */
-	{11, 0}, /* 2459602 - 22 January 2022 - 80%  */
-	{10, 0}, /* 2459603 - 23 January 2022 - 71%  */
-	{9, 0}, /* 2459604 - 24 January 2022 - 61%  */
-	{7, 0}, /* 2459605 - 25 January 2022 - 50%  */
-	{6, 0}, /* 2459606 - 26 January 2022 - 39%  */
-	{4, 0}, /* 2459607 - 27 January 2022 - 28%  */
-	{3, 0}, /* 2459608 - 28 January 2022 - 18%  */
-	{1, 0}, /* 2459609 - 29 January 2022 - 10%  */
-	{1, 0}, /* 2459610 - 30 January 2022 - 4%  */
-	{0, 0}, /* 2459611 - 31 January 2022 - 0%  */
-	{0, 0}, /* 2459612 - 1 February 2022 - 0%  */
-	{0, 1}, /* 2459613 - 2 February 2022 - 2%  */
-	{1, 1}, /* 2459614 - 3 February 2022 - 6%  */
-	{2, 1}, /* 2459615 - 4 February 2022 - 13%  */
-	{3, 1}, /* 2459616 - 5 February 2022 - 21%  */
-	{4, 1}, /* 2459617 - 6 February 2022 - 30%  */
-	{6, 1}, /* 2459618 - 7 February 2022 - 39%  */
-	{7, 1}, /* 2459619 - 8 February 2022 - 49%  */
-	{8, 1}, /* 2459620 - 9 February 2022 - 58%  */
-	{9, 1}, /* 2459621 - 10 February 2022 - 67%  */
-	{11, 1}, /* 2459622 - 11 February 2022 - 76%  */
-	{12, 1}, /* 2459623 - 12 February 2022 - 83%  */
-	{13, 1}, /* 2459624 - 13 February 2022 - 90%  */
-	{13, 1}, /* 2459625 - 14 February 2022 - 95%  */
-	{14, 1}, /* 2459626 - 15 February 2022 - 98%  */
-	{14, 1}, /* 2459627 - 16 February 2022 - 99%  */
-	{14, 0}, /* 2459628 - 17 February 2022 - 99%  */
-	{14, 0}, /* 2459629 - 18 February 2022 - 96%  */
-	{13, 0}, /* 2459630 - 19 February 2022 - 91%  */
-	{12, 0}, /* 2459631 - 20 February 2022 - 84%  */
-	{11, 0}, /* 2459632 - 21 February 2022 - 76%  */
-	{9, 0}, /* 2459633 - 22 February 2022 - 65%  */
-	{8, 0}, /* 2459634 - 23 February 2022 - 54%  */
-	{6, 0}, /* 2459635 - 24 February 2022 - 43%  */
-	{5, 0}, /* 2459636 - 25 February 2022 - 32%  */
-	{3, 0}, /* 2459637 - 26 February 2022 - 22%  */
-	{2, 0}, /* 2459638 - 27 February 2022 - 13%  */
-	{1, 0}, /* 2459639 - 28 February 2022 - 6%  */
-	{0, 0}, /* 2459640 - 1 March 2022 - 1%  */
-	{0, 0}, /* 2459641 - 2 March 2022 - 0%  */
-	{0, 1}, /* 2459642 - 3 March 2022 - 0%  */
-	{1, 1}, /* 2459643 - 4 March 2022 - 3%  */
-	{1, 1}, /* 2459644 - 5 March 2022 - 8%  */
-	{2, 1}, /* 2459645 - 6 March 2022 - 15%  */
-	{3, 1}, /* 2459646 - 7 March 2022 - 23%  */
-	{4, 1}, /* 2459647 - 8 March 2022 - 31%  */
-	{6, 1}, /* 2459648 - 9 March 2022 - 41%  */
-	{7, 1}, /* 2459649 - 10 March 2022 - 50%  */
-	{8, 1}, /* 2459650 - 11 March 2022 - 59%  */
-	{10, 1}, /* 2459651 - 12 March 2022 - 68%  */
-	{11, 1}, /* 2459652 - 13 March 2022 - 77%  */
-	{12, 1}, /* 2459653 - 14 March 2022 - 85%  */
-	{13, 1}, /* 2459654 - 15 March 2022 - 91%  */
-	{13, 1}, /* 2459655 - 16 March 2022 - 96%  */
-	{14, 1}, /* 2459656 - 17 March 2022 - 99%  */
-	{14, 1}, /* 2459657 - 18 March 2022 - 99%  */
-	{14, 0}, /* 2459658 - 19 March 2022 - 98%  */
-	{13, 0}, /* 2459659 - 20 March 2022 - 94%  */
-	{12, 0}, /* 2459660 - 21 March 2022 - 87%  */
-	{11, 0}, /* 2459661 - 22 March 2022 - 79%  */
-	{10, 0}, /* 2459662 - 23 March 2022 - 69%  */
-	{8, 0}, /* 2459663 - 24 March 2022 - 58%  */
-	{7, 0}, /* 2459664 - 25 March 2022 - 46%  */
-	{5, 0}, /* 2459665 - 26 March 2022 - 35%  */
-	{4, 0}, /* 2459666 - 27 March 2022 - 25%  */
-	{2, 0}, /* 2459667 - 28 March 2022 - 16%  */
-	{1, 0}, /* 2459668 - 29 March 2022 - 8%  */
-	{1, 0}, /* 2459669 - 30 March 2022 - 3%  */
-	{0, 0}, /* 2459670 - 31 March 2022 - 0%  */
-	{0, 0}, /* 2459671 - 1 April 2022 - 0%  */
-	{0, 1}, /* 2459672 - 2 April 2022 - 1%  */
-	{1, 1}, /* 2459673 - 3 April 2022 - 5%  */
-	{1, 1}, /* 2459674 - 4 April 2022 - 10%  */
-	{2, 1}, /* 2459675 - 5 April 2022 - 17%  */
-	{3, 1}, /* 2459676 - 6 April 2022 - 24%  */
-	{5, 1}, /* 2459677 - 7 April 2022 - 33%  */
-	{6, 1}, /* 2459678 - 8 April 2022 - 42%  */
-	{7, 1}, /* 2459679 - 9 April 2022 - 52%  */
-	{9, 1}, /* 2459680 - 10 April 2022 - 61%  */
-	{10, 1}, /* 2459681 - 11 April 2022 - 70%  */
-	{11, 1}, /* 2459682 - 12 April 2022 - 79%  */
-	{12, 1}, /* 2459683 - 13 April 2022 - 87%  */
-	{13, 1}, /* 2459684 - 14 April 2022 - 93%  */
-	{14, 1}, /* 2459685 - 15 April 2022 - 97%  */
-	{14, 1}, /* 2459686 - 16 April 2022 - 99%  */
-	{14, 0}, /* 2459687 - 17 April 2022 - 99%  */
-	{13, 0}, /* 2459688 - 18 April 2022 - 96%  */
-	{13, 0}, /* 2459689 - 19 April 2022 - 90%  */
-	{11, 0}, /* 2459690 - 20 April 2022 - 82%  */
-	{10, 0}, /* 2459691 - 21 April 2022 - 72%  */
-	{9, 0}, /* 2459692 - 22 April 2022 - 61%  */
-	{7, 0}, /* 2459693 - 23 April 2022 - 49%  */
-	{5, 0}, /* 2459694 - 24 April 2022 - 38%  */
-	{4, 0}, /* 2459695 - 25 April 2022 - 28%  */
-	{3, 0}, /* 2459696 - 26 April 2022 - 19%  */
-	{2, 0}, /* 2459697 - 27 April 2022 - 11%  */
-	{1, 0}, /* 2459698 - 28 April 2022 - 5%  */
-	{0, 0}, /* 2459699 - 29 April 2022 - 1%  */
-	{0, 0}, /* 2459700 - 30 April 2022 - 0%  */
-	{0, 1}, /* 2459701 - 1 May 2022 - 0%  */
-	{0, 1}, /* 2459702 - 2 May 2022 - 2%  */
-	{1, 1}, /* 2459703 - 3 May 2022 - 6%  */
-	{2, 1}, /* 2459704 - 4 May 2022 - 12%  */
-	{3, 1}, /* 2459705 - 5 May 2022 - 18%  */
-	{4, 1}, /* 2459706 - 6 May 2022 - 26%  */
-	{5, 1}, /* 2459707 - 7 May 2022 - 35%  */
-	{6, 1}, /* 2459708 - 8 May 2022 - 45%  */
-	{8, 1}, /* 2459709 - 9 May 2022 - 54%  */
-	{9, 1}, /* 2459710 - 10 May 2022 - 64%  */
-	{10, 1}, /* 2459711 - 11 May 2022 - 74%  */
-	{12, 1}, /* 2459712 - 12 May 2022 - 82%  */
-	{13, 1}, /* 2459713 - 13 May 2022 - 90%  */
-	{13, 1}, /* 2459714 - 14 May 2022 - 96%  */
-	{14, 1}, /* 2459715 - 15 May 2022 - 99%  */
-	{14, 1}, /* 2459716 - 16 May 2022 - 99%  */
-	{14, 0}, /* 2459717 - 17 May 2022 - 97%  */
-	{13, 0}, /* 2459718 - 18 May 2022 - 92%  */
-	{12, 0}, /* 2459719 - 19 May 2022 - 84%  */
-	{10, 0}, /* 2459720 - 20 May 2022 - 74%  */
-	{9, 0}, /* 2459721 - 21 May 2022 - 64%  */
-	{7, 0}, /* 2459722 - 22 May 2022 - 53%  */
-	{6, 0}, /* 2459723 - 23 May 2022 - 42%  */
-	{4, 0}, /* 2459724 - 24 May 2022 - 31%  */
-	{3, 0}, /* 2459725 - 25 May 2022 - 22%  */
-	{2, 0}, /* 2459726 - 26 May 2022 - 14%  */
-	{1, 0}, /* 2459727 - 27 May 2022 - 8%  */
-	{1, 0}, /* 2459728 - 28 May 2022 - 3%  */
-	{0, 0}, /* 2459729 - 29 May 2022 - 0%  */
-	{0, 0}, /* 2459730 - 30 May 2022 - 0%  */
-	{0, 1}, /* 2459731 - 31 May 2022 - 0%  */
-	{1, 1}, /* 2459732 - 1 June 2022 - 3%  */
-	{1, 1}, /* 2459733 - 2 June 2022 - 8%  */
-	{2, 1}, /* 2459734 - 3 June 2022 - 14%  */
-	{3, 1}, /* 2459735 - 4 June 2022 - 21%  */
-	{4, 1}, /* 2459736 - 5 June 2022 - 29%  */
-	{5, 1}, /* 2459737 - 6 June 2022 - 38%  */
-	{7, 1}, /* 2459738 - 7 June 2022 - 48%  */
-	{8, 1}, /* 2459739 - 8 June 2022 - 59%  */
-	{10, 1}, /* 2459740 - 9 June 2022 - 69%  */
-	{11, 1}, /* 2459741 - 10 June 2022 - 78%  */
-	{12, 1}, /* 2459742 - 11 June 2022 - 87%  */
-	{13, 1}, /* 2459743 - 12 June 2022 - 94%  */
-	{14, 1}, /* 2459744 - 13 June 2022 - 98%  */
-	{14, 1}, /* 2459745 - 14 June 2022 - 99%  */
-	{14, 0}, /* 2459746 - 15 June 2022 - 98%  */
-	{13, 0}, /* 2459747 - 16 June 2022 - 93%  */
-	{12, 0}, /* 2459748 - 17 June 2022 - 86%  */
-	{11, 0}, /* 2459749 - 18 June 2022 - 77%  */
-	{9, 0}, /* 2459750 - 19 June 2022 - 67%  */
-	{8, 0}, /* 2459751 - 20 June 2022 - 56%  */
-	{6, 0}, /* 2459752 - 21 June 2022 - 46%  */
-	{5, 0}, /* 2459753 - 22 June 2022 - 36%  */
-	{4, 0}, /* 2459754 - 23 June 2022 - 26%  */
-	{3, 0}, /* 2459755 - 24 June 2022 - 18%  */
-	{2, 0}, /* 2459756 - 25 June 2022 - 11%  */
-	{1, 0}, /* 2459757 - 26 June 2022 - 6%  */
-	{0, 0}, /* 2459758 - 27 June 2022 - 2%  */
-	{0, 0}, /* 2459759 - 28 June 2022 - 0%  */
-	{0, 0}, /* 2459760 - 29 June 2022 - 0%  */
-	{0, 1}, /* 2459761 - 30 June 2022 - 1%  */
-	{1, 1}, /* 2459762 - 1 July 2022 - 5%  */
-	{1, 1}, /* 2459763 - 2 July 2022 - 10%  */
-	{2, 1}, /* 2459764 - 3 July 2022 - 16%  */
-	{3, 1}, /* 2459765 - 4 July 2022 - 24%  */
-	{5, 1}, /* 2459766 - 5 July 2022 - 33%  */
-	{6, 1}, /* 2459767 - 6 July 2022 - 43%  */
-	{8, 1}, /* 2459768 - 7 July 2022 - 54%  */
-	{9, 1}, /* 2459769 - 8 July 2022 - 65%  */
-	{11, 1}, /* 2459770 - 9 July 2022 - 75%  */
-	{12, 1}, /* 2459771 - 10 July 2022 - 84%  */
-	{13, 1}, /* 2459772 - 11 July 2022 - 92%  */
-	{14, 1}, /* 2459773 - 12 July 2022 - 97%  */
-	{14, 1}, /* 2459774 - 13 July 2022 - 99%  */
-	{14, 0}, /* 2459775 - 14 July 2022 - 99%  */
-	{13, 0}, /* 2459776 - 15 July 2022 - 95%  */
-	{12, 0}, /* 2459777 - 16 July 2022 - 89%  */
-	{11, 0}, /* 2459778 - 17 July 2022 - 81%  */
-	{10, 0}, /* 2459779 - 18 July 2022 - 71%  */
-	{9, 0}, /* 2459780 - 19 July 2022 - 61%  */
-	{7, 0}, /* 2459781 - 20 July 2022 - 51%  */
-	{6, 0}, /* 2459782 - 21 July 2022 - 41%  */
-	{4, 0}, /* 2459783 - 22 July 2022 - 31%  */
-	{3, 0}, /* 2459784 - 23 July 2022 - 23%  */
-	{2, 0}, /* 2459785 - 24 July 2022 - 15%  */
-	{1, 0}, /* 2459786 - 25 July 2022 - 9%  */
-	{1, 0}, /* 2459787 - 26 July 2022 - 4%  */
-	{0, 0}, /* 2459788 - 27 July 2022 - 1%  */
-	{0, 0}, /* 2459789 - 28 July 2022 - 0%  */
-	{0, 1}, /* 2459790 - 29 July 2022 - 0%  */
-	{0, 1}, /* 2459791 - 30 July 2022 - 2%  */
-	{1, 1}, /* 2459792 - 31 July 2022 - 7%  */
-	{2, 1}, /* 2459793 - 1 August 2022 - 13%  */
-	{3, 1}, /* 2459794 - 2 August 2022 - 20%  */
-	{4, 1}, /* 2459795 - 3 August 2022 - 29%  */
-	{6, 1}, /* 2459796 - 4 August 2022 - 39%  */
-	{7, 1}, /* 2459797 - 5 August 2022 - 50%  */
-	{9, 1}, /* 2459798 - 6 August 2022 - 61%  */
-	{10, 1}, /* 2459799 - 7 August 2022 - 72%  */
-	{12, 1}, /* 2459800 - 8 August 2022 - 82%  */
-	{13, 1}, /* 2459801 - 9 August 2022 - 90%  */
-	{13, 1}, /* 2459802 - 10 August 2022 - 96%  */
-	{14, 1}, /* 2459803 - 11 August 2022 - 99%  */
-	{14, 1}, /* 2459804 - 12 August 2022 - 99%  */
-	{14, 0}, /* 2459805 - 13 August 2022 - 97%  */
-	{13, 0}, /* 2459806 - 14 August 2022 - 91%  */
-	{12, 0}, /* 2459807 - 15 August 2022 - 84%  */
-	{11, 0}, /* 2459808 - 16 August 2022 - 76%  */
-	{9, 0}, /* 2459809 - 17 August 2022 - 66%  */
-	{8, 0}, /* 2459810 - 18 August 2022 - 56%  */
-	{7, 0}, /* 2459811 - 19 August 2022 - 47%  */
-	{5, 0}, /* 2459812 - 20 August 2022 - 37%  */
-	{4, 0}, /* 2459813 - 21 August 2022 - 28%  */
-	{3, 0}, /* 2459814 - 22 August 2022 - 20%  */
-	{2, 0}, /* 2459815 - 23 August 2022 - 13%  */
-	{1, 0}, /* 2459816 - 24 August 2022 - 7%  */
-	{0, 0}, /* 2459817 - 25 August 2022 - 3%  */
-	{0, 0}, /* 2459818 - 26 August 2022 - 0%  */
-	{0, 0}, /* 2459819 - 27 August 2022 - 0%  */
-	{0, 1}, /* 2459820 - 28 August 2022 - 1%  */
-	{1, 1}, /* 2459821 - 29 August 2022 - 4%  */
-	{1, 1}, /* 2459822 - 30 August 2022 - 10%  */
-	{2, 1}, /* 2459823 - 31 August 2022 - 17%  */
-	{4, 1}, /* 2459824 - 1 September 2022 - 26%  */
-	{5, 1}, /* 2459825 - 2 September 2022 - 36%  */
-	{7, 1}, /* 2459826 - 3 September 2022 - 47%  */
-	{8, 1}, /* 2459827 - 4 September 2022 - 58%  */
-	{10, 1}, /* 2459828 - 5 September 2022 - 69%  */
-	{11, 1}, /* 2459829 - 6 September 2022 - 79%  */
-	{12, 1}, /* 2459830 - 7 September 2022 - 88%  */
-	{13, 1}, /* 2459831 - 8 September 2022 - 94%  */
-	{14, 1}, /* 2459832 - 9 September 2022 - 98%  */
-	{14, 1}, /* 2459833 - 10 September 2022 - 99%  */
-	{14, 0}, /* 2459834 - 11 September 2022 - 98%  */
-	{13, 0}, /* 2459835 - 12 September 2022 - 94%  */
-	{12, 0}, /* 2459836 - 13 September 2022 - 88%  */
-	{11, 0}, /* 2459837 - 14 September 2022 - 81%  */
-	{10, 0}, /* 2459838 - 15 September 2022 - 72%  */
-	{9, 0}, /* 2459839 - 16 September 2022 - 63%  */
-	{8, 0}, /* 2459840 - 17 September 2022 - 53%  */
-	{6, 0}, /* 2459841 - 18 September 2022 - 44%  */
-	{5, 0}, /* 2459842 - 19 September 2022 - 35%  */
-	{4, 0}, /* 2459843 - 20 September 2022 - 26%  */
-	{3, 0}, /* 2459844 - 21 September 2022 - 18%  */
-	{2, 0}, /* 2459845 - 22 September 2022 - 11%  */
-	{1, 0}, /* 2459846 - 23 September 2022 - 6%  */
-	{0, 0}, /* 2459847 - 24 September 2022 - 2%  */
-	{0, 0}, /* 2459848 - 25 September 2022 - 0%  */
-	{0, 1}, /* 2459849 - 26 September 2022 - 0%  */
-	{0, 1}, /* 2459850 - 27 September 2022 - 2%  */
-	{1, 1}, /* 2459851 - 28 September 2022 - 7%  */
-	{2, 1}, /* 2459852 - 29 September 2022 - 14%  */
-	{3, 1}, /* 2459853 - 30 September 2022 - 23%  */
-	{5, 1}, /* 2459854 - 1 October 2022 - 33%  */
-	{6, 1}, /* 2459855 - 2 October 2022 - 44%  */
-	{8, 1}, /* 2459856 - 3 October 2022 - 55%  */
-	{9, 1}, /* 2459857 - 4 October 2022 - 66%  */
-	{11, 1}, /* 2459858 - 5 October 2022 - 77%  */
-	{12, 1}, /* 2459859 - 6 October 2022 - 86%  */
-	{13, 1}, /* 2459860 - 7 October 2022 - 93%  */
-	{14, 1}, /* 2459861 - 8 October 2022 - 97%  */
-	{14, 1}, /* 2459862 - 9 October 2022 - 99%  */
-	{14, 0}, /* 2459863 - 10 October 2022 - 99%  */
-	{14, 0}, /* 2459864 - 11 October 2022 - 96%  */
-	{13, 0}, /* 2459865 - 12 October 2022 - 92%  */
-	{12, 0}, /* 2459866 - 13 October 2022 - 86%  */
-	{11, 0}, /* 2459867 - 14 October 2022 - 78%  */
-	{10, 0}, /* 2459868 - 15 October 2022 - 70%  */
-	{9, 0}, /* 2459869 - 16 October 2022 - 61%  */
-	{7, 0}, /* 2459870 - 17 October 2022 - 52%  */
-	{6, 0}, /* 2459871 - 18 October 2022 - 42%  */
-	{5, 0}, /* 2459872 - 19 October 2022 - 33%  */
-	{3, 0}, /* 2459873 - 20 October 2022 - 24%  */
-	{2, 0}, /* 2459874 - 21 October 2022 - 16%  */
-	{1, 0}, /* 2459875 - 22 October 2022 - 9%  */
-	{1, 0}, /* 2459876 - 23 October 2022 - 4%  */
-	{0, 0}, /* 2459877 - 24 October 2022 - 1%  */
-	{0, 0}, /* 2459878 - 25 October 2022 - 0%  */
-	{0, 1}, /* 2459879 - 26 October 2022 - 1%  */
-	{1, 1}, /* 2459880 - 27 October 2022 - 5%  */
-	{2, 1}, /* 2459881 - 28 October 2022 - 11%  */
-	{3, 1}, /* 2459882 - 29 October 2022 - 20%  */
-	{4, 1}, /* 2459883 - 30 October 2022 - 30%  */
-	{6, 1}, /* 2459884 - 31 October 2022 - 41%  */
-	{7, 1}, /* 2459885 - 1 November 2022 - 52%  */
-	{9, 1}, /* 2459886 - 2 November 2022 - 63%  */
-	{10, 1}, /* 2459887 - 3 November 2022 - 74%  */
-	{12, 1}, /* 2459888 - 4 November 2022 - 83%  */
-	{13, 1}, /* 2459889 - 5 November 2022 - 90%  */
-	{13, 1}, /* 2459890 - 6 November 2022 - 95%  */
-	{14, 1}, /* 2459891 - 7 November 2022 - 99%  */
-	{14, 1}, /* 2459892 - 8 November 2022 - 99%  */
-	{14, 0}, /* 2459893 - 9 November 2022 - 98%  */
-	{13, 0}, /* 2459894 - 10 November 2022 - 95%  */
-	{13, 0}, /* 2459895 - 11 November 2022 - 91%  */
-	{12, 0}, /* 2459896 - 12 November 2022 - 84%  */
-	{11, 0}, /* 2459897 - 13 November 2022 - 77%  */
-	{10, 0}, /* 2459898 - 14 November 2022 - 69%  */
-	{8, 0}, /* 2459899 - 15 November 2022 - 60%  */
-	{7, 0}, /* 2459900 - 16 November 2022 - 50%  */
-	{6, 0}, /* 2459901 - 17 November 2022 - 40%  */
-	{4, 0}, /* 2459902 - 18 November 2022 - 31%  */
-	{3, 0}, /* 2459903 - 19 November 2022 - 22%  */
-	{2, 0}, /* 2459904 - 20 November 2022 - 14%  */
-	{1, 0}, /* 2459905 - 21 November 2022 - 7%  */
-	{0, 0}, /* 2459906 - 22 November 2022 - 2%  */
-	{0, 0}, /* 2459907 - 23 November 2022 - 0%  */
-	{0, 1}, /* 2459908 - 24 November 2022 - 0%  */
-	{0, 1}, /* 2459909 - 25 November 2022 - 3%  */
-	{1, 1}, /* 2459910 - 26 November 2022 - 9%  */
-	{2, 1}, /* 2459911 - 27 November 2022 - 16%  */
-	{4, 1}, /* 2459912 - 28 November 2022 - 26%  */
-	{5, 1}, /* 2459913 - 29 November 2022 - 37%  */
-	{7, 1}, /* 2459914 - 30 November 2022 - 48%  */
-	{8, 1}, /* 2459915 - 1 December 2022 - 59%  */
-	{10, 1}, /* 2459916 - 2 December 2022 - 69%  */
-	{11, 1}, /* 2459917 - 3 December 2022 - 79%  */
-	{12, 1}, /* 2459918 - 4 December 2022 - 87%  */
-	{13, 1}, /* 2459919 - 5 December 2022 - 93%  */
-	{14, 1}, /* 2459920 - 6 December 2022 - 97%  */
-	{14, 1}, /* 2459921 - 7 December 2022 - 99%  */
-	{14, 1}, /* 2459922 - 8 December 2022 - 99%  */
-	{14, 0}, /* 2459923 - 9 December 2022 - 98%  */
-	{13, 0}, /* 2459924 - 10 December 2022 - 95%  */
-	{13, 0}, /* 2459925 - 11 December 2022 - 90%  */
-	{12, 0}, /* 2459926 - 12 December 2022 - 83%  */
-	{11, 0}, /* 2459927 - 13 December 2022 - 76%  */
-	{9, 0}, /* 2459928 - 14 December 2022 - 67%  */
-	{8, 0}, /* 2459929 - 15 December 2022 - 58%  */
-	{7, 0}, /* 2459930 - 16 December 2022 - 48%  */
-	{5, 0}, /* 2459931 - 17 December 2022 - 38%  */
-	{4, 0}, /* 2459932 - 18 December 2022 - 28%  */
-	{3, 0}, /* 2459933 - 19 December 2022 - 19%  */
-	{2, 0}, /* 2459934 - 20 December 2022 - 11%  */
-	{1, 0}, /* 2459935 - 21 December 2022 - 5%  */
-	{0, 0}, /* 2459936 - 22 December 2022 - 1%  */
-	{0, 0}, /* 2459937 - 23 December 2022 - 0%  */
-	{0, 1}, /* 2459938 - 24 December 2022 - 1%  */
-	{1, 1}, /* 2459939 - 25 December 2022 - 6%  */
-	{2, 1}, /* 2459940 - 26 December 2022 - 13%  */
-	{3, 1}, /* 2459941 - 27 December 2022 - 22%  */
-	{5, 1}, /* 2459942 - 28 December 2022 - 32%  */
-	{6, 1}, /* 2459943 - 29 December 2022 - 43%  */
-	{8, 1}, /* 2459944 - 30 December 2022 - 54%  */
-	{9, 1}, /* 2459945 - 31 December 2022 - 64%  */
-	{10, 1}, /* 2459946 - 1 January 2023 - 74%  */
-	{12, 1}, /* 2459947 - 2 January 2023 - 82%  */
-	{13, 1}, /* 2459948 - 3 January 2023 - 89%  */
-	{13, 1}, /* 2459949 - 4 January 2023 - 94%  */
-	{14, 1}, /* 2459950 - 5 January 2023 - 98%  */
-	{14, 1}, /* 2459951 - 6 January 2023 - 99%  */
-	{14, 0}, /* 2459952 - 7 January 2023 - 99%  */
-	{14, 0}, /* 2459953 - 8 January 2023 - 97%  */
-	{13, 0}, /* 2459954 - 9 January 2023 - 94%  */
-	{12, 0}, /* 2459955 - 10 January 2023 - 89%  */
-	{12, 0}, /* 2459956 - 11 January 2023 - 82%  */
-	{10, 0}, /* 2459957 - 12 January 2023 - 74%  */
-	{9, 0}, /* 2459958 - 13 January 2023 - 65%  */
-	{8, 0}, /* 2459959 - 14 January 2023 - 55%  */
-	{6, 0}, /* 2459960 - 15 January 2023 - 45%  */
-	{5, 0}, /* 2459961 - 16 January 2023 - 35%  */
-	{4, 0}, /* 2459962 - 17 January 2023 - 25%  */
-	{2, 0}, /* 2459963 - 18 January 2023 - 15%  */
-	{1, 0}, /* 2459964 - 19 January 2023 - 8%  */
-	{0, 0}, /* 2459965 - 20 January 2023 - 2%  */
-	{0, 0}, /* 2459966 - 21 January 2023 - 0%  */
-	{0, 1}, /* 2459967 - 22 January 2023 - 0%  */
-	{1, 1}, /* 2459968 - 23 January 2023 - 4%  */
-	{1, 1}, /* 2459969 - 24 January 2023 - 10%  */
-	{3, 1}, /* 2459970 - 25 January 2023 - 18%  */
-	{4, 1}, /* 2459971 - 26 January 2023 - 27%  */
-	{5, 1}, /* 2459972 - 27 January 2023 - 37%  */
-	{7, 1}, /* 2459973 - 28 January 2023 - 48%  */
-	{8, 1}, /* 2459974 - 29 January 2023 - 58%  */
-	{10, 1}, /* 2459975 - 30 January 2023 - 68%  */
-	{11, 1}, /* 2459976 - 31 January 2023 - 76%  */
-	{12, 1}, /* 2459977 - 1 February 2023 - 84%  */
-	{13, 1}, /* 2459978 - 2 February 2023 - 90%  */
-	{13, 1}, /* 2459979 - 3 February 2023 - 95%  */
-	{14, 1}, /* 2459980 - 4 February 2023 - 98%  */
-	{14, 1}, /* 2459981 - 5 February 2023 - 99%  */
-	{14, 0}, /* 2459982 - 6 February 2023 - 99%  */
-	{14, 0}, /* 2459983 - 7 February 2023 - 97%  */
-	{13, 0}, /* 2459984 - 8 February 2023 - 93%  */
-	{12, 0}, /* 2459985 - 9 February 2023 - 87%  */
-	{11, 0}, /* 2459986 - 10 February 2023 - 80%  */
-	{10, 0}, /* 2459987 - 11 February 2023 - 71%  */
-	{9, 0}, /* 2459988 - 12 February 2023 - 62%  */
-	{7, 0}, /* 2459989 - 13 February 2023 - 51%  */
-	{6, 0}, /* 2459990 - 14 February 2023 - 40%  */
-	{4, 0}, /* 2459991 - 15 February 2023 - 30%  */
-	{3, 0}, /* 2459992 - 16 February 2023 - 20%  */
-	{2, 0}, /* 2459993 - 17 February 2023 - 11%  */
-	{1, 0}, /* 2459994 - 18 February 2023 - 4%  */
-	{0, 0}, /* 2459995 - 19 February 2023 - 0%  */
-	{0, 0}, /* 2459996 - 20 February 2023 - 0%  */
-	{0, 1}, /* 2459997 - 21 February 2023 - 2%  */
-	{1, 1}, /* 2459998 - 22 February 2023 - 6%  */
-	{2, 1}, /* 2459999 - 23 February 2023 - 13%  */
-	{3, 1}, /* 2460000 - 24 February 2023 - 22%  */
-	{4, 1}, /* 2460001 - 25 February 2023 - 31%  */
-	{6, 1}, /* 2460002 - 26 February 2023 - 41%  */
-	{7, 1}, /* 2460003 - 27 February 2023 - 51%  */
-	{9, 1}, /* 2460004 - 28 February 2023 - 61%  */
-	{10, 1}, /* 2460005 - 1 March 2023 - 70%  */
-	{11, 1}, /* 2460006 - 2 March 2023 - 78%  */
-	{12, 1}, /* 2460007 - 3 March 2023 - 85%  */
-	{13, 1}, /* 2460008 - 4 March 2023 - 91%  */
-	{13, 1}, /* 2460009 - 5 March 2023 - 96%  */
-	{14, 1}, /* 2460010 - 6 March 2023 - 98%  */
-	{14, 1}, /* 2460011 - 7 March 2023 - 99%  */
-	{14, 0}, /* 2460012 - 8 March 2023 - 99%  */
-	{13, 0}, /* 2460013 - 9 March 2023 - 96%  */
-	{13, 0}, /* 2460014 - 10 March 2023 - 91%  */
-	{12, 0}, /* 2460015 - 11 March 2023 - 84%  */
-	{11, 0}, /* 2460016 - 12 March 2023 - 76%  */
-	{9, 0}, /* 2460017 - 13 March 2023 - 67%  */
-	{8, 0}, /* 2460018 - 14 March 2023 - 56%  */
-	{6, 0}, /* 2460019 - 15 March 2023 - 45%  */
-	{5, 0}, /* 2460020 - 16 March 2023 - 34%  */
-	{3, 0}, /* 2460021 - 17 March 2023 - 23%  */
-	{2, 0}, /* 2460022 - 18 March 2023 - 14%  */
-	{1, 0}, /* 2460023 - 19 March 2023 - 7%  */
-	{0, 0}, /* 2460024 - 20 March 2023 - 2%  */
-	{0, 0}, /* 2460025 - 21 March 2023 - 0%  */
-	{0, 1}, /* 2460026 - 22 March 2023 - 0%  */
-	{1, 1}, /* 2460027 - 23 March 2023 - 4%  */
-	{1, 1}, /* 2460028 - 24 March 2023 - 9%  */
-	{2, 1}, /* 2460029 - 25 March 2023 - 16%  */
-	{4, 1}, /* 2460030 - 26 March 2023 - 25%  */
-	{5, 1}, /* 2460031 - 27 March 2023 - 34%  */
-	{6, 1}, /* 2460032 - 28 March 2023 - 44%  */
-	{8, 1}, /* 2460033 - 29 March 2023 - 53%  */
-	{9, 1}, /* 2460034 - 30 March 2023 - 63%  */
-	{10, 1}, /* 2460035 - 31 March 2023 - 71%  */
-	{11, 1}, /* 2460036 - 1 April 2023 - 79%  */
-	{12, 1}, /* 2460037 - 2 April 2023 - 87%  */
-	{13, 1}, /* 2460038 - 3 April 2023 - 92%  */
-	{14, 1}, /* 2460039 - 4 April 2023 - 97%  */
-	{14, 1}, /* 2460040 - 5 April 2023 - 99%  */
-	{14, 1}, /* 2460041 - 6 April 2023 - 99%  */
-	{14, 0}, /* 2460042 - 7 April 2023 - 98%  */
-	{13, 0}, /* 2460043 - 8 April 2023 - 94%  */
-	{12, 0}, /* 2460044 - 9 April 2023 - 88%  */
-	{11, 0}, /* 2460045 - 10 April 2023 - 80%  */
-	{10, 0}, /* 2460046 - 11 April 2023 - 70%  */
-	{8, 0}, /* 2460047 - 12 April 2023 - 59%  */
-	{7, 0}, /* 2460048 - 13 April 2023 - 48%  */
-	{5, 0}, /* 2460049 - 14 April 2023 - 37%  */
-	{4, 0}, /* 2460050 - 15 April 2023 - 26%  */
-	{2, 0}, /* 2460051 - 16 April 2023 - 16%  */
-	{1, 0}, /* 2460052 - 17 April 2023 - 9%  */
-	{1, 0}, /* 2460053 - 18 April 2023 - 3%  */
-	{0, 0}, /* 2460054 - 19 April 2023 - 0%  */
-	{0, 0}, /* 2460055 - 20 April 2023 - 0%  */
-	{0, 1}, /* 2460056 - 21 April 2023 - 2%  */
-	{1, 1}, /* 2460057 - 22 April 2023 - 6%  */
-	{2, 1}, /* 2460058 - 23 April 2023 - 12%  */
-	{3, 1}, /* 2460059 - 24 April 2023 - 19%  */
-	{4, 1}, /* 2460060 - 25 April 2023 - 27%  */
-	{5, 1}, /* 2460061 - 26 April 2023 - 36%  */
-	{6, 1}, /* 2460062 - 27 April 2023 - 46%  */
-	{8, 1}, /* 2460063 - 28 April 2023 - 55%  */
-	{9, 1}, /* 2460064 - 29 April 2023 - 65%  */
-	{10, 1}, /* 2460065 - 30 April 2023 - 73%  */
-	{11, 1}, /* 2460066 - 1 May 2023 - 81%  */
-	{12, 1}, /* 2460067 - 2 May 2023 - 88%  */
-	{13, 1}, /* 2460068 - 3 May 2023 - 94%  */
-	{14, 1}, /* 2460069 - 4 May 2023 - 98%  */
-	{14, 1}, /* 2460070 - 5 May 2023 - 99%  */
-	{14, 0}, /* 2460071 - 6 May 2023 - 99%  */
-	{13, 0}, /* 2460072 - 7 May 2023 - 96%  */
-	{13, 0}, /* 2460073 - 8 May 2023 - 90%  */
-	{12, 0}, /* 2460074 - 9 May 2023 - 82%  */
-	{10, 0}, /* 2460075 - 10 May 2023 - 73%  */
-	{9, 0}, /* 2460076 - 11 May 2023 - 62%  */
-	{7, 0}, /* 2460077 - 12 May 2023 - 51%  */
-	{6, 0}, /* 2460078 - 13 May 2023 - 39%  */
-	{4, 0}, /* 2460079 - 14 May 2023 - 29%  */
-	{3, 0}, /* 2460080 - 15 May 2023 - 19%  */
-	{2, 0}, /* 2460081 - 16 May 2023 - 11%  */
-	{1, 0}, /* 2460082 - 17 May 2023 - 5%  */
-	{0, 0}, /* 2460083 - 18 May 2023 - 1%  */
-	{0, 0}, /* 2460084 - 19 May 2023 - 0%  */
-	{0, 1}, /* 2460085 - 20 May 2023 - 0%  */
-	{1, 1}, /* 2460086 - 21 May 2023 - 3%  */
-	{1, 1}, /* 2460087 - 22 May 2023 - 8%  */
-	{2, 1}, /* 2460088 - 23 May 2023 - 14%  */
-	{3, 1}, /* 2460089 - 24 May 2023 - 21%  */
-	{4, 1}, /* 2460090 - 25 May 2023 - 30%  */
-	{5, 1}, /* 2460091 - 26 May 2023 - 39%  */
-	{7, 1}, /* 2460092 - 27 May 2023 - 48%  */
-	{8, 1}, /* 2460093 - 28 May 2023 - 58%  */
-	{9, 1}, /* 2460094 - 29 May 2023 - 67%  */
-	{11, 1}, /* 2460095 - 30 May 2023 - 76%  */
-	{12, 1}, /* 2460096 - 31 May 2023 - 84%  */
-	{13, 1}, /* 2460097 - 1 June 2023 - 91%  */
-	{14, 1}, /* 2460098 - 2 June 2023 - 96%  */
-	{14, 1}, /* 2460099 - 3 June 2023 - 99%  */
-	{14, 1}, /* 2460100 - 4 June 2023 - 99%  */
-	{14, 0}, /* 2460101 - 5 June 2023 - 97%  */
-	{13, 0}, /* 2460102 - 6 June 2023 - 92%  */
-	{12, 0}, /* 2460103 - 7 June 2023 - 84%  */
-	{11, 0}, /* 2460104 - 8 June 2023 - 75%  */
-	{9, 0}, /* 2460105 - 9 June 2023 - 64%  */
-	{8, 0}, /* 2460106 - 10 June 2023 - 53%  */
-	{6, 0}, /* 2460107 - 11 June 2023 - 42%  */
-	{4, 0}, /* 2460108 - 12 June 2023 - 31%  */
-	{3, 0}, /* 2460109 - 13 June 2023 - 22%  */
-	{2, 0}, /* 2460110 - 14 June 2023 - 13%  */
-	{1, 0}, /* 2460111 - 15 June 2023 - 7%  */
-	{0, 0}, /* 2460112 - 16 June 2023 - 2%  */
-	{0, 0}, /* 2460113 - 17 June 2023 - 0%  */
-	{0, 0}, /* 2460114 - 18 June 2023 - 0%  */
-	{0, 1}, /* 2460115 - 19 June 2023 - 1%  */
-	{1, 1}, /* 2460116 - 20 June 2023 - 5%  */
-	{1, 1}, /* 2460117 - 21 June 2023 - 10%  */
-	{2, 1}, /* 2460118 - 22 June 2023 - 16%  */
-	{3, 1}, /* 2460119 - 23 June 2023 - 24%  */
-	{5, 1}, /* 2460120 - 24 June 2023 - 32%  */
-	{6, 1}, /* 2460121 - 25 June 2023 - 42%  */
-	{7, 1}, /* 2460122 - 26 June 2023 - 51%  */
-	{9, 1}, /* 2460123 - 27 June 2023 - 61%  */
-	{10, 1}, /* 2460124 - 28 June 2023 - 71%  */
-	{11, 1}, /* 2460125 - 29 June 2023 - 80%  */
-	{12, 1}, /* 2460126 - 30 June 2023 - 88%  */
-	{13, 1}, /* 2460127 - 1 July 2023 - 94%  */
-	{14, 1}, /* 2460128 - 2 July 2023 - 98%  */
-	{14, 1}, /* 2460129 - 3 July 2023 - 99%  */
-	{14, 0}, /* 2460130 - 4 July 2023 - 98%  */
-	{13, 0}, /* 2460131 - 5 July 2023 - 93%  */
-	{12, 0}, /* 2460132 - 6 July 2023 - 86%  */
-	{11, 0}, /* 2460133 - 7 July 2023 - 77%  */
-	{9, 0}, /* 2460134 - 8 July 2023 - 67%  */
-	{8, 0}, /* 2460135 - 9 July 2023 - 56%  */
-	{6, 0}, /* 2460136 - 10 July 2023 - 45%  */
-	{5, 0}, /* 2460137 - 11 July 2023 - 34%  */
-	{4, 0}, /* 2460138 - 12 July 2023 - 25%  */
-	{2, 0}, /* 2460139 - 13 July 2023 - 16%  */
-	{1, 0}, /* 2460140 - 14 July 2023 - 9%  */
-	{1, 0}, /* 2460141 - 15 July 2023 - 4%  */
-	{0, 0}, /* 2460142 - 16 July 2023 - 1%  */
-	{0, 0}, /* 2460143 - 17 July 2023 - 0%  */
-	{0, 1}, /* 2460144 - 18 July 2023 - 0%  */
-	{0, 1}, /* 2460145 - 19 July 2023 - 2%  */
-	{1, 1}, /* 2460146 - 20 July 2023 - 6%  */
-	{2, 1}, /* 2460147 - 21 July 2023 - 12%  */
-	{3, 1}, /* 2460148 - 22 July 2023 - 19%  */
-	{4, 1}, /* 2460149 - 23 July 2023 - 27%  */
-	{5, 1}, /* 2460150 - 24 July 2023 - 36%  */
-	{6, 1}, /* 2460151 - 25 July 2023 - 45%  */
-	{8, 1}, /* 2460152 - 26 July 2023 - 56%  */
-	{9, 1}, /* 2460153 - 27 July 2023 - 66%  */
-	{11, 1}, /* 2460154 - 28 July 2023 - 76%  */
-	{12, 1}, /* 2460155 - 29 July 2023 - 85%  */
-	{13, 1}, /* 2460156 - 30 July 2023 - 92%  */
-	{14, 1}, /* 2460157 - 31 July 2023 - 97%  */
-	{14, 1}, /* 2460158 - 1 August 2023 - 99%  */
-	{14, 0}, /* 2460159 - 2 August 2023 - 99%  */
-	{13, 0}, /* 2460160 - 3 August 2023 - 95%  */
-	{12, 0}, /* 2460161 - 4 August 2023 - 89%  */
-	{11, 0}, /* 2460162 - 5 August 2023 - 80%  */
-	{10, 0}, /* 2460163 - 6 August 2023 - 70%  */
-	{8, 0}, /* 2460164 - 7 August 2023 - 60%  */
-	{7, 0}, /* 2460165 - 8 August 2023 - 49%  */
-	{5, 0}, /* 2460166 - 9 August 2023 - 38%  */
-	{4, 0}, /* 2460167 - 10 August 2023 - 29%  */
-	{3, 0}, /* 2460168 - 11 August 2023 - 20%  */
-	{2, 0}, /* 2460169 - 12 August 2023 - 13%  */
-	{1, 0}, /* 2460170 - 13 August 2023 - 7%  */
-	{0, 0}, /* 2460171 - 14 August 2023 - 3%  */
-	{0, 0}, /* 2460172 - 15 August 2023 - 0%  */
-	{0, 0}, /* 2460173 - 16 August 2023 - 0%  */
-	{0, 1}, /* 2460174 - 17 August 2023 - 1%  */
-	{1, 1}, /* 2460175 - 18 August 2023 - 3%  */
-	{1, 1}, /* 2460176 - 19 August 2023 - 8%  */
-	{2, 1}, /* 2460177 - 20 August 2023 - 14%  */
-	{3, 1}, /* 2460178 - 21 August 2023 - 22%  */
-	{4, 1}, /* 2460179 - 22 August 2023 - 30%  */
-	{6, 1}, /* 2460180 - 23 August 2023 - 40%  */
-	{7, 1}, /* 2460181 - 24 August 2023 - 51%  */
-	{9, 1}, /* 2460182 - 25 August 2023 - 61%  */
-	{10, 1}, /* 2460183 - 26 August 2023 - 72%  */
-	{11, 1}, /* 2460184 - 27 August 2023 - 81%  */
-	{13, 1}, /* 2460185 - 28 August 2023 - 90%  */
-	{13, 1}, /* 2460186 - 29 August 2023 - 96%  */
-	{14, 1}, /* 2460187 - 30 August 2023 - 99%  */
-	{14, 1}, /* 2460188 - 31 August 2023 - 99%  */
-	{14, 0}, /* 2460189 - 1 September 2023 - 96%  */
-	{13, 0}, /* 2460190 - 2 September 2023 - 91%  */
-	{12, 0}, /* 2460191 - 3 September 2023 - 83%  */
-	{10, 0}, /* 2460192 - 4 September 2023 - 74%  */
-	{9, 0}, /* 2460193 - 5 September 2023 - 64%  */
-	{8, 0}, /* 2460194 - 6 September 2023 - 54%  */
-	{6, 0}, /* 2460195 - 7 September 2023 - 44%  */
-	{5, 0}, /* 2460196 - 8 September 2023 - 34%  */
-	{4, 0}, /* 2460197 - 9 September 2023 - 25%  */
-	{2, 0}, /* 2460198 - 10 September 2023 - 17%  */
-	{2, 0}, /* 2460199 - 11 September 2023 - 11%  */
-	{1, 0}, /* 2460200 - 12 September 2023 - 5%  */
-	{0, 0}, /* 2460201 - 13 September 2023 - 2%  */
-	{0, 0}, /* 2460202 - 14 September 2023 - 0%  */
-	{0, 0}, /* 2460203 - 15 September 2023 - 0%  */
-	{0, 1}, /* 2460204 - 16 September 2023 - 1%  */
-	{1, 1}, /* 2460205 - 17 September 2023 - 5%  */
-	{2, 1}, /* 2460206 - 18 September 2023 - 10%  */
-	{2, 1}, /* 2460207 - 19 September 2023 - 17%  */
-	{4, 1}, /* 2460208 - 20 September 2023 - 26%  */
-	{5, 1}, /* 2460209 - 21 September 2023 - 36%  */
-	{7, 1}, /* 2460210 - 22 September 2023 - 46%  */
-	{8, 1}, /* 2460211 - 23 September 2023 - 57%  */
-	{10, 1}, /* 2460212 - 24 September 2023 - 68%  */
-	{11, 1}, /* 2460213 - 25 September 2023 - 78%  */
-	{12, 1}, /* 2460214 - 26 September 2023 - 87%  */
-	{13, 1}, /* 2460215 - 27 September 2023 - 94%  */
-	{14, 1}, /* 2460216 - 28 September 2023 - 98%  */
-	{14, 1}, /* 2460217 - 29 September 2023 - 99%  */
-	{14, 0}, /* 2460218 - 30 September 2023 - 98%  */
-	{13, 0}, /* 2460219 - 1 October 2023 - 93%  */
-	{12, 0}, /* 2460220 - 2 October 2023 - 87%  */
-	{11, 0}, /* 2460221 - 3 October 2023 - 79%  */
-	{10, 0}, /* 2460222 - 4 October 2023 - 70%  */
-	{8, 0}, /* 2460223 - 5 October 2023 - 60%  */
-	{7, 0}, /* 2460224 - 6 October 2023 - 50%  */
-	{6, 0}, /* 2460225 - 7 October 2023 - 41%  */
-	{4, 0}, /* 2460226 - 8 October 2023 - 31%  */
-	{3, 0}, /* 2460227 - 9 October 2023 - 23%  */
-	{2, 0}, /* 2460228 - 10 October 2023 - 16%  */
-	{1, 0}, /* 2460229 - 11 October 2023 - 9%  */
-	{1, 0}, /* 2460230 - 12 October 2023 - 4%  */
-	{0, 0}, /* 2460231 - 13 October 2023 - 1%  */
-	{0, 0}, /* 2460232 - 14 October 2023 - 0%  */
-	{0, 1}, /* 2460233 - 15 October 2023 - 0%  */
-	{0, 1}, /* 2460234 - 16 October 2023 - 3%  */
-	{1, 1}, /* 2460235 - 17 October 2023 - 7%  */
-	{2, 1}, /* 2460236 - 18 October 2023 - 14%  */
-	{3, 1}, /* 2460237 - 19 October 2023 - 22%  */
-	{4, 1}, /* 2460238 - 20 October 2023 - 32%  */
-	{6, 1}, /* 2460239 - 21 October 2023 - 42%  */
-	{8, 1}, /* 2460240 - 22 October 2023 - 54%  */
-	{9, 1}, /* 2460241 - 23 October 2023 - 65%  */
-	{11, 1}, /* 2460242 - 24 October 2023 - 75%  */
-	{12, 1}, /* 2460243 - 25 October 2023 - 85%  */
-	{13, 1}, /* 2460244 - 26 October 2023 - 92%  */
-	{14, 1}, /* 2460245 - 27 October 2023 - 97%  */
-	{14, 1}, /* 2460246 - 28 October 2023 - 99%  */
-	{14, 0}, /* 2460247 - 29 October 2023 - 99%  */
-	{14, 0}, /* 2460248 - 30 October 2023 - 96%  */
-	{13, 0}, /* 2460249 - 31 October 2023 - 91%  */
-	{12, 0}, /* 2460250 - 1 November 2023 - 84%  */
-	{11, 0}, /* 2460251 - 2 November 2023 - 76%  */
-	{9, 0}, /* 2460252 - 3 November 2023 - 67%  */
-	{8, 0}, /* 2460253 - 4 November 2023 - 58%  */
-	{7, 0}, /* 2460254 - 5 November 2023 - 48%  */
-	{6, 0}, /* 2460255 - 6 November 2023 - 39%  */
-	{4, 0}, /* 2460256 - 7 November 2023 - 30%  */
-	{3, 0}, /* 2460257 - 8 November 2023 - 22%  */
-	{2, 0}, /* 2460258 - 9 November 2023 - 14%  */
-	{1, 0}, /* 2460259 - 10 November 2023 - 8%  */
-	{1, 0}, /* 2460260 - 11 November 2023 - 3%  */
-	{0, 0}, /* 2460261 - 12 November 2023 - 0%  */
-	{0, 0}, /* 2460262 - 13 November 2023 - 0%  */
-	{0, 1}, /* 2460263 - 14 November 2023 - 1%  */
-	{1, 1}, /* 2460264 - 15 November 2023 - 5%  */
-	{2, 1}, /* 2460265 - 16 November 2023 - 10%  */
-	{3, 1}, /* 2460266 - 17 November 2023 - 18%  */
-	{4, 1}, /* 2460267 - 18 November 2023 - 28%  */
-	{5, 1}, /* 2460268 - 19 November 2023 - 39%  */
-	{7, 1}, /* 2460269 - 20 November 2023 - 50%  */
-	{9, 1}, /* 2460270 - 21 November 2023 - 61%  */
-	{10, 1}, /* 2460271 - 22 November 2023 - 72%  */
-	{11, 1}, /* 2460272 - 23 November 2023 - 82%  */
-	{13, 1}, /* 2460273 - 24 November 2023 - 89%  */
-	{13, 1}, /* 2460274 - 25 November 2023 - 95%  */
-	{14, 1}, /* 2460275 - 26 November 2023 - 99%  */
-	{14, 1}, /* 2460276 - 27 November 2023 - 99%  */
-	{14, 0}, /* 2460277 - 28 November 2023 - 98%  */
-	{13, 0}, /* 2460278 - 29 November 2023 - 94%  */
-	{13, 0}, /* 2460279 - 30 November 2023 - 89%  */
-	{12, 0}, /* 2460280 - 1 December 2023 - 82%  */
-	{10, 0}, /* 2460281 - 2 December 2023 - 74%  */
-	{9, 0}, /* 2460282 - 3 December 2023 - 66%  */
-	{8, 0}, /* 2460283 - 4 December 2023 - 57%  */
-	{7, 0}, /* 2460284 - 5 December 2023 - 47%  */
-	{5, 0}, /* 2460285 - 6 December 2023 - 38%  */
-	{4, 0}, /* 2460286 - 7 December 2023 - 29%  */
-	{3, 0}, /* 2460287 - 8 December 2023 - 20%  */
-	{2, 0}, /* 2460288 - 9 December 2023 - 13%  */
-	{1, 0}, /* 2460289 - 10 December 2023 - 7%  */
-	{0, 0}, /* 2460290 - 11 December 2023 - 2%  */
-	{0, 0}, /* 2460291 - 12 December 2023 - 0%  */
-	{0, 1}, /* 2460292 - 13 December 2023 - 0%  */
-	{0, 1}, /* 2460293 - 14 December 2023 - 2%  */
-	{1, 1}, /* 2460294 - 15 December 2023 - 8%  */
-	{2, 1}, /* 2460295 - 16 December 2023 - 15%  */
-	{3, 1}, /* 2460296 - 17 December 2023 - 24%  */
-	{5, 1}, /* 2460297 - 18 December 2023 - 35%  */
-	{7, 1}, /* 2460298 - 19 December 2023 - 46%  */
-	{8, 1}, /* 2460299 - 20 December 2023 - 58%  */
-	{10, 1}, /* 2460300 - 21 December 2023 - 68%  */
-	{11, 1}, /* 2460301 - 22 December 2023 - 78%  */
-	{12, 1}, /* 2460302 - 23 December 2023 - 86%  */
-	{13, 1}, /* 2460303 - 24 December 2023 - 93%  */
-	{14, 1}, /* 2460304 - 25 December 2023 - 97%  */
-	{14, 1}, /* 2460305 - 26 December 2023 - 99%  */
-	{14, 1}, /* 2460306 - 27 December 2023 - 99%  */
-	{14, 0}, /* 2460307 - 28 December 2023 - 97%  */
-	{13, 0}, /* 2460308 - 29 December 2023 - 93%  */
-	{12, 0}, /* 2460309 - 30 December 2023 - 88%  */
-	{11, 0}, /* 2460310 - 31 December 2023 - 81%  */
-	{10, 0}, /* 2460311 - 1 January 2024 - 73%  */
-	{9, 0}, /* 2460312 - 2 January 2024 - 65%  */
-	{8, 0}, /* 2460313 - 3 January 2024 - 56%  */
-	{7, 0}, /* 2460314 - 4 January 2024 - 46%  */
-	{5, 0}, /* 2460315 - 5 January 2024 - 36%  */
-	{4, 0}, /* 2460316 - 6 January 2024 - 27%  */
-	{3, 0}, /* 2460317 - 7 January 2024 - 18%  */
-	{2, 0}, /* 2460318 - 8 January 2024 - 11%  */
-	{1, 0}, /* 2460319 - 9 January 2024 - 5%  */
-	{0, 0}, /* 2460320 - 10 January 2024 - 1%  */
-	{0, 0}, /* 2460321 - 11 January 2024 - 0%  */
-	{0, 1}, /* 2460322 - 12 January 2024 - 1%  */
-	{1, 1}, /* 2460323 - 13 January 2024 - 5%  */
-	{2, 1}, /* 2460324 - 14 January 2024 - 12%  */
-	{3, 1}, /* 2460325 - 15 January 2024 - 21%  */
-	{4, 1}, /* 2460326 - 16 January 2024 - 31%  */
-	{6, 1}, /* 2460327 - 17 January 2024 - 42%  */
-	{8, 1}, /* 2460328 - 18 January 2024 - 53%  */
-	{9, 1}, /* 2460329 - 19 January 2024 - 64%  */
-	{10, 1}, /* 2460330 - 20 January 2024 - 74%  */
-	{12, 1}, /* 2460331 - 21 January 2024 - 82%  */
-	{13, 1}, /* 2460332 - 22 January 2024 - 89%  */
-	{13, 1}, /* 2460333 - 23 January 2024 - 95%  */
-	{14, 1}, /* 2460334 - 24 January 2024 - 98%  */
-	{14, 1}, /* 2460335 - 25 January 2024 - 99%  */
-	{14, 0}, /* 2460336 - 26 January 2024 - 99%  */
-	{14, 0}, /* 2460337 - 27 January 2024 - 97%  */
-	{13, 0}, /* 2460338 - 28 January 2024 - 93%  */
-	{12, 0}, /* 2460339 - 29 January 2024 - 87%  */
-	{11, 0}, /* 2460340 - 30 January 2024 - 80%  */
-	{10, 0}, /* 2460341 - 31 January 2024 - 72%  */
-	{9, 0}, /* 2460342 - 1 February 2024 - 64%  */
-	{8, 0}, /* 2460343 - 2 February 2024 - 54%  */
-	{6, 0}, /* 2460344 - 3 February 2024 - 44%  */
-	{5, 0}, /* 2460345 - 4 February 2024 - 34%  */
-	{3, 0}, /* 2460346 - 5 February 2024 - 24%  */
-	{2, 0}, /* 2460347 - 6 February 2024 - 16%  */
-	{1, 0}, /* 2460348 - 7 February 2024 - 8%  */
-	{0, 0}, /* 2460349 - 8 February 2024 - 3%  */
-	{0, 0}, /* 2460350 - 9 February 2024 - 0%  */
-	{0, 1}, /* 2460351 - 10 February 2024 - 0%  */
-	{0, 1}, /* 2460352 - 11 February 2024 - 3%  */
-	{1, 1}, /* 2460353 - 12 February 2024 - 9%  */
-	{2, 1}, /* 2460354 - 13 February 2024 - 17%  */
-	{4, 1}, /* 2460355 - 14 February 2024 - 27%  */
-	{5, 1}, /* 2460356 - 15 February 2024 - 37%  */
-	{7, 1}, /* 2460357 - 16 February 2024 - 48%  */
-	{8, 1}, /* 2460358 - 17 February 2024 - 59%  */
-	{10, 1}, /* 2460359 - 18 February 2024 - 69%  */
-	{11, 1}, /* 2460360 - 19 February 2024 - 78%  */
-	{12, 1}, /* 2460361 - 20 February 2024 - 85%  */
-	{13, 1}, /* 2460362 - 21 February 2024 - 91%  */
-	{13, 1}, /* 2460363 - 22 February 2024 - 96%  */
-	{14, 1}, /* 2460364 - 23 February 2024 - 99%  */
-	{14, 1}, /* 2460365 - 24 February 2024 - 99%  */
-	{14, 0}, /* 2460366 - 25 February 2024 - 99%  */
-	{14, 0}, /* 2460367 - 26 February 2024 - 96%  */
-	{13, 0}, /* 2460368 - 27 February 2024 - 92%  */
-	{12, 0}, /* 2460369 - 28 February 2024 - 86%  */
-	{11, 0}, /* 2460370 - 29 February 2024 - 79%  */
-	{10, 0}, /* 2460371 - 1 March 2024 - 70%  */
-	{9, 0}, /* 2460372 - 2 March 2024 - 61%  */
-	{7, 0}, /* 2460373 - 3 March 2024 - 51%  */
-	{6, 0}, /* 2460374 - 4 March 2024 - 40%  */
-	{4, 0}, /* 2460375 - 5 March 2024 - 30%  */
-	{3, 0}, /* 2460376 - 6 March 2024 - 20%  */
-	{2, 0}, /* 2460377 - 7 March 2024 - 12%  */
-	{1, 0}, /* 2460378 - 8 March 2024 - 5%  */
-	{0, 0}, /* 2460379 - 9 March 2024 - 1%  */
-	{0, 0}, /* 2460380 - 10 March 2024 - 0%  */
-	{0, 1}, /* 2460381 - 11 March 2024 - 1%  */
-	{1, 1}, /* 2460382 - 12 March 2024 - 6%  */
-	{2, 1}, /* 2460383 - 13 March 2024 - 13%  */
-	{3, 1}, /* 2460384 - 14 March 2024 - 22%  */
-	{5, 1}, /* 2460385 - 15 March 2024 - 32%  */
-	{6, 1}, /* 2460386 - 16 March 2024 - 42%  */
-	{7, 1}, /* 2460387 - 17 March 2024 - 53%  */
-	{9, 1}, /* 2460388 - 18 March 2024 - 63%  */
-	{10, 1}, /* 2460389 - 19 March 2024 - 72%  */
-	{11, 1}, /* 2460390 - 20 March 2024 - 80%  */
-	{12, 1}, /* 2460391 - 21 March 2024 - 87%  */
-	{13, 1}, /* 2460392 - 22 March 2024 - 93%  */
-	{14, 1}, /* 2460393 - 23 March 2024 - 97%  */
-	{14, 1}, /* 2460394 - 24 March 2024 - 99%  */
-	{14, 1}, /* 2460395 - 25 March 2024 - 99%  */
-	{14, 0}, /* 2460396 - 26 March 2024 - 98%  */
-	{13, 0}, /* 2460397 - 27 March 2024 - 95%  */
-	{13, 0}, /* 2460398 - 28 March 2024 - 90%  */
-	{12, 0}, /* 2460399 - 29 March 2024 - 84%  */
-	{11, 0}, /* 2460400 - 30 March 2024 - 76%  */
-	{9, 0}, /* 2460401 - 31 March 2024 - 67%  */
-	{8, 0}, /* 2460402 - 1 April 2024 - 56%  */
-	{6, 0}, /* 2460403 - 2 April 2024 - 46%  */
-	{5, 0}, /* 2460404 - 3 April 2024 - 35%  */
-	{3, 0}, /* 2460405 - 4 April 2024 - 24%  */
-	{2, 0}, /* 2460406 - 5 April 2024 - 15%  */
-	{1, 0}, /* 2460407 - 6 April 2024 - 7%  */
-	{0, 0}, /* 2460408 - 7 April 2024 - 2%  */
-	{0, 0}, /* 2460409 - 8 April 2024 - 0%  */
-	{0, 1}, /* 2460410 - 9 April 2024 - 0%  */
-	{1, 1}, /* 2460411 - 10 April 2024 - 4%  */
-	{1, 1}, /* 2460412 - 11 April 2024 - 10%  */
-	{3, 1}, /* 2460413 - 12 April 2024 - 18%  */
-	{4, 1}, /* 2460414 - 13 April 2024 - 27%  */
-	{5, 1}, /* 2460415 - 14 April 2024 - 36%  */
-	{7, 1}, /* 2460416 - 15 April 2024 - 46%  */
-	{8, 1}, /* 2460417 - 16 April 2024 - 56%  */
-	{9, 1}, /* 2460418 - 17 April 2024 - 66%  */
-	{10, 1}, /* 2460419 - 18 April 2024 - 74%  */
-	{12, 1}, /* 2460420 - 19 April 2024 - 82%  */
-	{12, 1}, /* 2460421 - 20 April 2024 - 89%  */
-	{13, 1}, /* 2460422 - 21 April 2024 - 94%  */
-	{14, 1}, /* 2460423 - 22 April 2024 - 97%  */
-	{14, 1}, /* 2460424 - 23 April 2024 - 99%  */
-	{14, 0}, /* 2460425 - 24 April 2024 - 99%  */
-	{14, 0}, /* 2460426 - 25 April 2024 - 97%  */
-	{13, 0}, /* 2460427 - 26 April 2024 - 93%  */
-	{12, 0}, /* 2460428 - 27 April 2024 - 87%  */
-	{11, 0}, /* 2460429 - 28 April 2024 - 80%  */
-	{10, 0}, /* 2460430 - 29 April 2024 - 71%  */
-	{9, 0}, /* 2460431 - 30 April 2024 - 60%  */
-	{7, 0}, /* 2460432 - 1 May 2024 - 49%  */
-	{5, 0}, /* 2460433 - 2 May 2024 - 38%  */
-	{4, 0}, /* 2460434 - 3 May 2024 - 27%  */
-	{2, 0}, /* 2460435 - 4 May 2024 - 17%  */
-	{1, 0}, /* 2460436 - 5 May 2024 - 9%  */
-	{1, 0}, /* 2460437 - 6 May 2024 - 3%  */
-	{0, 0}, /* 2460438 - 7 May 2024 - 0%  */
-	{0, 0}, /* 2460439 - 8 May 2024 - 0%  */
-	{0, 1}, /* 2460440 - 9 May 2024 - 2%  */
-	{1, 1}, /* 2460441 - 10 May 2024 - 7%  */
-	{2, 1}, /* 2460442 - 11 May 2024 - 13%  */
-	{3, 1}, /* 2460443 - 12 May 2024 - 21%  */
-	{4, 1}, /* 2460444 - 13 May 2024 - 30%  */
-	{6, 1}, /* 2460445 - 14 May 2024 - 40%  */
-	{7, 1}, /* 2460446 - 15 May 2024 - 49%  */
-	{8, 1}, /* 2460447 - 16 May 2024 - 59%  */
-	{10, 1}, /* 2460448 - 17 May 2024 - 68%  */
-	{11, 1}, /* 2460449 - 18 May 2024 - 76%  */
-	{12, 1}, /* 2460450 - 19 May 2024 - 84%  */
-	{13, 1}, /* 2460451 - 20 May 2024 - 90%  */
-	{13, 1}, /* 2460452 - 21 May 2024 - 95%  */
-	{14, 1}, /* 2460453 - 22 May 2024 - 98%  */
-	{14, 1}, /* 2460454 - 23 May 2024 - 99%  */
-	{14, 0}, /* 2460455 - 24 May 2024 - 99%  */
-	{13, 0}, /* 2460456 - 25 May 2024 - 95%  */
-	{13, 0}, /* 2460457 - 26 May 2024 - 90%  */
-	{12, 0}, /* 2460458 - 27 May 2024 - 83%  */
-	{10, 0}, /* 2460459 - 28 May 2024 - 74%  */
-	{9, 0}, /* 2460460 - 29 May 2024 - 63%  */
-	{7, 0}, /* 2460461 - 30 May 2024 - 52%  */
-	{6, 0}, /* 2460462 - 31 May 2024 - 41%  */
-	{4, 0}, /* 2460463 - 1 June 2024 - 30%  */
-	{3, 0}, /* 2460464 - 2 June 2024 - 20%  */
-	{2, 0}, /* 2460465 - 3 June 2024 - 11%  */
-	{1, 0}, /* 2460466 - 4 June 2024 - 5%  */
-	{0, 0}, /* 2460467 - 5 June 2024 - 1%  */
-	{0, 0}, /* 2460468 - 6 June 2024 - 0%  */
-	{0, 1}, /* 2460469 - 7 June 2024 - 1%  */
-	{1, 1}, /* 2460470 - 8 June 2024 - 4%  */
-	{1, 1}, /* 2460471 - 9 June 2024 - 10%  */
-	{2, 1}, /* 2460472 - 10 June 2024 - 16%  */
-	{4, 1}, /* 2460473 - 11 June 2024 - 25%  */
-	{5, 1}, /* 2460474 - 12 June 2024 - 33%  */
-	{6, 1}, /* 2460475 - 13 June 2024 - 43%  */
-	{7, 1}, /* 2460476 - 14 June 2024 - 52%  */
-	{9, 1}, /* 2460477 - 15 June 2024 - 61%  */
-	{10, 1}, /* 2460478 - 16 June 2024 - 70%  */
-	{11, 1}, /* 2460479 - 17 June 2024 - 79%  */
-	{12, 1}, /* 2460480 - 18 June 2024 - 86%  */
-	{13, 1}, /* 2460481 - 19 June 2024 - 92%  */
-	{14, 1}, /* 2460482 - 20 June 2024 - 97%  */
-	{14, 1}, /* 2460483 - 21 June 2024 - 99%  */
-	{14, 1}, /* 2460484 - 22 June 2024 - 99%  */
-	{14, 0}, /* 2460485 - 23 June 2024 - 97%  */
-	{13, 0}, /* 2460486 - 24 June 2024 - 92%  */
-	{12, 0}, /* 2460487 - 25 June 2024 - 85%  */
-	{11, 0}, /* 2460488 - 26 June 2024 - 76%  */
-	{9, 0}, /* 2460489 - 27 June 2024 - 66%  */
-	{8, 0}, /* 2460490 - 28 June 2024 - 54%  */
-	{6, 0}, /* 2460491 - 29 June 2024 - 43%  */
-	{5, 0}, /* 2460492 - 30 June 2024 - 32%  */
-	{3, 0}, /* 2460493 - 1 July 2024 - 22%  */
-	{2, 0}, /* 2460494 - 2 July 2024 - 13%  */
-	{1, 0}, /* 2460495 - 3 July 2024 - 6%  */
-	{0, 0}, /* 2460496 - 4 July 2024 - 2%  */
-	{0, 0}, /* 2460497 - 5 July 2024 - 0%  */
-	{0, 1}, /* 2460498 - 6 July 2024 - 0%  */
-	{0, 1}, /* 2460499 - 7 July 2024 - 2%  */
-	{1, 1}, /* 2460500 - 8 July 2024 - 6%  */
-	{2, 1}, /* 2460501 - 9 July 2024 - 12%  */
-	{3, 1}, /* 2460502 - 10 July 2024 - 19%  */
-	{4, 1}, /* 2460503 - 11 July 2024 - 27%  */
-	{5, 1}, /* 2460504 - 12 July 2024 - 36%  */
-	{6, 1}, /* 2460505 - 13 July 2024 - 45%  */
-	{8, 1}, /* 2460506 - 14 July 2024 - 55%  */
-	{9, 1}, /* 2460507 - 15 July 2024 - 64%  */
-	{10, 1}, /* 2460508 - 16 July 2024 - 73%  */
-	{12, 1}, /* 2460509 - 17 July 2024 - 82%  */
-	{13, 1}, /* 2460510 - 18 July 2024 - 89%  */
-	{13, 1}, /* 2460511 - 19 July 2024 - 95%  */
-	{14, 1}, /* 2460512 - 20 July 2024 - 98%  */
-	{14, 1}, /* 2460513 - 21 July 2024 - 99%  */
-	{14, 0}, /* 2460514 - 22 July 2024 - 98%  */
-	{13, 0}, /* 2460515 - 23 July 2024 - 94%  */
-	{12, 0}, /* 2460516 - 24 July 2024 - 87%  */
-	{11, 0}, /* 2460517 - 25 July 2024 - 78%  */
-	{10, 0}, /* 2460518 - 26 July 2024 - 68%  */
-	{8, 0}, /* 2460519 - 27 July 2024 - 57%  */
-	{6, 0}, /* 2460520 - 28 July 2024 - 45%  */
-	{5, 0}, /* 2460521 - 29 July 2024 - 34%  */
-	{3, 0}, /* 2460522 - 30 July 2024 - 24%  */
-	{2, 0}, /* 2460523 - 31 July 2024 - 16%  */
-	{1, 0}, /* 2460524 - 1 August 2024 - 9%  */
-	{1, 0}, /* 2460525 - 2 August 2024 - 3%  */
-	{0, 0}, /* 2460526 - 3 August 2024 - 0%  */
-	{0, 0}, /* 2460527 - 4 August 2024 - 0%  */
-	{0, 1}, /* 2460528 - 5 August 2024 - 1%  */
-	{1, 1}, /* 2460529 - 6 August 2024 - 3%  */
-	{1, 1}, /* 2460530 - 7 August 2024 - 8%  */
-	{2, 1}, /* 2460531 - 8 August 2024 - 14%  */
-	{3, 1}, /* 2460532 - 9 August 2024 - 21%  */
-	{4, 1}, /* 2460533 - 10 August 2024 - 30%  */
-	{5, 1}, /* 2460534 - 11 August 2024 - 39%  */
-	{7, 1}, /* 2460535 - 12 August 2024 - 48%  */
-	{8, 1}, /* 2460536 - 13 August 2024 - 58%  */
-	{10, 1}, /* 2460537 - 14 August 2024 - 68%  */
-	{11, 1}, /* 2460538 - 15 August 2024 - 77%  */
-	{12, 1}, /* 2460539 - 16 August 2024 - 85%  */
-	{13, 1}, /* 2460540 - 17 August 2024 - 92%  */
-	{14, 1}, /* 2460541 - 18 August 2024 - 97%  */
-	{14, 1}, /* 2460542 - 19 August 2024 - 99%  */
-	{14, 0}, /* 2460543 - 20 August 2024 - 99%  */
-	{13, 0}, /* 2460544 - 21 August 2024 - 95%  */
-	{13, 0}, /* 2460545 - 22 August 2024 - 89%  */
-	{11, 0}, /* 2460546 - 23 August 2024 - 80%  */
-	{10, 0}, /* 2460547 - 24 August 2024 - 70%  */
-	{8, 0}, /* 2460548 - 25 August 2024 - 59%  */
-	{7, 0}, /* 2460549 - 26 August 2024 - 48%  */
-	{5, 0}, /* 2460550 - 27 August 2024 - 38%  */
-	{4, 0}, /* 2460551 - 28 August 2024 - 28%  */
-	{3, 0}, /* 2460552 - 29 August 2024 - 19%  */
-	{2, 0}, /* 2460553 - 30 August 2024 - 11%  */
-	{1, 0}, /* 2460554 - 31 August 2024 - 6%  */
-	{0, 0}, /* 2460555 - 1 September 2024 - 2%  */
-	{0, 0}, /* 2460556 - 2 September 2024 - 0%  */
-	{0, 0}, /* 2460557 - 3 September 2024 - 0%  */
-	{0, 1}, /* 2460558 - 4 September 2024 - 1%  */
-	{1, 1}, /* 2460559 - 5 September 2024 - 5%  */
-	{1, 1}, /* 2460560 - 6 September 2024 - 10%  */
-	{2, 1}, /* 2460561 - 7 September 2024 - 16%  */
-	{3, 1}, /* 2460562 - 8 September 2024 - 24%  */
-	{5, 1}, /* 2460563 - 9 September 2024 - 33%  */
-	{6, 1}, /* 2460564 - 10 September 2024 - 42%  */
-	{7, 1}, /* 2460565 - 11 September 2024 - 52%  */
-	{9, 1}, /* 2460566 - 12 September 2024 - 62%  */
-	{10, 1}, /* 2460567 - 13 September 2024 - 72%  */
-	{12, 1}, /* 2460568 - 14 September 2024 - 82%  */
-	{13, 1}, /* 2460569 - 15 September 2024 - 90%  */
-	{13, 1}, /* 2460570 - 16 September 2024 - 96%  */
-	{14, 1}, /* 2460571 - 17 September 2024 - 99%  */
-	{14, 1}, /* 2460572 - 18 September 2024 - 99%  */
-	{14, 0}, /* 2460573 - 19 September 2024 - 97%  */
-	{13, 0}, /* 2460574 - 20 September 2024 - 91%  */
-	{12, 0}, /* 2460575 - 21 September 2024 - 83%  */
-	{10, 0}, /* 2460576 - 22 September 2024 - 74%  */
-	{9, 0}, /* 2460577 - 23 September 2024 - 63%  */
-	{7, 0}, /* 2460578 - 24 September 2024 - 53%  */
-	{6, 0}, /* 2460579 - 25 September 2024 - 42%  */
-	{5, 0}, /* 2460580 - 26 September 2024 - 32%  */
-	{3, 0}, /* 2460581 - 27 September 2024 - 23%  */
-	{2, 0}, /* 2460582 - 28 September 2024 - 15%  */
-	{1, 0}, /* 2460583 - 29 September 2024 - 9%  */
-	{1, 0}, /* 2460584 - 30 September 2024 - 4%  */
-	{0, 0}, /* 2460585 - 1 October 2024 - 1%  */
-	{0, 0}, /* 2460586 - 2 October 2024 - 0%  */
-	{0, 1}, /* 2460587 - 3 October 2024 - 0%  */
-	{0, 1}, /* 2460588 - 4 October 2024 - 2%  */
-	{1, 1}, /* 2460589 - 5 October 2024 - 6%  */
-	{2, 1}, /* 2460590 - 6 October 2024 - 12%  */
-	{3, 1}, /* 2460591 - 7 October 2024 - 19%  */
-	{4, 1}, /* 2460592 - 8 October 2024 - 27%  */
-	{5, 1}, /* 2460593 - 9 October 2024 - 36%  */
-	{7, 1}, /* 2460594 - 10 October 2024 - 47%  */
-	{8, 1}, /* 2460595 - 11 October 2024 - 57%  */
-	{10, 1}, /* 2460596 - 12 October 2024 - 68%  */
-	{11, 1}, /* 2460597 - 13 October 2024 - 78%  */
-	{12, 1}, /* 2460598 - 14 October 2024 - 87%  */
-	{13, 1}, /* 2460599 - 15 October 2024 - 94%  */
-	{14, 1}, /* 2460600 - 16 October 2024 - 98%  */
-	{14, 1}, /* 2460601 - 17 October 2024 - 99%  */
-	{14, 0}, /* 2460602 - 18 October 2024 - 98%  */
-	{13, 0}, /* 2460603 - 19 October 2024 - 93%  */
-	{12, 0}, /* 2460604 - 20 October 2024 - 87%  */
-	{11, 0}, /* 2460605 - 21 October 2024 - 78%  */
-	{10, 0}, /* 2460606 - 22 October 2024 - 68%  */
-	{8, 0}, /* 2460607 - 23 October 2024 - 58%  */
-	{7, 0}, /* 2460608 - 24 October 2024 - 48%  */
-	{5, 0}, /* 2460609 - 25 October 2024 - 38%  */
-	{4, 0}, /* 2460610 - 26 October 2024 - 29%  */
-	{3, 0}, /* 2460611 - 27 October 2024 - 21%  */
-	{2, 0}, /* 2460612 - 28 October 2024 - 13%  */
-	{1, 0}, /* 2460613 - 29 October 2024 - 8%  */
-	{1, 0}, /* 2460614 - 30 October 2024 - 3%  */
-	{0, 0}, /* 2460615 - 31 October 2024 - 0%  */
-	{0, 0}, /* 2460616 - 1 November 2024 - 0%  */
-	{0, 1}, /* 2460617 - 2 November 2024 - 0%  */
-	{1, 1}, /* 2460618 - 3 November 2024 - 3%  */
-	{1, 1}, /* 2460619 - 4 November 2024 - 8%  */
-	{2, 1}, /* 2460620 - 5 November 2024 - 14%  */
-	{3, 1}, /* 2460621 - 6 November 2024 - 22%  */
-	{4, 1}, /* 2460622 - 7 November 2024 - 31%  */
-	{6, 1}, /* 2460623 - 8 November 2024 - 41%  */
-	{7, 1}, /* 2460624 - 9 November 2024 - 52%  */
-	{9, 1}, /* 2460625 - 10 November 2024 - 63%  */
-	{10, 1}, /* 2460626 - 11 November 2024 - 74%  */
-	{12, 1}, /* 2460627 - 12 November 2024 - 84%  */
-	{13, 1}, /* 2460628 - 13 November 2024 - 91%  */
-	{14, 1}, /* 2460629 - 14 November 2024 - 97%  */
-	{14, 1}, /* 2460630 - 15 November 2024 - 99%  */
-	{14, 0}, /* 2460631 - 16 November 2024 - 99%  */
-	{13, 0}, /* 2460632 - 17 November 2024 - 96%  */
-	{13, 0}, /* 2460633 - 18 November 2024 - 90%  */
-	{12, 0}, /* 2460634 - 19 November 2024 - 83%  */
-	{10, 0}, /* 2460635 - 20 November 2024 - 74%  */
-	{9, 0}, /* 2460636 - 21 November 2024 - 65%  */
-	{8, 0}, /* 2460637 - 22 November 2024 - 55%  */
-	{6, 0}, /* 2460638 - 23 November 2024 - 45%  */
-	{5, 0}, /* 2460639 - 24 November 2024 - 36%  */
-	{4, 0}, /* 2460640 - 25 November 2024 - 27%  */
-	{3, 0}, /* 2460641 - 26 November 2024 - 19%  */
-	{2, 0}, /* 2460642 - 27 November 2024 - 12%  */
-	{1, 0}, /* 2460643 - 28 November 2024 - 7%  */
-	{0, 0}, /* 2460644 - 29 November 2024 - 3%  */
-	{0, 0}, /* 2460645 - 30 November 2024 - 0%  */
-	{0, 0}, /* 2460646 - 1 December 2024 - 0%  */
-	{0, 1}, /* 2460647 - 2 December 2024 - 1%  */
-	{1, 1}, /* 2460648 - 3 December 2024 - 5%  */
-	{1, 1}, /* 2460649 - 4 December 2024 - 10%  */
-	{3, 1}, /* 2460650 - 5 December 2024 - 18%  */
-	{4, 1}, /* 2460651 - 6 December 2024 - 27%  */
-	{5, 1}, /* 2460652 - 7 December 2024 - 37%  */
-	{7, 1}, /* 2460653 - 8 December 2024 - 48%  */
-	{8, 1}, /* 2460654 - 9 December 2024 - 59%  */
-	{10, 1}, /* 2460655 - 10 December 2024 - 70%  */
-	{11, 1}, /* 2460656 - 11 December 2024 - 80%  */
-	{12, 1}, /* 2460657 - 12 December 2024 - 89%  */
-	{13, 1}, /* 2460658 - 13 December 2024 - 95%  */
-	{14, 1}, /* 2460659 - 14 December 2024 - 98%  */
-	{14, 1}, /* 2460660 - 15 December 2024 - 99%  */
-	{14, 0}, /* 2460661 - 16 December 2024 - 98%  */
-	{13, 0}, /* 2460662 - 17 December 2024 - 94%  */
-	{12, 0}, /* 2460663 - 18 December 2024 - 88%  */
-	{11, 0}, /* 2460664 - 19 December 2024 - 81%  */
-	{10, 0}, /* 2460665 - 20 December 2024 - 72%  */
-	{9, 0}, /* 2460666 - 21 December 2024 - 63%  */
-	{8, 0}, /* 2460667 - 22 December 2024 - 54%  */
-	{6, 0}, /* 2460668 - 23 December 2024 - 44%  */
-	{5, 0}, /* 2460669 - 24 December 2024 - 35%  */
-	{4, 0}, /* 2460670 - 25 December 2024 - 26%  */
-	{3, 0}, /* 2460671 - 26 December 2024 - 18%  */
-	{2, 0}, /* 2460672 - 27 December 2024 - 11%  */
-	{1, 0}, /* 2460673 - 28 December 2024 - 6%  */
-	{0, 0}, /* 2460674 - 29 December 2024 - 2%  */
-	{0, 0}, /* 2460675 - 30 December 2024 - 0%  */
-	{0, 1}, /* 2460676 - 31 December 2024 - 0%  */
-	{0, 1}, /* 2460677 - 1 January 2025 - 2%  */
-	{1, 1}, /* 2460678 - 2 January 2025 - 7%  */
-	{2, 1}, /* 2460679 - 3 January 2025 - 14%  */
-	{3, 1}, /* 2460680 - 4 January 2025 - 23%  */
-	{5, 1}, /* 2460681 - 5 January 2025 - 33%  */
-	{6, 1}, /* 2460682 - 6 January 2025 - 44%  */
-	{8, 1}, /* 2460683 - 7 January 2025 - 55%  */
-	{9, 1}, /* 2460684 - 8 January 2025 - 66%  */
-	{11, 1}, /* 2460685 - 9 January 2025 - 77%  */
-	{12, 1}, /* 2460686 - 10 January 2025 - 85%  */
-	{13, 1}, /* 2460687 - 11 January 2025 - 92%  */
-	{14, 1}, /* 2460688 - 12 January 2025 - 97%  */
-	{14, 1}, /* 2460689 - 13 January 2025 - 99%  */
-	{14, 0}, /* 2460690 - 14 January 2025 - 99%  */
-	{14, 0}, /* 2460691 - 15 January 2025 - 97%  */
-	{13, 0}, /* 2460692 - 16 January 2025 - 92%  */
-	{12, 0}, /* 2460693 - 17 January 2025 - 86%  */
-	{11, 0}, /* 2460694 - 18 January 2025 - 79%  */
-	{10, 0}, /* 2460695 - 19 January 2025 - 71%  */
-	{9, 0}, /* 2460696 - 20 January 2025 - 62%  */
-	{7, 0}, /* 2460697 - 21 January 2025 - 53%  */
-	{6, 0}, /* 2460698 - 22 January 2025 - 43%  */
-	{5, 0}, /* 2460699 - 23 January 2025 - 34%  */
-	{4, 0}, /* 2460700 - 24 January 2025 - 25%  */
-	{2, 0}, /* 2460701 - 25 January 2025 - 17%  */
-	{1, 0}, /* 2460702 - 26 January 2025 - 10%  */
-	{1, 0}, /* 2460703 - 27 January 2025 - 4%  */
-	{0, 0}, /* 2460704 - 28 January 2025 - 1%  */
-	{0, 0}, /* 2460705 - 29 January 2025 - 0%  */
-	{0, 1}, /* 2460706 - 30 January 2025 - 1%  */
-	{1, 1}, /* 2460707 - 31 January 2025 - 4%  */
-	{2, 1}, /* 2460708 - 1 February 2025 - 11%  */
-	{3, 1}, /* 2460709 - 2 February 2025 - 19%  */
-	{4, 1}, /* 2460710 - 3 February 2025 - 29%  */
-	{6, 1}, /* 2460711 - 4 February 2025 - 40%  */
-	{7, 1}, /* 2460712 - 5 February 2025 - 51%  */
-	{9, 1}, /* 2460713 - 6 February 2025 - 63%  */
-	{10, 1}, /* 2460714 - 7 February 2025 - 73%  */
-	{12, 1}, /* 2460715 - 8 February 2025 - 82%  */
-	{13, 1}, /* 2460716 - 9 February 2025 - 89%  */
-	{13, 1}, /* 2460717 - 10 February 2025 - 95%  */
-	{14, 1}, /* 2460718 - 11 February 2025 - 98%  */
-	{14, 1}, /* 2460719 - 12 February 2025 - 99%  */
-	{14, 0}, /* 2460720 - 13 February 2025 - 99%  */
-	{13, 0}, /* 2460721 - 14 February 2025 - 96%  */
-	{13, 0}, /* 2460722 - 15 February 2025 - 91%  */
-	{12, 0}, /* 2460723 - 16 February 2025 - 85%  */
-	{11, 0}, /* 2460724 - 17 February 2025 - 78%  */
-	{10, 0}, /* 2460725 - 18 February 2025 - 70%  */
-	{9, 0}, /* 2460726 - 19 February 2025 - 61%  */
-	{7, 0}, /* 2460727 - 20 February 2025 - 52%  */
-	{6, 0}, /* 2460728 - 21 February 2025 - 42%  */
-	{5, 0}, /* 2460729 - 22 February 2025 - 32%  */
-	{3, 0}, /* 2460730 - 23 February 2025 - 23%  */
-	{2, 0}, /* 2460731 - 24 February 2025 - 15%  */
-	{1, 0}, /* 2460732 - 25 February 2025 - 8%  */
-	{0, 0}, /* 2460733 - 26 February 2025 - 3%  */
-	{0, 0}, /* 2460734 - 27 February 2025 - 0%  */
-	{0, 0}, /* 2460735 - 28 February 2025 - 0%  */
-	{0, 1}, /* 2460736 - 1 March 2025 - 3%  */
-	{1, 1}, /* 2460737 - 2 March 2025 - 8%  */
-	{2, 1}, /* 2460738 - 3 March 2025 - 16%  */
-	{4, 1}, /* 2460739 - 4 March 2025 - 26%  */
-	{5, 1}, /* 2460740 - 5 March 2025 - 36%  */
-	{7, 1}, /* 2460741 - 6 March 2025 - 47%  */
-	{8, 1}, /* 2460742 - 7 March 2025 - 58%  */
-	{10, 1}, /* 2460743 - 8 March 2025 - 69%  */
-	{11, 1}, /* 2460744 - 9 March 2025 - 78%  */
-	{12, 1}, /* 2460745 - 10 March 2025 - 86%  */
-	{13, 1}, /* 2460746 - 11 March 2025 - 92%  */
-	{14, 1}, /* 2460747 - 12 March 2025 - 96%  */
-	{14, 1}, /* 2460748 - 13 March 2025 - 99%  */
-	{14, 1}, /* 2460749 - 14 March 2025 - 99%  */
-	{14, 0}, /* 2460750 - 15 March 2025 - 98%  */
-	{13, 0}, /* 2460751 - 16 March 2025 - 95%  */
-	{13, 0}, /* 2460752 - 17 March 2025 - 90%  */
-	{12, 0}, /* 2460753 - 18 March 2025 - 84%  */
-	{11, 0}, /* 2460754 - 19 March 2025 - 77%  */
-	{10, 0}, /* 2460755 - 20 March 2025 - 68%  */
-	{8, 0}, /* 2460756 - 21 March 2025 - 59%  */
-	{7, 0}, /* 2460757 - 22 March 2025 - 49%  */
-	{6, 0}, /* 2460758 - 23 March 2025 - 39%  */
-	{4, 0}, /* 2460759 - 24 March 2025 - 29%  */
-	{3, 0}, /* 2460760 - 25 March 2025 - 20%  */
-	{2, 0}, /* 2460761 - 26 March 2025 - 12%  */
-	{1, 0}, /* 2460762 - 27 March 2025 - 5%  */
-	{0, 0}, /* 2460763 - 28 March 2025 - 1%  */
-	{0, 0}, /* 2460764 - 29 March 2025 - 0%  */
-	{0, 1}, /* 2460765 - 30 March 2025 - 1%  */
-	{1, 1}, /* 2460766 - 31 March 2025 - 6%  */
-	{2, 1}, /* 2460767 - 1 April 2025 - 13%  */
-	{3, 1}, /* 2460768 - 2 April 2025 - 22%  */
-	{5, 1}, /* 2460769 - 3 April 2025 - 32%  */
-	{6, 1}, /* 2460770 - 4 April 2025 - 43%  */
-	{8, 1}, /* 2460771 - 5 April 2025 - 54%  */
-	{9, 1}, /* 2460772 - 6 April 2025 - 64%  */
-	{10, 1}, /* 2460773 - 7 April 2025 - 73%  */
-	{12, 1}, /* 2460774 - 8 April 2025 - 82%  */
-	{12, 1}, /* 2460775 - 9 April 2025 - 89%  */
-	{13, 1}, /* 2460776 - 10 April 2025 - 94%  */
-	{14, 1}, /* 2460777 - 11 April 2025 - 97%  */
-	{14, 1}, /* 2460778 - 12 April 2025 - 99%  */
-	{14, 1}, /* 2460779 - 13 April 2025 - 99%  */
-	{14, 0}, /* 2460780 - 14 April 2025 - 98%  */
-	{13, 0}, /* 2460781 - 15 April 2025 - 94%  */
-	{13, 0}, /* 2460782 - 16 April 2025 - 89%  */
-	{12, 0}, /* 2460783 - 17 April 2025 - 82%  */
-	{10, 0}, /* 2460784 - 18 April 2025 - 74%  */
-	{9, 0}, /* 2460785 - 19 April 2025 - 65%  */
-	{8, 0}, /* 2460786 - 20 April 2025 - 55%  */
-	{6, 0}, /* 2460787 - 21 April 2025 - 45%  */
-	{5, 0}, /* 2460788 - 22 April 2025 - 34%  */
-	{3, 0}, /* 2460789 - 23 April 2025 - 24%  */
-	{2, 0}, /* 2460790 - 24 April 2025 - 15%  */
-	{1, 0}, /* 2460791 - 25 April 2025 - 7%  */
-	{0, 0}, /* 2460792 - 26 April 2025 - 2%  */
-	{0, 0}, /* 2460793 - 27 April 2025 - 0%  */
-	{0, 1}, /* 2460794 - 28 April 2025 - 0%  */
-	{1, 1}, /* 2460795 - 29 April 2025 - 4%  */
-	{1, 1}, /* 2460796 - 30 April 2025 - 10%  */
-	{3, 1}, /* 2460797 - 1 May 2025 - 18%  */
-	{4, 1}, /* 2460798 - 2 May 2025 - 28%  */
-	{5, 1}, /* 2460799 - 3 May 2025 - 38%  */
-	{7, 1}, /* 2460800 - 4 May 2025 - 49%  */
-	{8, 1}, /* 2460801 - 5 May 2025 - 59%  */
-	{10, 1}, /* 2460802 - 6 May 2025 - 68%  */
-	{11, 1}, /* 2460803 - 7 May 2025 - 77%  */
-	{12, 1}, /* 2460804 - 8 May 2025 - 84%  */
-	{13, 1}, /* 2460805 - 9 May 2025 - 91%  */
-	{13, 1}, /* 2460806 - 10 May 2025 - 95%  */
-	{14, 1}, /* 2460807 - 11 May 2025 - 98%  */
-	{14, 1}, /* 2460808 - 12 May 2025 - 99%  */
-	{14, 0}, /* 2460809 - 13 May 2025 - 99%  */
-	{14, 0}, /* 2460810 - 14 May 2025 - 97%  */
-	{13, 0}, /* 2460811 - 15 May 2025 - 92%  */
-	{12, 0}, /* 2460812 - 16 May 2025 - 86%  */
-	{11, 0}, /* 2460813 - 17 May 2025 - 79%  */
-	{10, 0}, /* 2460814 - 18 May 2025 - 70%  */
-	{9, 0}, /* 2460815 - 19 May 2025 - 60%  */
-	{7, 0}, /* 2460816 - 20 May 2025 - 50%  */
-	{5, 0}, /* 2460817 - 21 May 2025 - 39%  */
-	{4, 0}, /* 2460818 - 22 May 2025 - 28%  */
-	{3, 0}, /* 2460819 - 23 May 2025 - 18%  */
-	{1, 0}, /* 2460820 - 24 May 2025 - 10%  */
-	{1, 0}, /* 2460821 - 25 May 2025 - 3%  */
-	{0, 0}, /* 2460822 - 26 May 2025 - 0%  */
-	{0, 0}, /* 2460823 - 27 May 2025 - 0%  */
-	{0, 1}, /* 2460824 - 28 May 2025 - 2%  */
-	{1, 1}, /* 2460825 - 29 May 2025 - 7%  */
-	{2, 1}, /* 2460826 - 30 May 2025 - 15%  */
-	{3, 1}, /* 2460827 - 31 May 2025 - 23%  */
-	{5, 1}, /* 2460828 - 1 June 2025 - 33%  */
-	{6, 1}, /* 2460829 - 2 June 2025 - 43%  */
-	{7, 1}, /* 2460830 - 3 June 2025 - 53%  */
-	{9, 1}, /* 2460831 - 4 June 2025 - 62%  */
-	{10, 1}, /* 2460832 - 5 June 2025 - 71%  */
-	{11, 1}, /* 2460833 - 6 June 2025 - 80%  */
-	{12, 1}, /* 2460834 - 7 June 2025 - 87%  */
-	{13, 1}, /* 2460835 - 8 June 2025 - 92%  */
-	{14, 1}, /* 2460836 - 9 June 2025 - 96%  */
-	{14, 1}, /* 2460837 - 10 June 2025 - 99%  */
-	{14, 1}, /* 2460838 - 11 June 2025 - 99%  */
-	{14, 0}, /* 2460839 - 12 June 2025 - 98%  */
-	{13, 0}, /* 2460840 - 13 June 2025 - 95%  */
-	{13, 0}, /* 2460841 - 14 June 2025 - 90%  */
-	{12, 0}, /* 2460842 - 15 June 2025 - 82%  */
-	{10, 0}, /* 2460843 - 16 June 2025 - 74%  */
-	{9, 0}, /* 2460844 - 17 June 2025 - 64%  */
-	{7, 0}, /* 2460845 - 18 June 2025 - 53%  */
-	{6, 0}, /* 2460846 - 19 June 2025 - 42%  */
-	{4, 0}, /* 2460847 - 20 June 2025 - 31%  */
-	{3, 0}, /* 2460848 - 21 June 2025 - 20%  */
-	{2, 0}, /* 2460849 - 22 June 2025 - 12%  */
-	{1, 0}, /* 2460850 - 23 June 2025 - 5%  */
-	{0, 0}, /* 2460851 - 24 June 2025 - 1%  */
-	{0, 0}, /* 2460852 - 25 June 2025 - 0%  */
-	{0, 1}, /* 2460853 - 26 June 2025 - 1%  */
-	{1, 1}, /* 2460854 - 27 June 2025 - 5%  */
-	{2, 1}, /* 2460855 - 28 June 2025 - 11%  */
-	{3, 1}, /* 2460856 - 29 June 2025 - 19%  */
-	{4, 1}, /* 2460857 - 30 June 2025 - 28%  */
-	{5, 1}, /* 2460858 - 1 July 2025 - 37%  */
-	{7, 1}, /* 2460859 - 2 July 2025 - 47%  */
-	{8, 1}, /* 2460860 - 3 July 2025 - 56%  */
-	{9, 1}, /* 2460861 - 4 July 2025 - 65%  */
-	{10, 1}, /* 2460862 - 5 July 2025 - 74%  */
-	{12, 1}, /* 2460863 - 6 July 2025 - 82%  */
-	{12, 1}, /* 2460864 - 7 July 2025 - 89%  */
-	{13, 1}, /* 2460865 - 8 July 2025 - 94%  */
-	{14, 1}, /* 2460866 - 9 July 2025 - 98%  */
-	{14, 1}, /* 2460867 - 10 July 2025 - 99%  */
-	{14, 0}, /* 2460868 - 11 July 2025 - 99%  */
-	{14, 0}, /* 2460869 - 12 July 2025 - 97%  */
-	{13, 0}, /* 2460870 - 13 July 2025 - 92%  */
-	{12, 0}, /* 2460871 - 14 July 2025 - 85%  */
-	{11, 0}, /* 2460872 - 15 July 2025 - 76%  */
-	{9, 0}, /* 2460873 - 16 July 2025 - 66%  */
-	{8, 0}, /* 2460874 - 17 July 2025 - 55%  */
-	{6, 0}, /* 2460875 - 18 July 2025 - 44%  */
-	{5, 0}, /* 2460876 - 19 July 2025 - 33%  */
-	{3, 0}, /* 2460877 - 20 July 2025 - 22%  */
-	{2, 0}, /* 2460878 - 21 July 2025 - 13%  */
-	{1, 0}, /* 2460879 - 22 July 2025 - 6%  */
-	{0, 0}, /* 2460880 - 23 July 2025 - 2%  */
-	{0, 0}, /* 2460881 - 24 July 2025 - 0%  */
-	{0, 1}, /* 2460882 - 25 July 2025 - 0%  */
-	{0, 1}, /* 2460883 - 26 July 2025 - 3%  */
-	{1, 1}, /* 2460884 - 27 July 2025 - 8%  */
-	{2, 1}, /* 2460885 - 28 July 2025 - 14%  */
-	{3, 1}, /* 2460886 - 29 July 2025 - 22%  */
-	{4, 1}, /* 2460887 - 30 July 2025 - 31%  */
-	{6, 1}, /* 2460888 - 31 July 2025 - 40%  */
-	{7, 1}, /* 2460889 - 1 August 2025 - 49%  */
-	{8, 1}, /* 2460890 - 2 August 2025 - 59%  */
-	{10, 1}, /* 2460891 - 3 August 2025 - 68%  */
-	{11, 1}, /* 2460892 - 4 August 2025 - 76%  */
-	{12, 1}, /* 2460893 - 5 August 2025 - 84%  */
-	{13, 1}, /* 2460894 - 6 August 2025 - 91%  */
-	{13, 1}, /* 2460895 - 7 August 2025 - 96%  */
-	{14, 1}, /* 2460896 - 8 August 2025 - 99%  */
-	{14, 1}, /* 2460897 - 9 August 2025 - 99%  */
-	{14, 0}, /* 2460898 - 10 August 2025 - 98%  */
-	{13, 0}, /* 2460899 - 11 August 2025 - 94%  */
-	{12, 0}, /* 2460900 - 12 August 2025 - 87%  */
-	{11, 0}, /* 2460901 - 13 August 2025 - 79%  */
-	{10, 0}, /* 2460902 - 14 August 2025 - 69%  */
-	{8, 0}, /* 2460903 - 15 August 2025 - 58%  */
-	{7, 0}, /* 2460904 - 16 August 2025 - 46%  */
-	{5, 0}, /* 2460905 - 17 August 2025 - 35%  */
-	{4, 0}, /* 2460906 - 18 August 2025 - 25%  */
-	{2, 0}, /* 2460907 - 19 August 2025 - 16%  */
-	{1, 0}, /* 2460908 - 20 August 2025 - 8%  */
-	{0, 0}, /* 2460909 - 21 August 2025 - 3%  */
-	{0, 0}, /* 2460910 - 22 August 2025 - 0%  */
-	{0, 0}, /* 2460911 - 23 August 2025 - 0%  */
-	{0, 1}, /* 2460912 - 24 August 2025 - 1%  */
-	{1, 1}, /* 2460913 - 25 August 2025 - 5%  */
-	{1, 1}, /* 2460914 - 26 August 2025 - 10%  */
-	{2, 1}, /* 2460915 - 27 August 2025 - 17%  */
-	{4, 1}, /* 2460916 - 28 August 2025 - 25%  */
-	{5, 1}, /* 2460917 - 29 August 2025 - 33%  */
-	{6, 1}, /* 2460918 - 30 August 2025 - 42%  */
-	{7, 1}, /* 2460919 - 31 August 2025 - 52%  */
-	{9, 1}, /* 2460920 - 1 September 2025 - 61%  */
-	{10, 1}, /* 2460921 - 2 September 2025 - 71%  */
-	{11, 1}, /* 2460922 - 3 September 2025 - 79%  */
-	{12, 1}, /* 2460923 - 4 September 2025 - 87%  */
-	{13, 1}, /* 2460924 - 5 September 2025 - 93%  */
-	{14, 1}, /* 2460925 - 6 September 2025 - 97%  */
-	{14, 1}, /* 2460926 - 7 September 2025 - 99%  */
-	{14, 0}, /* 2460927 - 8 September 2025 - 99%  */
-	{13, 0}, /* 2460928 - 9 September 2025 - 95%  */
-	{13, 0}, /* 2460929 - 10 September 2025 - 89%  */
-	{11, 0}, /* 2460930 - 11 September 2025 - 81%  */
-	{10, 0}, /* 2460931 - 12 September 2025 - 71%  */
-	{9, 0}, /* 2460932 - 13 September 2025 - 60%  */
-	{7, 0}, /* 2460933 - 14 September 2025 - 49%  */
-	{5, 0}, /* 2460934 - 15 September 2025 - 38%  */
-	{4, 0}, /* 2460935 - 16 September 2025 - 27%  */
-	{3, 0}, /* 2460936 - 17 September 2025 - 18%  */
-	{2, 0}, /* 2460937 - 18 September 2025 - 11%  */
-	{1, 0}, /* 2460938 - 19 September 2025 - 5%  */
-	{0, 0}, /* 2460939 - 20 September 2025 - 1%  */
-	{0, 0}, /* 2460940 - 21 September 2025 - 0%  */
-	{0, 1}, /* 2460941 - 22 September 2025 - 0%  */
-	{0, 1}, /* 2460942 - 23 September 2025 - 2%  */
-	{1, 1}, /* 2460943 - 24 September 2025 - 6%  */
-	{2, 1}, /* 2460944 - 25 September 2025 - 12%  */
-	{3, 1}, /* 2460945 - 26 September 2025 - 19%  */
-	{4, 1}, /* 2460946 - 27 September 2025 - 27%  */
-	{5, 1}, /* 2460947 - 28 September 2025 - 35%  */
-	{6, 1}, /* 2460948 - 29 September 2025 - 45%  */
-	{8, 1}, /* 2460949 - 30 September 2025 - 55%  */
-	{9, 1}, /* 2460950 - 1 October 2025 - 64%  */
-	{10, 1}, /* 2460951 - 2 October 2025 - 74%  */
-	{12, 1}, /* 2460952 - 3 October 2025 - 83%  */
-	{13, 1}, /* 2460953 - 4 October 2025 - 90%  */
-	{13, 1}, /* 2460954 - 5 October 2025 - 96%  */
-	{14, 1}, /* 2460955 - 6 October 2025 - 99%  */
-	{14, 1}, /* 2460956 - 7 October 2025 - 99%  */
-	{14, 0}, /* 2460957 - 8 October 2025 - 97%  */
-	{13, 0}, /* 2460958 - 9 October 2025 - 91%  */
-	{12, 0}, /* 2460959 - 10 October 2025 - 84%  */
-	{10, 0}, /* 2460960 - 11 October 2025 - 74%  */
-	{9, 0}, /* 2460961 - 12 October 2025 - 64%  */
-	{7, 0}, /* 2460962 - 13 October 2025 - 53%  */
-	{6, 0}, /* 2460963 - 14 October 2025 - 42%  */
-	{4, 0}, /* 2460964 - 15 October 2025 - 31%  */
-	{3, 0}, /* 2460965 - 16 October 2025 - 22%  */
-	{2, 0}, /* 2460966 - 17 October 2025 - 14%  */
-	{1, 0}, /* 2460967 - 18 October 2025 - 8%  */
-	{1, 0}, /* 2460968 - 19 October 2025 - 3%  */
-	{0, 0}, /* 2460969 - 20 October 2025 - 0%  */
-	{0, 0}, /* 2460970 - 21 October 2025 - 0%  */
-	{0, 1}, /* 2460971 - 22 October 2025 - 0%  */
-	{0, 1}, /* 2460972 - 23 October 2025 - 3%  */
-	{1, 1}, /* 2460973 - 24 October 2025 - 7%  */
-	{2, 1}, /* 2460974 - 25 October 2025 - 13%  */
-	{3, 1}, /* 2460975 - 26 October 2025 - 20%  */
-	{4, 1}, /* 2460976 - 27 October 2025 - 29%  */
-	{5, 1}, /* 2460977 - 28 October 2025 - 38%  */
-	{7, 1}, /* 2460978 - 29 October 2025 - 48%  */
-	{8, 1}, /* 2460979 - 30 October 2025 - 58%  */
-	{10, 1}, /* 2460980 - 31 October 2025 - 68%  */
-	{11, 1}, /* 2460981 - 1 November 2025 - 78%  */
-	{12, 1}, /* 2460982 - 2 November 2025 - 86%  */
-	{13, 1}, /* 2460983 - 3 November 2025 - 93%  */
-	{14, 1}, /* 2460984 - 4 November 2025 - 98%  */
-	{14, 1}, /* 2460985 - 5 November 2025 - 99%  */
-	{14, 0}, /* 2460986 - 6 November 2025 - 98%  */
-	{13, 0}, /* 2460987 - 7 November 2025 - 94%  */
-	{12, 0}, /* 2460988 - 8 November 2025 - 87%  */
-	{11, 0}, /* 2460989 - 9 November 2025 - 78%  */
-	{10, 0}, /* 2460990 - 10 November 2025 - 68%  */
-	{8, 0}, /* 2460991 - 11 November 2025 - 57%  */
-	{7, 0}, /* 2460992 - 12 November 2025 - 47%  */
-	{5, 0}, /* 2460993 - 13 November 2025 - 37%  */
-	{4, 0}, /* 2460994 - 14 November 2025 - 27%  */
-	{3, 0}, /* 2460995 - 15 November 2025 - 19%  */
-	{2, 0}, /* 2460996 - 16 November 2025 - 12%  */
-	{1, 0}, /* 2460997 - 17 November 2025 - 6%  */
-	{0, 0}, /* 2460998 - 18 November 2025 - 2%  */
-	{0, 0}, /* 2460999 - 19 November 2025 - 0%  */
-	{0, 0}, /* 2461000 - 20 November 2025 - 0%  */
-	{0, 1}, /* 2461001 - 21 November 2025 - 1%  */
-	{1, 1}, /* 2461002 - 22 November 2025 - 4%  */
-	{1, 1}, /* 2461003 - 23 November 2025 - 9%  */
-	{2, 1}, /* 2461004 - 24 November 2025 - 15%  */
-	{3, 1}, /* 2461005 - 25 November 2025 - 23%  */
-	{4, 1}, /* 2461006 - 26 November 2025 - 32%  */
-	{6, 1}, /* 2461007 - 27 November 2025 - 41%  */
-	{7, 1}, /* 2461008 - 28 November 2025 - 52%  */
-	{9, 1}, /* 2461009 - 29 November 2025 - 63%  */
-	{10, 1}, /* 2461010 - 30 November 2025 - 73%  */
-	{12, 1}, /* 2461011 - 1 December 2025 - 83%  */
-	{13, 1}, /* 2461012 - 2 December 2025 - 90%  */
-	{14, 1}, /* 2461013 - 3 December 2025 - 96%  */
-	{14, 1}, /* 2461014 - 4 December 2025 - 99%  */
-	{14, 0}, /* 2461015 - 5 December 2025 - 99%  */
-	{14, 0}, /* 2461016 - 6 December 2025 - 96%  */
-	{13, 0}, /* 2461017 - 7 December 2025 - 90%  */
-	{12, 0}, /* 2461018 - 8 December 2025 - 83%  */
-	{10, 0}, /* 2461019 - 9 December 2025 - 73%  */
-	{9, 0}, /* 2461020 - 10 December 2025 - 64%  */
-	{8, 0}, /* 2461021 - 11 December 2025 - 53%  */
-	{6, 0}, /* 2461022 - 12 December 2025 - 43%  */
-	{5, 0}, /* 2461023 - 13 December 2025 - 34%  */
-	{4, 0}, /* 2461024 - 14 December 2025 - 25%  */
-	{2, 0}, /* 2461025 - 15 December 2025 - 17%  */
-	{2, 0}, /* 2461026 - 16 December 2025 - 11%  */
-	{1, 0}, /* 2461027 - 17 December 2025 - 5%  */
-	{0, 0}, /* 2461028 - 18 December 2025 - 2%  */
-	{0, 0}, /* 2461029 - 19 December 2025 - 0%  */
-	{0, 0}, /* 2461030 - 20 December 2025 - 0%  */
-	{0, 1}, /* 2461031 - 21 December 2025 - 1%  */
-	{1, 1}, /* 2461032 - 22 December 2025 - 5%  */
-	{2, 1}, /* 2461033 - 23 December 2025 - 10%  */
-	{3, 1}, /* 2461034 - 24 December 2025 - 17%  */
-	{4, 1}, /* 2461035 - 25 December 2025 - 26%  */
-	{5, 1}, /* 2461036 - 26 December 2025 - 36%  */
-	{7, 1}, /* 2461037 - 27 December 2025 - 46%  */
-	{8, 1}, /* 2461038 - 28 December 2025 - 57%  */
-	{10, 1}, /* 2461039 - 29 December 2025 - 68%  */
-	{11, 1}, /* 2461040 - 30 December 2025 - 79%  */
-	{12, 1}, /* 2461041 - 31 December 2025 - 87%  */
-	{13, 1}, /* 2461042 - 1 January 2026 - 94%  */
-	{14, 1}, /* 2461043 - 2 January 2026 - 98%  */
-	{14, 1}, /* 2461044 - 3 January 2026 - 99%  */
-	{14, 0}, /* 2461045 - 4 January 2026 - 98%  */
-	{13, 0}, /* 2461046 - 5 January 2026 - 94%  */
-	{12, 0}, /* 2461047 - 6 January 2026 - 87%  */
-	{11, 0}, /* 2461048 - 7 January 2026 - 79%  */
-	{10, 0}, /* 2461049 - 8 January 2026 - 70%  */
-	{9, 0}, /* 2461050 - 9 January 2026 - 61%  */
-	{7, 0}, /* 2461051 - 10 January 2026 - 51%  */
-	{6, 0}, /* 2461052 - 11 January 2026 - 42%  */
-	{5, 0}, /* 2461053 - 12 January 2026 - 32%  */
-	{3, 0}, /* 2461054 - 13 January 2026 - 24%  */
-	{2, 0}, /* 2461055 - 14 January 2026 - 16%  */
-	{1, 0}, /* 2461056 - 15 January 2026 - 10%  */
-	{1, 0}, /* 2461057 - 16 January 2026 - 5%  */
-	{0, 0}, /* 2461058 - 17 January 2026 - 1%  */
-	{0, 0}, /* 2461059 - 18 January 2026 - 0%  */
-	{0, 1}, /* 2461060 - 19 January 2026 - 0%  */
-	{0, 1}, /* 2461061 - 20 January 2026 - 2%  */
-	{1, 1}, /* 2461062 - 21 January 2026 - 7%  */
-	{2, 1}, /* 2461063 - 22 January 2026 - 13%  */
-	{3, 1}, /* 2461064 - 23 January 2026 - 21%  */
-	{4, 1}, /* 2461065 - 24 January 2026 - 31%  */
-	{6, 1}, /* 2461066 - 25 January 2026 - 42%  */
-	{7, 1}, /* 2461067 - 26 January 2026 - 53%  */
-	{9, 1}, /* 2461068 - 27 January 2026 - 64%  */
-	{11, 1}, /* 2461069 - 28 January 2026 - 75%  */
-	{12, 1}, /* 2461070 - 29 January 2026 - 84%  */
-	{13, 1}, /* 2461071 - 30 January 2026 - 92%  */
-	{14, 1}, /* 2461072 - 31 January 2026 - 97%  */
-	{14, 1}, /* 2461073 - 1 February 2026 - 99%  */
-	{14, 0}, /* 2461074 - 2 February 2026 - 99%  */
-	{14, 0}, /* 2461075 - 3 February 2026 - 96%  */
-	{13, 0}, /* 2461076 - 4 February 2026 - 92%  */
-	{12, 0}, /* 2461077 - 5 February 2026 - 85%  */
-	{11, 0}, /* 2461078 - 6 February 2026 - 77%  */
-	{10, 0}, /* 2461079 - 7 February 2026 - 69%  */
-	{8, 0}, /* 2461080 - 8 February 2026 - 59%  */
-	{7, 0}, /* 2461081 - 9 February 2026 - 50%  */
-	{6, 0}, /* 2461082 - 10 February 2026 - 40%  */
-	{4, 0}, /* 2461083 - 11 February 2026 - 31%  */
-	{3, 0}, /* 2461084 - 12 February 2026 - 23%  */
-	{2, 0}, /* 2461085 - 13 February 2026 - 15%  */
-	{1, 0}, /* 2461086 - 14 February 2026 - 9%  */
-	{1, 0}, /* 2461087 - 15 February 2026 - 4%  */
-	{0, 0}, /* 2461088 - 16 February 2026 - 1%  */
-	{0, 0}, /* 2461089 - 17 February 2026 - 0%  */
-	{0, 1}, /* 2461090 - 18 February 2026 - 1%  */
-	{1, 1}, /* 2461091 - 19 February 2026 - 4%  */
-	{1, 1}, /* 2461092 - 20 February 2026 - 10%  */
-	{3, 1}, /* 2461093 - 21 February 2026 - 18%  */
-	{4, 1}, /* 2461094 - 22 February 2026 - 27%  */
-	{5, 1}, /* 2461095 - 23 February 2026 - 38%  */
-	{7, 1}, /* 2461096 - 24 February 2026 - 49%  */
-	{9, 1}, /* 2461097 - 25 February 2026 - 61%  */
-	{10, 1}, /* 2461098 - 26 February 2026 - 71%  */
-	{11, 1}, /* 2461099 - 27 February 2026 - 81%  */
-	{13, 1}, /* 2461100 - 28 February 2026 - 89%  */
-	{13, 1}, /* 2461101 - 1 March 2026 - 95%  */
-	{14, 1}, /* 2461102 - 2 March 2026 - 98%  */
-	{14, 1}, /* 2461103 - 3 March 2026 - 99%  */
-	{14, 0}, /* 2461104 - 4 March 2026 - 98%  */
-	{13, 0}, /* 2461105 - 5 March 2026 - 95%  */
-	{13, 0}, /* 2461106 - 6 March 2026 - 90%  */
-	{12, 0}, /* 2461107 - 7 March 2026 - 83%  */
-	{11, 0}, /* 2461108 - 8 March 2026 - 76%  */
-	{9, 0}, /* 2461109 - 9 March 2026 - 67%  */
-	{8, 0}, /* 2461110 - 10 March 2026 - 58%  */
-	{7, 0}, /* 2461111 - 11 March 2026 - 49%  */
-	{6, 0}, /* 2461112 - 12 March 2026 - 39%  */
-	{4, 0}, /* 2461113 - 13 March 2026 - 30%  */
-	{3, 0}, /* 2461114 - 14 March 2026 - 21%  */
-	{2, 0}, /* 2461115 - 15 March 2026 - 14%  */
-	{1, 0}, /* 2461116 - 16 March 2026 - 7%  */
-	{0, 0}, /* 2461117 - 17 March 2026 - 2%  */
-	{0, 0}, /* 2461118 - 18 March 2026 - 0%  */
-	{0, 0}, /* 2461119 - 19 March 2026 - 0%  */
-	{0, 1}, /* 2461120 - 20 March 2026 - 2%  */
-	{1, 1}, /* 2461121 - 21 March 2026 - 7%  */
-	{2, 1}, /* 2461122 - 22 March 2026 - 15%  */
-	{3, 1}, /* 2461123 - 23 March 2026 - 24%  */
-	{5, 1}, /* 2461124 - 24 March 2026 - 35%  */
-	{7, 1}, /* 2461125 - 25 March 2026 - 46%  */
-	{8, 1}, /* 2461126 - 26 March 2026 - 57%  */
-	{10, 1}, /* 2461127 - 27 March 2026 - 68%  */
-	{11, 1}, /* 2461128 - 28 March 2026 - 78%  */
-	{12, 1}, /* 2461129 - 29 March 2026 - 86%  */
-	{13, 1}, /* 2461130 - 30 March 2026 - 92%  */
-	{14, 1}, /* 2461131 - 31 March 2026 - 97%  */
-	{14, 1}, /* 2461132 - 1 April 2026 - 99%  */
-	{14, 1}, /* 2461133 - 2 April 2026 - 99%  */
-	{14, 0}, /* 2461134 - 3 April 2026 - 97%  */
-	{13, 0}, /* 2461135 - 4 April 2026 - 94%  */
-	{12, 0}, /* 2461136 - 5 April 2026 - 89%  */
-	{12, 0}, /* 2461137 - 6 April 2026 - 82%  */
-	{10, 0}, /* 2461138 - 7 April 2026 - 74%  */
-	{9, 0}, /* 2461139 - 8 April 2026 - 66%  */
-	{8, 0}, /* 2461140 - 9 April 2026 - 56%  */
-	{7, 0}, /* 2461141 - 10 April 2026 - 47%  */
-	{5, 0}, /* 2461142 - 11 April 2026 - 37%  */
-	{4, 0}, /* 2461143 - 12 April 2026 - 28%  */
-	{3, 0}, /* 2461144 - 13 April 2026 - 19%  */
-	{2, 0}, /* 2461145 - 14 April 2026 - 11%  */
-	{1, 0}, /* 2461146 - 15 April 2026 - 5%  */
-	{0, 0}, /* 2461147 - 16 April 2026 - 1%  */
-	{0, 0}, /* 2461148 - 17 April 2026 - 0%  */
-	{0, 1}, /* 2461149 - 18 April 2026 - 1%  */
-	{1, 1}, /* 2461150 - 19 April 2026 - 5%  */
-	{2, 1}, /* 2461151 - 20 April 2026 - 12%  */
-	{3, 1}, /* 2461152 - 21 April 2026 - 21%  */
-	{4, 1}, /* 2461153 - 22 April 2026 - 32%  */
-	{6, 1}, /* 2461154 - 23 April 2026 - 43%  */
-	{8, 1}, /* 2461155 - 24 April 2026 - 54%  */
-	{9, 1}, /* 2461156 - 25 April 2026 - 64%  */
-	{10, 1}, /* 2461157 - 26 April 2026 - 74%  */
-	{12, 1}, /* 2461158 - 27 April 2026 - 83%  */
-	{13, 1}, /* 2461159 - 28 April 2026 - 90%  */
-	{13, 1}, /* 2461160 - 29 April 2026 - 95%  */
-	{14, 1}, /* 2461161 - 30 April 2026 - 98%  */
-	{14, 1}, /* 2461162 - 1 May 2026 - 99%  */
-	{14, 0}, /* 2461163 - 2 May 2026 - 99%  */
-	{14, 0}, /* 2461164 - 3 May 2026 - 97%  */
-	{13, 0}, /* 2461165 - 4 May 2026 - 93%  */
-	{12, 0}, /* 2461166 - 5 May 2026 - 87%  */
-	{11, 0}, /* 2461167 - 6 May 2026 - 80%  */
-	{10, 0}, /* 2461168 - 7 May 2026 - 72%  */
-	{9, 0}, /* 2461169 - 8 May 2026 - 63%  */
-	{8, 0}, /* 2461170 - 9 May 2026 - 53%  */
-	{6, 0}, /* 2461171 - 10 May 2026 - 43%  */
-	{5, 0}, /* 2461172 - 11 May 2026 - 33%  */
-	{3, 0}, /* 2461173 - 12 May 2026 - 23%  */
-	{2, 0}, /* 2461174 - 13 May 2026 - 15%  */
-	{1, 0}, /* 2461175 - 14 May 2026 - 7%  */
-	{0, 0}, /* 2461176 - 15 May 2026 - 2%  */
-	{0, 0}, /* 2461177 - 16 May 2026 - 0%  */
-	{0, 1}, /* 2461178 - 17 May 2026 - 0%  */
-	{1, 1}, /* 2461179 - 18 May 2026 - 4%  */
-	{1, 1}, /* 2461180 - 19 May 2026 - 10%  */
-	{3, 1}, /* 2461181 - 20 May 2026 - 18%  */
-	{4, 1}, /* 2461182 - 21 May 2026 - 28%  */
-	{6, 1}, /* 2461183 - 22 May 2026 - 39%  */
-	{7, 1}, /* 2461184 - 23 May 2026 - 50%  */
-	{9, 1}, /* 2461185 - 24 May 2026 - 60%  */
-	{10, 1}, /* 2461186 - 25 May 2026 - 70%  */
-	{11, 1}, /* 2461187 - 26 May 2026 - 79%  */
-	{12, 1}, /* 2461188 - 27 May 2026 - 86%  */
-	{13, 1}, /* 2461189 - 28 May 2026 - 92%  */
-	{14, 1}, /* 2461190 - 29 May 2026 - 96%  */
-	{14, 1}, /* 2461191 - 30 May 2026 - 99%  */
-	{14, 1}, /* 2461192 - 31 May 2026 - 99%  */
-	{14, 0}, /* 2461193 - 1 June 2026 - 98%  */
-	{13, 0}, /* 2461194 - 2 June 2026 - 95%  */
-	{13, 0}, /* 2461195 - 3 June 2026 - 91%  */
-	{12, 0}, /* 2461196 - 4 June 2026 - 85%  */
-	{11, 0}, /* 2461197 - 5 June 2026 - 77%  */
-	{10, 0}, /* 2461198 - 6 June 2026 - 69%  */
-	{8, 0}, /* 2461199 - 7 June 2026 - 59%  */
-	{7, 0}, /* 2461200 - 8 June 2026 - 49%  */
-	{5, 0}, /* 2461201 - 9 June 2026 - 38%  */
-	{4, 0}, /* 2461202 - 10 June 2026 - 28%  */
-	{3, 0}, /* 2461203 - 11 June 2026 - 18%  */
-	{1, 0}, /* 2461204 - 12 June 2026 - 10%  */
-	{1, 0}, /* 2461205 - 13 June 2026 - 4%  */
-	{0, 0}, /* 2461206 - 14 June 2026 - 0%  */
-	{0, 0}, /* 2461207 - 15 June 2026 - 0%  */
-	{0, 1}, /* 2461208 - 16 June 2026 - 2%  */
-	{1, 1}, /* 2461209 - 17 June 2026 - 8%  */
-	{2, 1}, /* 2461210 - 18 June 2026 - 16%  */
-	{4, 1}, /* 2461211 - 19 June 2026 - 25%  */
-	{5, 1}, /* 2461212 - 20 June 2026 - 35%  */
-	{6, 1}, /* 2461213 - 21 June 2026 - 45%  */
-	{8, 1}, /* 2461214 - 22 June 2026 - 56%  */
-	{9, 1}, /* 2461215 - 23 June 2026 - 65%  */
-	{10, 1}, /* 2461216 - 24 June 2026 - 74%  */
-	{12, 1}, /* 2461217 - 25 June 2026 - 82%  */
-	{12, 1}, /* 2461218 - 26 June 2026 - 89%  */
-	{13, 1}, /* 2461219 - 27 June 2026 - 94%  */
-	{14, 1}, /* 2461220 - 28 June 2026 - 97%  */
-	{14, 1}, /* 2461221 - 29 June 2026 - 99%  */
-	{14, 1}, /* 2461222 - 30 June 2026 - 99%  */
-	{14, 0}, /* 2461223 - 1 July 2026 - 97%  */
-	{13, 0}, /* 2461224 - 2 July 2026 - 94%  */
-	{12, 0}, /* 2461225 - 3 July 2026 - 88%  */
-	{11, 0}, /* 2461226 - 4 July 2026 - 81%  */
-	{10, 0}, /* 2461227 - 5 July 2026 - 73%  */
-	{9, 0}, /* 2461228 - 6 July 2026 - 63%  */
-	{7, 0}, /* 2461229 - 7 July 2026 - 53%  */
-	{6, 0}, /* 2461230 - 8 July 2026 - 42%  */
-	{4, 0}, /* 2461231 - 9 July 2026 - 31%  */
-	{3, 0}, /* 2461232 - 10 July 2026 - 21%  */
-	{2, 0}, /* 2461233 - 11 July 2026 - 12%  */
-	{1, 0}, /* 2461234 - 12 July 2026 - 5%  */
-	{0, 0}, /* 2461235 - 13 July 2026 - 1%  */
-	{0, 0}, /* 2461236 - 14 July 2026 - 0%  */
-	{0, 1}, /* 2461237 - 15 July 2026 - 1%  */
-	{1, 1}, /* 2461238 - 16 July 2026 - 6%  */
-	{2, 1}, /* 2461239 - 17 July 2026 - 12%  */
-	{3, 1}, /* 2461240 - 18 July 2026 - 21%  */
-	{4, 1}, /* 2461241 - 19 July 2026 - 30%  */
-	{6, 1}, /* 2461242 - 20 July 2026 - 40%  */
-	{7, 1}, /* 2461243 - 21 July 2026 - 50%  */
-	{8, 1}, /* 2461244 - 22 July 2026 - 60%  */
-	{10, 1}, /* 2461245 - 23 July 2026 - 69%  */
-	{11, 1}, /* 2461246 - 24 July 2026 - 77%  */
-	{12, 1}, /* 2461247 - 25 July 2026 - 85%  */
-	{13, 1}, /* 2461248 - 26 July 2026 - 91%  */
-	{13, 1}, /* 2461249 - 27 July 2026 - 95%  */
-	{14, 1}, /* 2461250 - 28 July 2026 - 98%  */
-	{14, 1}, /* 2461251 - 29 July 2026 - 99%  */
-	{14, 0}, /* 2461252 - 30 July 2026 - 99%  */
-	{14, 0}, /* 2461253 - 31 July 2026 - 96%  */
-	{13, 0}, /* 2461254 - 1 August 2026 - 91%  */
-	{12, 0}, /* 2461255 - 2 August 2026 - 85%  */
-	{11, 0}, /* 2461256 - 3 August 2026 - 76%  */
-	{9, 0}, /* 2461257 - 4 August 2026 - 67%  */
-	{8, 0}, /* 2461258 - 5 August 2026 - 56%  */
-	{6, 0}, /* 2461259 - 6 August 2026 - 45%  */
-	{5, 0}, /* 2461260 - 7 August 2026 - 34%  */
-	{3, 0}, /* 2461261 - 8 August 2026 - 23%  */
-	{2, 0}, /* 2461262 - 9 August 2026 - 14%  */
-	{1, 0}, /* 2461263 - 10 August 2026 - 7%  */
-	{0, 0}, /* 2461264 - 11 August 2026 - 2%  */
-	{0, 0}, /* 2461265 - 12 August 2026 - 0%  */
-	{0, 1}, /* 2461266 - 13 August 2026 - 0%  */
-	{1, 1}, /* 2461267 - 14 August 2026 - 4%  */
-	{1, 1}, /* 2461268 - 15 August 2026 - 9%  */
-	{2, 1}, /* 2461269 - 16 August 2026 - 16%  */
-	{4, 1}, /* 2461270 - 17 August 2026 - 25%  */
-	{5, 1}, /* 2461271 - 18 August 2026 - 34%  */
-	{6, 1}, /* 2461272 - 19 August 2026 - 44%  */
-	{8, 1}, /* 2461273 - 20 August 2026 - 53%  */
-	{9, 1}, /* 2461274 - 21 August 2026 - 63%  */
-	{10, 1}, /* 2461275 - 22 August 2026 - 71%  */
-	{11, 1}, /* 2461276 - 23 August 2026 - 80%  */
-	{12, 1}, /* 2461277 - 24 August 2026 - 87%  */
-	{13, 1}  /* 2461278 - 25 August 2026 - 92%  */
-};
@@ -17,7 +17,12 @@
 */
 
 #include <pebble.h>
-#include "moonphase.h"
+#include "moonbuffer.h"
+#include "calendar.h"
+#include "format.h"
+#include "atlas.h"
+#include "fontcache.h"
+#include "telemetry.h"
 #include <stdint.h>
 
 /* #define REVERSE 1 */
@@ -29,227 +34,637 @@
 #define COLOR_BACKGROUND GColorBlack
 #endif
 
-Window *window;
+#define ALL_UNITS (SECOND_UNIT | MINUTE_UNIT | HOUR_UNIT | DAY_UNIT | MONTH_UNIT | YEAR_UNIT)
 
-TextLayer *time_text;
-TextLayer *day_text;
-TextLayer *moon_text;
-TextLayer *date_text;
-TextLayer *month_text;
-TextLayer *year_text;
-TextLayer *ampm_text;
-Layer *background;
-
-/* Moon Phase (0-14), Waxing Character, Waning Character */
-static char MoonPhaseCharLookup[15][2] =
+/* What a tile is: the rounded box drawn behind it (empty for AM/PM, which
+   sits in the time box), the rectangle its text is centred in, its font,
+   the tick units that change it and the function that writes its text. */
+typedef struct
 {
-	{'0','0'},  /* 0 */
-	{'A','Z'},  /* 1 */
-	{'B','Y'},  /* 2 */
-	{'C','X'},  /* 3 */
-	{'D','W'},  /* 4 */
-	{'E','V'},  /* 5 */
-	{'F','U'},  /* 6 */
-	{'G','T'},  /* 7 */
-	{'H','S'},  /* 8 */
-	{'I','R'},  /* 9 */
-	{'J','Q'}, /* 10 */
-	{'K','P'}, /* 11 */
-	{'L','O'}, /* 12 */
-	{'M','N'}, /* 13 */
-	{'1','1'}  /* 14 */
-};
+	GRect box;
+	uint8_t radius;
+	GRect frame;
+	uint32_t font;
+	TimeUnits units;
+	void (*content)(char *buffer, const struct tm *tick_time);
+} TileSpec;
+
+/* Fonts are resources, or with the glyph atlas its fonts */
+#ifdef SPRITE_ATLAS
+#define TILE_FONT(resource, atlas) (atlas)
+#else
+#define TILE_FONT(resource, atlas) (resource)
+#endif
+
+/* The text a tile was last given, so an update that produces the same text
+   does not dirty the face again, and with the atlas the pen position that
+   centres it, worked out when the text changes. */
+typedef struct
+{
+	char text[6];
+#ifdef SPRITE_ATLAS
+	int16_t pen;
+#endif
+} Tile;
+
+enum { TILE_TIME, TILE_DAY, TILE_MOON, TILE_DATE, TILE_MONTH, TILE_YEAR, TILE_AMPM, TILE_COUNT };
+
+/* Persistent storage keys */
+#define PERSIST_KEY_TILES 1
+
+/* The text every tile showed when the window last unloaded, stamped with the
+   layout version, clock style and minute it was worked out for, so the next
+   load can show it at once and recompute only the tiles that have changed. */
+#define TILE_STATE_VERSION 1
+
+typedef struct
+{
+	uint8_t version;
+	uint8_t clock_24h;
+	int16_t year;
+	uint8_t month, mday, hour, minute;
+	char text[TILE_COUNT][6];
+} TileState;
+
+Window *window;
+
+Tile tiles[TILE_COUNT];
+#ifndef SPRITE_ATLAS
+/* The fonts of the time and of the tiles restored from storage are loaded
+   with the window, so the first frame shows them; the others follow this
+   long after */
+#define DEFERRED_FONTS_MS 50
 
-/*  JDATE  --  Convert internal date to Julian day.  */
+GFont fonts[TILE_COUNT];
+AppTimer *font_timer;
+#endif
+Layer *face;
+GBitmap *background_cache;
+#ifdef FRAMEBUFFER_TILES
+uint8_t tiles_dirty;
+uint8_t tile_overlaps[TILE_COUNT];
+bool backdrop_dirty;
+#endif
+bool clock_24h;
+struct tm last_tick;
 
-long jdate(struct tm *t)
+// content function for the time tile
+void tile_time(char *buffer, const struct tm *tick_time)
 {
-	long c, m, y;
-
-	y = t->tm_year + 1900;
-	m = t->tm_mon + 1;
-	if (m > 2)
-	   m = m - 3;
-	else {
-	   m = m + 9;
-	   y--;
-	}
-	c = y / 100L;		   /* Compute century */
-	y -= 100L * c;
-	return t->tm_mday + (c * 146097L) / 4 + (y * 1461L) / 4 +
-	    (m * 153L + 2) / 5 + 1721119L;
+	format_time(buffer, tick_time, clock_24h);
 }
 
-// utility function to strip a leading space or zero from a string.
-char* strip(char* input)
+// content function for the AM/PM tile, empty with the 24-hour clock
+void tile_ampm(char *buffer, const struct tm *tick_time)
 {
-	if (strlen(input) > 1 && (input[0] == ' ' || input[0] == '0'))
+	if (clock_24h)
+	{
+		buffer[0] = '\0';
+	}
+	else
 	{
-		return input + 1;
+		format_ampm(buffer, tick_time);
 	}
+}
 
-	return input;
+// utility function to read a moon buffer from storage, or an empty one if there is none
+void load_moon_buffer(uint32_t key, MoonBuffer *moon)
+{
+	if (persist_read_data(key, moon, sizeof(*moon)) != (int) sizeof(*moon))
+	{
+		memset(moon, 0, sizeof(*moon));
+	}
 }
 
-// callback function for rendering the background layer
-void background_update_callback(Layer *me, GContext *ctx) {
-    graphics_context_set_fill_color(ctx, COLOR_FOREGROUND);
-    graphics_fill_rect(ctx, GRect(2,8,140,68), 4, GCornersAll); /* Time Box */
-    graphics_fill_rect(ctx, GRect(2,81,68,43), 4, GCornersAll); /* Day Box */
-    graphics_fill_rect(ctx, GRect(74,81,68,43), 4, GCornersAll); /* Moon Box */
-    graphics_fill_rect(ctx, GRect(2,128,32,32), 4, GCornersAll); /* Date Box */
-    graphics_fill_rect(ctx, GRect(38,128,68,32), 4, GCornersAll); /* Month Box */
-    graphics_fill_rect(ctx, GRect(110,128,32,32), 4, GCornersAll); /* Year Box */
+// content function for the moon tile: the phase glyph for the day of the month
+void tile_moon(char *buffer, const struct tm *tick_time)
+{
+	/* The background worker keeps the glyphs for the days ahead; the phone's
+	   stand in when it has not run */
+	MoonBuffer moon;
+	int32_t jdn = jdn_from_civil(tick_time->tm_year + 1900, tick_time->tm_mon + 1, tick_time->tm_mday);
+	load_moon_buffer(PERSIST_KEY_MOON, &moon);
+	buffer[0] = moon_buffer_glyph(&moon, jdn);
+	if (!buffer[0])
+	{
+		load_moon_buffer(PERSIST_KEY_MOON_PHONE, &moon);
+		buffer[0] = moon_buffer_glyph(&moon, jdn);
+	}
+	buffer[1] = '\0';
 }
 
-// callback function for minute tick events that update the time and date display
-void handle_tick(struct tm *tick_time, TimeUnits units_changed)
-{	long arypos;
-	static char time[]   = "     ";
-	static char day[]    = "   ";
-	static char moon[]   = " ";
-	static char date[]   = "  ";
-	static char month[]  = "   ";
-	static char year[]   = "  ";
-	static char ampm[]   = "  ";
-	static int tm_mday = -1;
-	static int tm_mon = -1;
-	static int tm_year = -1;
-	static int tm_wday = -1;
-
-	/* Set time and AM/PM if not 24-hour*/
-	if (clock_is_24h_style())
-	{
-		strftime(time, sizeof(time), "%R", tick_time);
-		ampm[0] = '\0';
+/* The face, in drawing order */
+static const TileSpec TileSpecs[TILE_COUNT] =
+{
+	/* Time */
+	{{{2, 8}, {140, 68}}, 4, {{2, 8 + 4}, {140, 68 - 4}},
+		TILE_FONT(RESOURCE_ID_FONT_WW_DIGITAL_SUBSET_52, ATLAS_FONT_TIME), MINUTE_UNIT, tile_time},
+	/* Day of the week */
+	{{{2, 81}, {68, 43}}, 4, {{2, 81 + 2}, {68, 43 - 2}},
+		TILE_FONT(RESOURCE_ID_FONT_WW_DIGITAL_DOW_SUBSET_33, ATLAS_FONT_DAY), DAY_UNIT, format_weekday},
+	/* Moon phase */
+	{{{74, 81}, {68, 43}}, 4, {{74, 85 + 2}, {68, 43 - 2}},
+		TILE_FONT(RESOURCE_ID_FONT_MOONPHASE_33, ATLAS_FONT_MOON), DAY_UNIT, tile_moon},
+	/* Day of the month */
+	{{{2, 128}, {32, 32}}, 4, {{2, 128 + 2}, {32, 32 - 2}},
+		TILE_FONT(RESOURCE_ID_FONT_WW_DIGITAL_DATE_SUBSET_22, ATLAS_FONT_DATE), DAY_UNIT, format_date},
+	/* Month */
+	{{{38, 128}, {68, 32}}, 4, {{38, 128 + 2}, {68, 32 - 2}},
+		TILE_FONT(RESOURCE_ID_FONT_WW_DIGITAL_DATE_SUBSET_22, ATLAS_FONT_DATE), MONTH_UNIT, format_month},
+	/* Year */
+	{{{110, 128}, {32, 32}}, 4, {{110, 128 + 2}, {32, 32 - 2}},
+		TILE_FONT(RESOURCE_ID_FONT_WW_DIGITAL_DATE_SUBSET_22, ATLAS_FONT_DATE), YEAR_UNIT, format_year},
+	/* AM/PM, inside the time box */
+	{{{0, 0}, {0, 0}}, 0, {{4, 63}, {16, 12}},
+		TILE_FONT(RESOURCE_ID_FONT_WW_DIGITAL_SUBSET_10, ATLAS_FONT_AMPM), HOUR_UNIT, tile_ampm},
+};
+
+// utility function to keep a copy of the tile backdrop just drawn into the frame buffer,
+// in the frame's own format so that restoring it is a straight copy: 1-bit on aplite,
+// 3360 bytes of heap, and GColor8 on basalt, 24192 bytes
+void cache_background(GContext *ctx)
+{
+	GBitmap *frame = graphics_capture_frame_buffer(ctx);
+	if (!frame)
+	{
+		return;
 	}
-	else
+
+	GRect bounds = gbitmap_get_bounds(frame);
+	background_cache = gbitmap_create_blank(bounds.size, gbitmap_get_format(frame));
+	if (background_cache)
 	{
-		strftime(time, sizeof(time), "%I:%M", tick_time);
-		strftime(ampm, sizeof(ampm), "%p", tick_time);
+		uint16_t from = gbitmap_get_bytes_per_row(frame);
+		uint16_t to = gbitmap_get_bytes_per_row(background_cache);
+		uint8_t *src = gbitmap_get_data(frame);
+		uint8_t *dst = gbitmap_get_data(background_cache);
+		for (int y = 0; y < bounds.size.h; y++)
+		{
+			memcpy(dst + y * to, src + y * from, from < to ? from : to);
+		}
 	}
-	text_layer_set_text(time_text, strip(time));
-	text_layer_set_text(ampm_text, ampm);
+	graphics_release_frame_buffer(ctx, frame);
+}
 
-	/* Set day of the week */
-	if (tm_wday != tick_time->tm_wday)
+// utility function to drop the cached backdrop, so the next frame draws and caches it again
+void invalidate_background(void)
+{
+	if (background_cache)
+	{
+		gbitmap_destroy(background_cache);
+		background_cache = NULL;
+	}
+}
+
+// utility function to draw the tile boxes and keep a copy of the result
+void draw_backdrop(GContext *ctx)
+{
+	graphics_context_set_fill_color(ctx, COLOR_FOREGROUND);
+	for (int i = 0; i < TILE_COUNT; i++)
 	{
-		strftime(day, sizeof(day), "%a", tick_time);
-		text_layer_set_text(day_text, day);
-		tm_wday = tick_time->tm_wday;
+		if (TileSpecs[i].box.size.w)
+		{
+			graphics_fill_rect(ctx, TileSpecs[i].box, TileSpecs[i].radius, GCornersAll);
+		}
 	}
 
-	/* Set day of the month and associated moon phase for day of the month */
-	if (tm_mday != tick_time->tm_mday)
+	/* Nothing but the window background is drawn before the backdrop,
+	   so the frame buffer now holds exactly the backdrop */
+	cache_background(ctx);
+}
+
+#ifdef FRAMEBUFFER_TILES
+#define ALL_TILES ((1 << TILE_COUNT) - 1)
+
+// utility function to copy a rectangle of the cached backdrop back into the frame buffer
+void restore_backdrop(GBitmap *frame, GRect rect)
+{
+	uint16_t from = gbitmap_get_bytes_per_row(background_cache);
+	uint16_t to = gbitmap_get_bytes_per_row(frame);
+	uint8_t *src = gbitmap_get_data(background_cache);
+	uint8_t *dst = gbitmap_get_data(frame);
+	bool bw = gbitmap_get_format(frame) == GBitmapFormat1Bit;
+	int x0 = rect.origin.x, x1 = rect.origin.x + rect.size.w;
+
+	for (int y = rect.origin.y; y < rect.origin.y + rect.size.h; y++)
 	{
-		strftime(date, sizeof(date), "%e", tick_time);
-		text_layer_set_text(date_text, strip(date));
-		tm_mday = tick_time->tm_mday;
+		if (bw)
+		{
+			/* Whole bytes straight across, the partial bytes at each end under a mask */
+			for (int x = x0; x < x1; )
+			{
+				int n = x1 - x < 8 - (x & 7) ? x1 - x : 8 - (x & 7);
+				uint8_t mask = ((1 << n) - 1) << (x & 7);
+				uint8_t *d = dst + y * to + (x >> 3);
+				*d = (*d & ~mask) | (src[y * from + (x >> 3)] & mask);
+				x += n;
+			}
+		}
+		else
+		{
+			memcpy(dst + y * to + x0, src + y * from + x0, x1 - x0);
+		}
+	}
+}
+
+// callback function for window appear: anything may have drawn over the frame buffer meanwhile
+void main_window_appear(Window *window)
+{
+	backdrop_dirty = true;
+	tiles_dirty = ALL_TILES;
+}
 
-		/* Set Moon Phase */
+// utility function to write the tiles that changed straight into the frame buffer:
+// their rectangles are restored from the backdrop, then their glyphs blitted back
+void draw_tiles(GContext *ctx)
+{
+	GBitmap *frame = graphics_capture_frame_buffer(ctx);
+	if (!frame)
+	{
+		return;
+	}
 
-		/* Find the offset of today's julian date in the lookup table */
-		arypos = jdate(tick_time) - JULIAN_MOON_EPIC;
-		if (arypos >= 0 && arypos < MOONPHASE_ARRAY_SIZE)
+	if (backdrop_dirty)
+	{
+		restore_backdrop(frame, gbitmap_get_bounds(frame));
+		backdrop_dirty = false;
+	}
+	else
+	{
+		/* Restoring a tile erases any tile it overlaps, so those are redrawn too */
+		for (uint8_t last = 0; last != tiles_dirty; )
 		{
-			if (MoonPhaseDateLookup[arypos][1])
+			last = tiles_dirty;
+			for (int i = 0; i < TILE_COUNT; i++)
 			{
-				/* Waxing Moon */
-				moon[0] = MoonPhaseCharLookup[MoonPhaseDateLookup[arypos][0]][0];
+				if (tiles_dirty & (1 << i))
+				{
+					tiles_dirty |= tile_overlaps[i];
+				}
 			}
-			else
+		}
+		for (int i = 0; i < TILE_COUNT; i++)
+		{
+			if (tiles_dirty & (1 << i))
 			{
-				/* Waning Moon */
-				moon[0] = MoonPhaseCharLookup[MoonPhaseDateLookup[arypos][0]][1];
+				restore_backdrop(frame, TileSpecs[i].frame);
 			}
 		}
-		else
+	}
+	for (int i = 0; i < TILE_COUNT; i++)
+	{
+		if (tiles_dirty & (1 << i))
 		{
-			moon[0] = '\0';
+			atlas_blit_text(frame, tiles[i].text, TileSpecs[i].font, tiles[i].pen, TileSpecs[i].frame.origin.y, COLOR_BACKGROUND);
 		}
-		text_layer_set_text(moon_text, moon);
 	}
+	tiles_dirty = 0;
+	graphics_release_frame_buffer(ctx, frame);
+}
+#endif
 
-	/* Set name of the month */
-	if (tm_mon != tick_time->tm_mon)
+// callback function for rendering the face: the backdrop, drawn once and then
+// copied from the cache, and every tile's text over it
+void face_update_callback(Layer *me, GContext *ctx)
+{
+	TELEMETRY_START(telemetry_start);
+#ifdef FRAMEBUFFER_TILES
+	if (!background_cache)
+	{
+		/* The window is clear so earlier frames survive; the first one fills it */
+		graphics_context_set_fill_color(ctx, COLOR_BACKGROUND);
+		graphics_fill_rect(ctx, layer_get_bounds(me), 0, GCornerNone);
+		draw_backdrop(ctx);
+		tiles_dirty = ALL_TILES;
+	}
+	draw_tiles(ctx);
+#else
+	if (background_cache)
+	{
+		graphics_draw_bitmap_in_rect(ctx, background_cache, layer_get_bounds(me));
+	}
+	else
 	{
-		strftime(month, sizeof(month), "%b", tick_time);
-		text_layer_set_text(month_text, strip(month));
-		tm_mon = tick_time->tm_mon;
+		draw_backdrop(ctx);
 	}
 
-	/* Set year */
-	if (tm_year != tick_time->tm_year)
+#ifdef SPRITE_ATLAS
+	for (int i = 0; i < TILE_COUNT; i++)
 	{
-		strftime(year, sizeof(year), "%y", tick_time);
-		text_layer_set_text(year_text, year);
-		tm_year = tick_time->tm_year;
+		atlas_draw_text(ctx, tiles[i].text, TileSpecs[i].font, tiles[i].pen, TileSpecs[i].frame.origin.y, COLOR_BACKGROUND);
 	}
+#else
+	graphics_context_set_text_color(ctx, COLOR_BACKGROUND);
+	for (int i = 0; i < TILE_COUNT; i++)
+	{
+		if (!fonts[i])
+		{
+			continue;
+		}
+		graphics_draw_text(ctx, tiles[i].text, fonts[i], TileSpecs[i].frame, GTextOverflowModeWordWrap, GTextAlignmentCenter, NULL);
+	}
+#endif
+#endif
+	TELEMETRY_STOP(TELEMETRY_DRAW, telemetry_start);
 }
 
-// utility function for initializing a text layer
-TextLayer* init_text(int x, int y, int width, int height, uint32_t font, GColor TextColor)
-{	TextLayer* textlayer;
-	textlayer = text_layer_create(GRect(x, y, width, height));
-	text_layer_set_text_alignment(textlayer, GTextAlignmentCenter);
-	text_layer_set_text_color(textlayer, COLOR_BACKGROUND);
-	text_layer_set_background_color(textlayer, GColorClear);
-	text_layer_set_font(textlayer, fonts_load_custom_font(resource_get_handle(font)));	return textlayer;
+// utility function to hand a tile new text only when it differs from what it shows
+void set_tile_text(int i, const char *text)
+{
+	Tile *tile = &tiles[i];
+
+	if (strcmp(tile->text, text) != 0)
+	{
+		strncpy(tile->text, text, sizeof(tile->text) - 1);
+#ifdef SPRITE_ATLAS
+		tile->pen = TileSpecs[i].frame.origin.x + (TileSpecs[i].frame.size.w - atlas_text_width(tile->text, TileSpecs[i].font)) / 2;
+#endif
+#ifdef FRAMEBUFFER_TILES
+		tiles_dirty |= 1 << i;
+#endif
+		TELEMETRY_CHANGE(i);
+		layer_mark_dirty(face);
+	}
 }
 
+// callback function for minute tick events that update the time and date display
+void handle_tick(struct tm *tick_time, TimeUnits units_changed)
+{
+	char buffer[8];
+	TELEMETRY_START(telemetry_start);
+
+	last_tick = *tick_time;
+	for (int i = 0; i < TILE_COUNT; i++)
+	{
+		if (units_changed & TileSpecs[i].units)
+		{
+			TileSpecs[i].content(buffer, tick_time);
+			set_tile_text(i, buffer);
+		}
+	}
+	TELEMETRY_STOP(TELEMETRY_TICK, telemetry_start);
+}
+
+// utility function to show the moon glyph again after the buffer changes
+void refresh_moon_tile(void)
+{
+	char buffer[8];
+
+	if (face)
+	{
+		TileSpecs[TILE_MOON].content(buffer, &last_tick);
+		set_tile_text(TILE_MOON, buffer);
+	}
+}
+
+// utility function to show the tile text saved at the last unload; returns the units
+// that have changed since it was worked out, or all of them if none was saved
+TimeUnits restore_tile_state(const struct tm *now)
+{
+	TileState state;
+
+	if (persist_read_data(PERSIST_KEY_TILES, &state, sizeof(state)) != (int) sizeof(state) ||
+		state.version != TILE_STATE_VERSION || state.clock_24h != clock_24h)
+	{
+		return ALL_UNITS;
+	}
+
+	for (int i = 0; i < TILE_COUNT; i++)
+	{
+		state.text[i][sizeof(state.text[i]) - 1] = '\0';
+		set_tile_text(i, state.text[i]);
+	}
+
+	/* A change in a unit changes every smaller one: a year on, the weekday differs */
+	if (state.year != now->tm_year + 1900)
+	{
+		return ALL_UNITS;
+	}
+	if (state.month != now->tm_mon + 1)
+	{
+		return MONTH_UNIT | DAY_UNIT | HOUR_UNIT | MINUTE_UNIT;
+	}
+	if (state.mday != now->tm_mday)
+	{
+		return DAY_UNIT | HOUR_UNIT | MINUTE_UNIT;
+	}
+	if (state.hour != now->tm_hour)
+	{
+		return HOUR_UNIT | MINUTE_UNIT;
+	}
+	if (state.minute != now->tm_min)
+	{
+		return MINUTE_UNIT;
+	}
+	return 0;
+}
+
+// utility function to save the tile text and when it was worked out, for the next load
+void save_tile_state(void)
+{
+	TileState state;
+
+	state.version = TILE_STATE_VERSION;
+	state.clock_24h = clock_24h;
+	state.year = last_tick.tm_year + 1900;
+	state.month = last_tick.tm_mon + 1;
+	state.mday = last_tick.tm_mday;
+	state.hour = last_tick.tm_hour;
+	state.minute = last_tick.tm_min;
+	for (int i = 0; i < TILE_COUNT; i++)
+	{
+		memcpy(state.text[i], tiles[i].text, sizeof(state.text[i]));
+	}
+	persist_write_data(PERSIST_KEY_TILES, &state, sizeof(state));
+}
+
+#ifndef SPRITE_ATLAS
+// callback function for the font timer: load the fonts the first frame went without
+// and draw the tiles that use them, whose text is already set
+void load_deferred_fonts(void *data)
+{
+	font_timer = NULL;
+	for (int i = 0; i < TILE_COUNT; i++)
+	{
+		if (!fonts[i])
+		{
+			fonts[i] = font_cache_get(TileSpecs[i].font);
+		}
+	}
+	layer_mark_dirty(face);
+}
+
+// utility function to load the fonts the first frame needs: the time's, and those of
+// the tiles whose restored text the units changed do not recompute
+void load_first_fonts(TimeUnits units)
+{
+	bool deferred = false;
+
+	for (int i = 0; i < TILE_COUNT; i++)
+	{
+		if (i == TILE_TIME || !(TileSpecs[i].units & units))
+		{
+			fonts[i] = font_cache_get(TileSpecs[i].font);
+		}
+		else
+		{
+			deferred = true;
+		}
+	}
+	if (deferred)
+	{
+		font_timer = app_timer_register(DEFERRED_FONTS_MS, load_deferred_fonts, NULL);
+	}
+}
+#endif
+
 static void main_window_load(Window *window) {
-	background = layer_create(layer_get_bounds(window_get_root_layer(window)));	layer_set_update_proc(background, &background_update_callback);
-	layer_add_child(window_get_root_layer(window), background);
+	TELEMETRY_START(telemetry_start);
+	face = layer_create(layer_get_bounds(window_get_root_layer(window)));
+	layer_set_update_proc(face, &face_update_callback);
+	layer_add_child(window_get_root_layer(window), face);
 
+#ifdef FRAMEBUFFER_TILES
+	window_set_background_color(window, GColorClear);
+#else
 	window_set_background_color(window, COLOR_BACKGROUND);
+#endif
+	invalidate_background();
 
-	time_text = init_text(2, 8 + 4, 140, 68 - 4, RESOURCE_ID_FONT_WW_DIGITAL_SUBSET_52, COLOR_BACKGROUND);
-	day_text = init_text(2, 81 + 2, 68, 43 - 2, RESOURCE_ID_FONT_WW_DIGITAL_DOW_SUBSET_33, COLOR_BACKGROUND);
-	moon_text = init_text(74, 85 + 2, 68, 43 - 2, RESOURCE_ID_FONT_MOONPHASE_33, COLOR_BACKGROUND);
-	date_text = init_text(2, 128 + 2, 32, 32 - 2, RESOURCE_ID_FONT_WW_DIGITAL_DATE_SUBSET_22,COLOR_BACKGROUND);
-	month_text = init_text(38, 128 + 2, 68, 32 - 2, RESOURCE_ID_FONT_WW_DIGITAL_DATE_SUBSET_22,COLOR_BACKGROUND);
-	year_text= init_text(110, 128 + 2, 32, 32 - 2, RESOURCE_ID_FONT_WW_DIGITAL_DATE_SUBSET_22,COLOR_BACKGROUND);
-	ampm_text = init_text(4, 63, 16, 12, RESOURCE_ID_FONT_WW_DIGITAL_SUBSET_10,COLOR_BACKGROUND);
-
-	layer_add_child(background, text_layer_get_layer(time_text));
-	layer_add_child(background, text_layer_get_layer(day_text));
-	layer_add_child(background, text_layer_get_layer(moon_text));
-	layer_add_child(background, text_layer_get_layer(date_text));
-	layer_add_child(background, text_layer_get_layer(month_text));
-	layer_add_child(background, text_layer_get_layer(year_text));
-	layer_add_child(background, text_layer_get_layer(ampm_text));
+#ifdef SPRITE_ATLAS
+	if (!atlas_load())
+	{
+		APP_LOG(APP_LOG_LEVEL_ERROR, "Glyph atlas did not load");
+	}
+#endif
+	for (int i = 0; i < TILE_COUNT; i++)
+	{
+		tiles[i].text[0] = '\0';
+	}
+
+#ifdef FRAMEBUFFER_TILES
+	for (int i = 0; i < TILE_COUNT; i++)
+	{
+		tile_overlaps[i] = 0;
+		for (int j = 0; j < TILE_COUNT; j++)
+		{
+			GRect a = TileSpecs[i].frame, b = TileSpecs[j].frame;
+			if (j != i && a.origin.x < b.origin.x + b.size.w && b.origin.x < a.origin.x + a.size.w &&
+				a.origin.y < b.origin.y + b.size.h && b.origin.y < a.origin.y + a.size.h)
+			{
+				tile_overlaps[i] |= 1 << j;
+			}
+		}
+	}
+#endif
+
+	/* The clock style can only change in Settings, which reloads the window */
+	clock_24h = clock_is_24h_style();
 
 	time_t t;
 	time(&t);
-	handle_tick(localtime(&t), MINUTE_UNIT | DAY_UNIT);
+	struct tm *now = localtime(&t);
+	TimeUnits units = restore_tile_state(now);
+	last_tick = *now;
+	if (units)
+	{
+		handle_tick(now, units);
+	}
+
+	/* The moon glyph comes from the buffer, not the date: what was saved may
+	   predate the worker's refill, whose message went to no window */
+	if (!(units & TileSpecs[TILE_MOON].units))
+	{
+		refresh_moon_tile();
+	}
+#ifndef SPRITE_ATLAS
+	load_first_fonts(units);
+#endif
+	TELEMETRY_STOP(TELEMETRY_LOAD, telemetry_start);
 }
 
-static void main_window_unload(Window *window) {	text_layer_destroy(time_text);
-	text_layer_destroy(day_text);
-	text_layer_destroy(moon_text);
-	text_layer_destroy(date_text);
-	text_layer_destroy(month_text);
-	text_layer_destroy(year_text);
-	text_layer_destroy(ampm_text);
+static void main_window_unload(Window *window) {
+	save_tile_state();
+	layer_destroy(face);
+	face = NULL;
+#ifdef SPRITE_ATLAS
+	atlas_unload();
+#else
+	if (font_timer)
+	{
+		app_timer_cancel(font_timer);
+		font_timer = NULL;
+	}
+	for (int i = 0; i < TILE_COUNT; i++)
+	{
+		if (fonts[i])
+		{
+			font_cache_release(TileSpecs[i].font);
+			fonts[i] = NULL;
+		}
+	}
+#endif
+	invalidate_background();
 }
 
 
+// callback function for worker messages: new moon glyphs, which may include today's
+void handle_worker_message(uint16_t type, AppWorkerMessage *message)
+{
+	if (type == MOON_BUFFER_UPDATED)
+	{
+		refresh_moon_tile();
+	}
+}
+
+// callback function for AppMessages from the phone: a batch of moon glyphs, kept
+// in the phone's buffer, which nothing else writes
+void handle_inbox(DictionaryIterator *iterator, void *context)
+{
+	Tuple *first = dict_find(iterator, MESSAGE_KEY_MOON_FIRST);
+	Tuple *glyphs = dict_find(iterator, MESSAGE_KEY_MOON_GLYPHS);
+	if (!first || !glyphs || first->type != TUPLE_INT || glyphs->type != TUPLE_BYTE_ARRAY)
+	{
+		return;
+	}
+
+	MoonBuffer moon;
+	load_moon_buffer(PERSIST_KEY_MOON_PHONE, &moon);
+	moon_buffer_merge(&moon, first->value->int32, (const char *) glyphs->value->data, glyphs->length);
+	persist_write_data(PERSIST_KEY_MOON_PHONE, &moon, sizeof(moon));
+	refresh_moon_tile();
+}
+
 // callback function for the app initialization
 void handle_init()
 {
+	TELEMETRY_INIT();
 	window = window_create();
 	window_set_window_handlers(window, (WindowHandlers) {
 		.load = main_window_load,
+#ifdef FRAMEBUFFER_TILES
+		.appear = main_window_appear,
+#endif
 		.unload = main_window_unload
 	});
 	window_stack_push(window, true /* Animated */);
 	tick_timer_service_subscribe(MINUTE_UNIT, handle_tick);
+	app_worker_message_subscribe(handle_worker_message);
+	app_message_register_inbox_received(handle_inbox);
+	app_message_open(dict_calc_buffer_size(2, sizeof(int32_t), MOON_BATCH_DAYS), 0);
+	if (!app_worker_is_running())
+	{
+		app_worker_launch();
+	}
 }
 
 void handle_deinit(void)
 {
+	app_message_deregister_callbacks();
+	app_worker_message_unsubscribe();
 	tick_timer_service_unsubscribe();
 	window_destroy(window);
+	TELEMETRY_DEINIT();
 }
 
 // main entry point of this Pebble watchface
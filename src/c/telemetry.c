@@ -0,0 +1,129 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	telemetry.c
+
+   Purpose:	  		Hot path timing kept per hour in persistent storage, and
+   					logged over APP_LOG on a tap (see telemetry.h).
+*/
+
+#include "telemetry.h"
+
+#ifdef TELEMETRY
+
+static TelemetryRing ring;
+
+static const char *const PointNames[TELEMETRY_POINTS] = { "load", "tick", "draw" };
+
+// utility function to find the slot of the hour now, moving the ring on to a
+// fresh one when the hour has turned; the finished hour is saved then
+static TelemetrySlot *current_slot(void)
+{
+	int32_t hour = time(NULL) / 3600;
+	TelemetrySlot *slot = &ring.slots[ring.head];
+
+	if (slot->hour != hour)
+	{
+		if (slot->hour)
+		{
+			ring.head = (ring.head + 1) % TELEMETRY_SLOTS;
+			slot = &ring.slots[ring.head];
+		}
+		memset(slot, 0, sizeof(*slot));
+		slot->hour = hour;
+		persist_write_data(PERSIST_KEY_TELEMETRY, &ring, sizeof(ring));
+	}
+	return slot;
+}
+
+// callback function for taps: the figures go to the log
+static void handle_tap(AccelAxisType axis, int32_t direction)
+{
+	telemetry_dump();
+}
+
+void telemetry_init(void)
+{
+	if (persist_read_data(PERSIST_KEY_TELEMETRY, &ring, sizeof(ring)) != (int) sizeof(ring) ||
+		ring.version != TELEMETRY_VERSION || ring.head >= TELEMETRY_SLOTS)
+	{
+		memset(&ring, 0, sizeof(ring));
+		ring.version = TELEMETRY_VERSION;
+	}
+	accel_tap_service_subscribe(handle_tap);
+}
+
+void telemetry_deinit(void)
+{
+	accel_tap_service_unsubscribe();
+	persist_write_data(PERSIST_KEY_TELEMETRY, &ring, sizeof(ring));
+}
+
+uint32_t telemetry_now(void)
+{
+	time_t seconds;
+	uint16_t ms;
+
+	time_ms(&seconds, &ms);
+	return (uint32_t) seconds * 1000 + ms;
+}
+
+void telemetry_record(int point, uint32_t start)
+{
+	uint32_t elapsed = telemetry_now() - start;
+	TelemetryTiming *timing = &current_slot()->timing[point];
+
+	if (elapsed > UINT16_MAX)
+	{
+		elapsed = UINT16_MAX;
+	}
+	if (!timing->count || elapsed < timing->min)
+	{
+		timing->min = elapsed;
+	}
+	if (elapsed > timing->max)
+	{
+		timing->max = elapsed;
+	}
+	timing->total += elapsed;
+	if (timing->count < UINT16_MAX)
+	{
+		timing->count++;
+	}
+}
+
+void telemetry_count_change(int tile)
+{
+	if (tile < TELEMETRY_TILES)
+	{
+		current_slot()->changes[tile]++;
+	}
+}
+
+void telemetry_dump(void)
+{
+	for (int n = 0; n < TELEMETRY_SLOTS; n++)
+	{
+		TelemetrySlot *slot = &ring.slots[(ring.head + TELEMETRY_SLOTS - n) % TELEMETRY_SLOTS];
+		if (!slot->hour)
+		{
+			continue;
+		}
+
+		time_t t = (time_t) slot->hour * 3600;
+		struct tm *tm = localtime(&t);
+		APP_LOG(APP_LOG_LEVEL_INFO, "Telemetry %d-%02d-%02d %02d:00", tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday, tm->tm_hour);
+		for (int i = 0; i < TELEMETRY_POINTS; i++)
+		{
+			TelemetryTiming *timing = &slot->timing[i];
+			if (timing->count)
+			{
+				APP_LOG(APP_LOG_LEVEL_INFO, "  %s: %d calls, min %d avg %d max %d ms", PointNames[i], timing->count,
+					timing->min, (int) (timing->total / timing->count), timing->max);
+			}
+		}
+		APP_LOG(APP_LOG_LEVEL_INFO, "  tile changes: %d %d %d %d %d %d %d %d", slot->changes[0], slot->changes[1],
+			slot->changes[2], slot->changes[3], slot->changes[4], slot->changes[5], slot->changes[6], slot->changes[7]);
+	}
+}
+
+#endif
@@ -0,0 +1,93 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	telemetry.h
+
+   Purpose:	  		Timing of the hot paths on the watch itself: how long the
+   					tick handler, the face redraw and the window load take, and
+   					how often each tile's text changes, kept per hour in a small
+   					ring in persistent storage and logged when the watch is tapped.
+*/
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <pebble.h>
+
+/* Time the hot paths and count tile changes; without it every hook below
+   compiles to nothing */
+/* #define TELEMETRY 1 */
+
+#ifdef TELEMETRY
+
+/* Persistent storage key of the ring, after the tiles and the moon buffer */
+#define PERSIST_KEY_TELEMETRY 3
+
+#define TELEMETRY_VERSION 1
+
+/* Hours of history kept, and tiles counted */
+#define TELEMETRY_SLOTS 4
+#define TELEMETRY_TILES 8
+
+/* The paths timed */
+enum { TELEMETRY_LOAD, TELEMETRY_TICK, TELEMETRY_DRAW, TELEMETRY_POINTS };
+
+/* Milliseconds one path took in an hour: fewest, most and in all */
+typedef struct
+{
+	uint32_t total;
+	uint16_t count;
+	uint16_t min, max;
+} TelemetryTiming;
+
+/* One hour of figures, stamped with the hour since the epoch it covers */
+typedef struct
+{
+	int32_t hour;
+	TelemetryTiming timing[TELEMETRY_POINTS];
+	uint16_t changes[TELEMETRY_TILES];
+} TelemetrySlot;
+
+/* The ring as it is persisted: head is the slot of the current hour */
+typedef struct
+{
+	uint8_t version;
+	uint8_t head;
+	uint16_t reserved;
+	TelemetrySlot slots[TELEMETRY_SLOTS];
+} TelemetryRing;
+
+// load the ring kept from earlier runs and log it on a tap
+void telemetry_init(void);
+
+// save the ring and stop listening for taps
+void telemetry_deinit(void);
+
+// the wall clock in milliseconds, for timing a path
+uint32_t telemetry_now(void);
+
+// add the time since start, from telemetry_now(), to the current hour of a path
+void telemetry_record(int point, uint32_t start);
+
+// count a change of a tile's text in the current hour
+void telemetry_count_change(int tile);
+
+// log every hour kept, newest first
+void telemetry_dump(void);
+
+#define TELEMETRY_INIT() telemetry_init()
+#define TELEMETRY_DEINIT() telemetry_deinit()
+#define TELEMETRY_START(start) uint32_t start = telemetry_now()
+#define TELEMETRY_STOP(point, start) telemetry_record(point, start)
+#define TELEMETRY_CHANGE(tile) telemetry_count_change(tile)
+
+#else
+
+#define TELEMETRY_INIT()
+#define TELEMETRY_DEINIT()
+#define TELEMETRY_START(start)
+#define TELEMETRY_STOP(point, start)
+#define TELEMETRY_CHANGE(tile)
+
+#endif
+
+#endif
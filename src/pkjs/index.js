@@ -0,0 +1,52 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	index.js
+
+   Purpose:	  		Phone side: works out the moon glyphs for the months ahead
+   					and sends them to the watch in a few batched AppMessages,
+   					which the watch keeps in the same buffer as the worker.
+*/
+
+var keys = require('message_keys');
+var moon = require('./moon');
+
+/* As in src/c/moonbuffer.h: a sync is MOON_SYNC_DAYS glyphs from today,
+   MOON_BATCH_DAYS to a message */
+var MOON_SYNC_DAYS = 192;
+var MOON_BATCH_DAYS = 64;
+
+/* A message that is not acknowledged is sent again this many times */
+var RETRIES = 2;
+
+// send the batches one after another, each once the one before is acknowledged
+function sendBatches(first, codes, offset, retries) {
+	if (offset >= codes.length) {
+		console.log('Moon sync: ' + codes.length + ' days from JDN ' + first);
+		return;
+	}
+
+	var message = {};
+	message[keys.MOON_FIRST] = first + offset;
+	message[keys.MOON_GLYPHS] = codes.slice(offset, offset + MOON_BATCH_DAYS);
+	Pebble.sendAppMessage(message, function() {
+		sendBatches(first, codes, offset + MOON_BATCH_DAYS, RETRIES);
+	}, function() {
+		if (retries > 0) {
+			sendBatches(first, codes, offset, retries - 1);
+		} else {
+			console.log('Moon sync: batch at JDN ' + (first + offset) + ' not delivered');
+		}
+	});
+}
+
+// work out the glyphs from the watch's civil date today, which the phone shares
+function sync() {
+	var now = new Date();
+	var today = moon.jdnFromCivil(now.getFullYear(), now.getMonth() + 1, now.getDate());
+
+	sendBatches(today, moon.glyphs(today, MOON_SYNC_DAYS), 0, RETRIES);
+}
+
+Pebble.addEventListener('ready', function() {
+	sync();
+});
@@ -0,0 +1,127 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	moon.js
+
+   Purpose:	  		The moon phase model of util/moonlib.c on the phone, and the
+   					glyph the watch shows for each day.  No network is used.
+*/
+
+/* Constants from util/moonlib.h, epoch 1980.0 */
+var epoch = 2444238.5;		/* 1980 January 0.0 */
+var elonge = 278.833540;	/* Ecliptic longitude of the Sun at epoch 1980.0 */
+var elongp = 282.596403;	/* Ecliptic longitude of the Sun at perigee */
+var eccent = 0.016718;		/* Eccentricity of Earth's orbit */
+var sunsmax = 1.495985e8;	/* Semi-major axis of Earth's orbit, km */
+var sunangsiz = 0.533128;	/* Sun's angular size, degrees, at semi-major axis distance */
+var mmlong = 64.975464;		/* Moon's mean longitude at the epoch */
+var mmlongp = 349.383063;	/* Mean longitude of the perigee at the epoch */
+var mlnode = 151.950429;	/* Mean longitude of the node at the epoch */
+var minc = 5.145396;		/* Inclination of the Moon's orbit */
+var mecc = 0.054900;		/* Eccentricity of the Moon's orbit */
+var mangsiz = 0.5181;		/* Moon's angular size at distance a from Earth */
+var msmax = 384401.0;		/* Semi-major axis of Moon's orbit in km */
+var synmonth = 29.53058868;	/* Synodic month (new Moon to new Moon) */
+
+/* Moon Phase (0-14), Waxing Character, Waning Character, as in the worker */
+var MoonPhaseCharLookup = ['00', 'AZ', 'BY', 'CX', 'DW', 'EV', 'FU', 'GT', 'HS', 'IR', 'JQ', 'KP', 'LO', 'MN', '11'];
+
+function fixangle(a) {
+	return a - 360.0 * Math.floor(a / 360.0);
+}
+
+function torad(d) {
+	return d * (Math.PI / 180.0);
+}
+
+function todeg(r) {
+	return r * (180.0 / Math.PI);
+}
+
+// solve the equation of Kepler for mean anomaly m in degrees
+function kepler(m, ecc) {
+	var e, delta;
+
+	e = m = torad(m);
+	do {
+		delta = e - ecc * Math.sin(e) - m;
+		e -= delta / (1 - ecc * Math.cos(e));
+	} while (Math.abs(delta) > 1E-6);
+	return e;
+}
+
+// phase() of moonlib at Julian date pdate: the terminator phase angle as a
+// fraction of a turn, with the illuminated fraction, age and distances
+function phase(pdate) {
+	var Day = pdate - epoch;
+	var N = fixangle((360 / 365.2422) * Day);
+	var M = fixangle(N + elonge - elongp);
+	var Ec = kepler(M, eccent);
+	Ec = Math.sqrt((1 + eccent) / (1 - eccent)) * Math.tan(Ec / 2);
+	Ec = 2 * todeg(Math.atan(Ec));
+	var Lambdasun = fixangle(Ec + elongp);
+	var F = (1 + eccent * Math.cos(torad(Ec))) / (1 - eccent * eccent);
+
+	var ml = fixangle(13.1763966 * Day + mmlong);
+	var MM = fixangle(ml - 0.1114041 * Day - mmlongp);
+	var MN = fixangle(mlnode - 0.0529539 * Day);
+	var Ev = 1.2739 * Math.sin(torad(2 * (ml - Lambdasun) - MM));
+	var Ae = 0.1858 * Math.sin(torad(M));
+	var A3 = 0.37 * Math.sin(torad(M));
+	var MmP = MM + Ev - Ae - A3;
+	var mEc = 6.2886 * Math.sin(torad(MmP));
+	var A4 = 0.214 * Math.sin(torad(2 * MmP));
+	var lP = ml + Ev + mEc - Ae + A4;
+	var V = 0.6583 * Math.sin(torad(2 * (lP - Lambdasun)));
+	var lPP = lP + V;
+	var NP = MN - 0.16 * Math.sin(torad(M));
+	var y = Math.sin(torad(lPP - NP)) * Math.cos(torad(minc));
+	var x = Math.cos(torad(lPP - NP));
+	var Lambdamoon = todeg(Math.atan2(y, x)) + NP;
+	var BetaM = todeg(Math.asin(Math.sin(torad(lPP - NP)) * Math.sin(torad(minc))));
+
+	var MoonAge = lPP - Lambdasun;
+	var MoonDist = (msmax * (1 - mecc * mecc)) / (1 + mecc * Math.cos(torad(MmP + mEc)));
+
+	return {
+		phase: fixangle(MoonAge) / 360.0,
+		illumination: (1 - Math.cos(torad(MoonAge))) / 2,
+		age: synmonth * (fixangle(MoonAge) / 360.0),
+		dist: MoonDist,
+		angdia: mangsiz / (MoonDist / msmax),
+		sundist: sunsmax / F,
+		sunangdia: F * sunangsiz,
+		longitude: fixangle(Lambdamoon),
+		latitude: BetaM
+	};
+}
+
+// Julian day number of a proleptic Gregorian date, as calendar.h computes it
+function jdnFromCivil(year, month, day) {
+	var y = month <= 2 ? year - 1 : year;
+	var era = Math.floor(y / 400);
+	var yoe = y - era * 400;
+	var doy = Math.floor((153 * (month > 2 ? month - 3 : month + 9) + 2) / 5) + day - 1;
+	var doe = yoe * 365 + Math.floor(yoe / 4) - Math.floor(yoe / 100) + doy;
+	return era * 146097 + doe + 1721120;
+}
+
+// the moon font character codes for count days from JDN first: the phase at
+// noon UT of each day, waxing if it is larger than the day before's
+function glyphs(first, count) {
+	var codes = [];
+	var last = phase(first - 1).illumination;
+
+	for (var jdn = first; jdn < first + count; jdn++) {
+		var illumination = phase(jdn).illumination;
+		var index = Math.floor(illumination * 14 + 0.5);
+		codes.push(MoonPhaseCharLookup[index].charCodeAt(last < illumination ? 0 : 1));
+		last = illumination;
+	}
+	return codes;
+}
+
+module.exports = {
+	phase: phase,
+	jdnFromCivil: jdnFromCivil,
+	glyphs: glyphs
+};
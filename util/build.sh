@@ -1,4 +1,4 @@
 #!/bin/sh
 make clean
 make
-./moontool > ../src/c/moonphase.h
+make check
@@ -0,0 +1,471 @@
+/*
+    Lunar Series Engine
+
+    Periodic-term evaluation of the Moon's position and of the times of
+    the principal phases, after Jean Meeus, "Astronomical Algorithms",
+    2nd ed., chapters 25, 47, 48 and 49.  The terms are kept in
+    coefficient tables and summed two at a time with GCC vector
+    extensions, which compile to SSE2 (or NEON) without any
+    intrinsics.
+
+*/
+
+#include "moonlib.h"
+
+typedef double v2d __attribute__ ((vector_size (16)));
+typedef long long v2l __attribute__ ((vector_size (16)));
+
+#define LANES	2
+#define J2000	2451545.0	   /* 2000 January 1.5 TD */
+#define AUKM	149597870.0	   /* Astronomical unit in km */
+
+/*  A series is a table of terms  coef * E^e * sin(a0*x0 + a1*x1 +
+    a2*x2 + a3*x3 + shift)  stored column-wise and padded with zero
+    terms to a multiple of LANES.  */
+
+struct series {
+	int n;
+	const double *a0, *a1, *a2, *a3;  /* Argument multipliers */
+	const double *e1, *e2;		  /* 1 if the term scales by E, E^2 */
+	const double *coef;
+	double shift;			  /* 0 for sines, 90 for cosines */
+};
+
+/*  VSIN  --  Sine of two angles in degrees.  The angle is reduced to
+	      [-180, 180], folded onto [0, 90] and evaluated with an odd
+	      Taylor polynomial that is accurate to about 1e-16 there.  */
+
+static v2d vsin(v2d x)
+{
+	const v2d round = {0x1.8p52, 0x1.8p52};
+	const v2l signbit = {1LL << 63, 1LL << 63};
+	v2d n, a, r, r2, p;
+	v2l sign;
+
+	n = (x * (1.0 / 360.0) + round) - round;
+	x = x - n * 360.0;			  /* [-180, 180] */
+	sign = (v2l) x & signbit;
+	a = (v2d) ((v2l) x & ~signbit);		  /* |x| */
+	a = 90.0 - a;
+	a = 90.0 - (v2d) ((v2l) a & ~signbit);	  /* [0, 90] */
+	r = a * (PI / 180.0);
+	r2 = r * r;
+	p = r2 * (1.0 / 121645100408832000.0) - 1.0 / 355687428096000.0;
+	p = p * r2 + 1.0 / 1307674368000.0;
+	p = p * r2 - 1.0 / 6227020800.0;
+	p = p * r2 + 1.0 / 39916800.0;
+	p = p * r2 - 1.0 / 362880.0;
+	p = p * r2 + 1.0 / 5040.0;
+	p = p * r2 - 1.0 / 120.0;
+	p = p * r2 + 1.0 / 6.0;
+	p = r - r * r2 * p;
+	return (v2d) ((v2l) p ^ sign);
+}
+
+/*  SUMSERIES  --  Evaluate a series for the arguments x[0..3] (in
+		   degrees, or the polynomial basis for the planetary
+		   terms) and eccentricity factor E.  */
+
+static double sumseries(const struct series *s, const double x[4], double e)
+{
+	v2d sum = {0, 0}, arg, fac, a0, a1, a2, a3, e1, e2, c;
+	int i;
+
+	for (i = 0; i < s->n; i += LANES) {
+	   __builtin_memcpy(&a0, s->a0 + i, sizeof a0);
+	   __builtin_memcpy(&a1, s->a1 + i, sizeof a1);
+	   __builtin_memcpy(&a2, s->a2 + i, sizeof a2);
+	   __builtin_memcpy(&a3, s->a3 + i, sizeof a3);
+	   __builtin_memcpy(&e1, s->e1 + i, sizeof e1);
+	   __builtin_memcpy(&e2, s->e2 + i, sizeof e2);
+	   __builtin_memcpy(&c, s->coef + i, sizeof c);
+	   arg = a0 * x[0] + a1 * x[1] + a2 * x[2] + a3 * x[3] + s->shift;
+	   fac = 1.0 + e1 * (e - 1.0) + e2 * (e * e - 1.0);
+	   sum += c * fac * vsin(arg);
+	}
+	return sum[0] + sum[1];
+}
+
+/*  Periodic terms for the Moon's longitude (units of 1e-6 degree) and
+    distance (units of 1e-3 km), Meeus table 47.A.  Arguments are
+    D, M, M', F.  */
+
+static const double lrD[] = {
+	0, 2, 2, 0, 0, 0, 2, 2, 2, 2, 0, 1, 0, 2, 0, 0, 4, 0, 4, 2,
+	2, 1, 1, 2, 2, 4, 2, 0, 2, 2, 1, 2, 0, 0, 2, 2, 2, 4, 0, 3,
+	2, 4, 0, 2, 2, 2, 4, 0, 4, 1, 2, 0, 1, 3, 4, 2, 0, 1, 2, 2
+};
+static const double lrM[] = {
+	0, 0, 0, 0, 1, 0, 0,-1, 0,-1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1,
+	1, 0, 1,-1, 0, 0, 0, 1, 0,-1, 0,-2, 1, 2,-2, 0, 0,-1, 0, 0,
+	1,-1, 2, 2, 1,-1, 0, 0,-1, 0, 1, 0, 1, 0, 0,-1, 2, 1, 0, 0
+};
+static const double lrMp[] = {
+	1,-1, 0, 2, 0, 0,-2,-1, 1, 0,-1, 0, 1, 0, 1, 1,-1, 3,-2,-1,
+	0,-1, 0, 1, 2, 0,-3,-2,-1,-2, 1, 0, 2, 0,-1, 1, 0,-1, 2,-1,
+	1,-2,-1,-1,-2, 0, 1, 4, 0,-2, 0, 2, 1,-2,-3, 2, 1,-1, 3,-1
+};
+static const double lrF[] = {
+	0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,-2, 2,-2, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,-2, 2, 0, 2, 0,
+	0, 0, 0, 0, 0,-2, 0, 0, 0, 0,-2,-2, 0, 0, 0, 0, 0, 0, 0,-2
+};
+static const double lcoef[] = {
+	6288774, 1274027, 658314, 213618, -185116, -114332, 58793, 57066,
+	53322, 45758, -40923, -34720, -30383, 15327, -12528, 10980, 10675,
+	10034, 8548, -7888, -6766, -5163, 4987, 4036, 3994, 3861, 3665,
+	-2689, -2602, 2390, -2348, 2236, -2120, -2069, 2048, -1773, -1595,
+	1215, -1110, -892, -810, 759, -713, -700, 691, 596, 549, 537, 520,
+	-487, -399, -381, 351, -340, 330, 327, -323, 299, 294, 0
+};
+static const double rcoef[] = {
+	-20905355, -3699111, -2955968, -569925, 48888, -3149, 246158,
+	-152138, -170733, -204586, -129620, 108743, 104755, 10321, 0, 79661,
+	-34782, -23210, -21636, 24208, 30824, -8379, -16675, -12831, -10445,
+	-11650, 14403, -7003, 0, 10056, 6322, -9884, 5751, 0, -4950, 4130,
+	0, -3958, 0, 3258, 2616, -1897, -2117, 2354, 0, 0, -1423, -1117,
+	-1571, -1739, 0, -4421, 0, 0, 0, 0, 1165, 0, 0, 8752
+};
+
+/*  Periodic terms for the Moon's latitude (units of 1e-6 degree),
+    Meeus table 47.B.  */
+
+static const double bD[] = {
+	0, 0, 0, 2, 2, 2, 2, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0, 4, 0,
+	0, 0, 1, 0, 0, 0, 1, 0, 4, 4, 0, 4, 2, 2, 2, 2, 0, 2, 2, 2,
+	2, 4, 2, 2, 0, 2, 1, 1, 0, 2, 1, 2, 0, 4, 4, 1, 4, 1, 4, 2
+};
+static const double bM[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0,-1, 0, 0, 1,-1,-1,-1, 1, 0, 1,
+	0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,-1, 0, 0, 0, 0, 1,
+	1, 0,-1,-2, 0, 1, 1, 1, 1, 1, 0,-1, 1, 0,-1, 0, 0, 0,-1,-2
+};
+static const double bMp[] = {
+	0, 1, 1, 0,-1,-1, 0, 2, 1, 2, 0,-2, 1, 0,-1, 0,-1,-1,-1, 0,
+	0,-1, 0, 1, 1, 0, 0, 3, 0,-1, 1,-2, 0, 2, 1,-2, 3, 2,-3,-1,
+	0, 0, 1, 0, 1, 1, 0, 0,-2,-1, 1,-2, 2,-2,-1, 1, 1,-1, 0, 0
+};
+static const double bF[] = {
+	1, 1,-1,-1, 1,-1, 1, 1,-1,-1,-1,-1, 1,-1, 1, 1,-1,-1,-1, 1,
+	3, 1, 1, 1,-1,-1,-1, 1,-1, 1,-3, 1,-3,-1,-1, 1,-1, 1,-1, 1,
+	1, 1, 1,-1, 3,-1,-1, 1,-1,-1, 1,-1, 1,-1,-1,-1,-1,-1,-1, 1
+};
+static const double bcoef[] = {
+	5128122, 280602, 277693, 173237, 55413, 46271, 32573, 17198, 9266,
+	8822, 8216, 4324, 4200, -3359, 2463, 2211, 2065, -1870, 1828, -1794,
+	-1749, -1565, -1491, -1475, -1410, -1344, -1335, 1107, 1021, 833,
+	777, 671, 607, 596, 491, -451, 439, 422, 421, -366, -351, 331, 315,
+	302, -283, -229, 223, 223, -220, -220, -185, 181, -177, 176, 166,
+	-164, 132, -119, 115, 107
+};
+
+/*  Corrections to the mean phase (days), Meeus chapter 49.  Arguments
+    are M, M', F, and the longitude of the ascending node.  */
+
+static const double nfM[] = {
+	0, 1, 0, 0,-1, 1, 2, 0, 0, 1, 0, 1, 1,-1, 0, 2, 0, 3, 1, 0,
+	1,-1,-1, 1, 0
+};
+static const double nfMp[] = {
+	1, 0, 2, 0, 1, 1, 0, 1, 1, 2, 3, 0, 0, 2, 0, 1, 2, 0, 1, 2,
+	1, 1, 1, 3, 4
+};
+static const double nfF[] = {
+	0, 0, 0, 2, 0, 0, 0,-2, 2, 0, 0, 2,-2, 0, 0, 0,-2, 0,-2, 2,
+	2, 2,-2, 0, 0
+};
+static const double nfO[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0
+};
+static const double nfE[] = {
+	0, 1, 0, 0, 1, 1, 2, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0
+};
+static const double newcoef[] = {
+	-0.40720, 0.17241, 0.01608, 0.01039, 0.00739, -0.00514, 0.00208,
+	-0.00111, -0.00057, 0.00056, -0.00042, 0.00042, 0.00038, -0.00024,
+	-0.00017, -0.00007, 0.00004, 0.00004, 0.00003, 0.00003, -0.00003,
+	0.00003, -0.00002, -0.00002, 0.00002
+};
+static const double fullcoef[] = {
+	-0.40614, 0.17302, 0.01614, 0.01043, 0.00734, -0.00515, 0.00209,
+	-0.00111, -0.00057, 0.00056, -0.00042, 0.00042, 0.00038, -0.00024,
+	-0.00017, -0.00007, 0.00004, 0.00004, 0.00003, 0.00003, -0.00003,
+	0.00003, -0.00002, -0.00002, 0.00002
+};
+
+static const double qM[] = {
+	0, 1, 1, 0, 0,-1, 2, 0, 0, 0,-1, 1, 1, 2, 1, 0,-1, 0, 1,-2,
+	1, 3, 0,-1, 1
+};
+static const double qMp[] = {
+	1, 0, 1, 2, 0, 1, 0, 1, 1, 3, 2, 0, 0, 1, 2, 0, 1, 2, 1, 1,
+	1, 0, 2, 1, 3
+};
+static const double qF[] = {
+	0, 0, 0, 0, 2, 0, 0,-2, 2, 0, 0, 2,-2, 0, 0, 0,-2, 2, 2, 0,
+	-2, 0,-2, 2, 0
+};
+static const double qO[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+	0, 0, 0, 0, 0
+};
+static const double qE[] = {
+	0, 1, 1, 0, 0, 1, 2, 0, 0, 0, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0
+};
+static const double quartercoef[] = {
+	-0.62801, 0.17172, -0.01183, 0.00862, 0.00804, 0.00454, 0.00204,
+	-0.00180, -0.00070, -0.00040, -0.00034, 0.00032, 0.00032, -0.00028,
+	0.00027, -0.00017, -0.00005, 0.00004, -0.00004, 0.00004, 0.00003,
+	0.00003, 0.00002, 0.00002, -0.00002
+};
+
+/*  Planetary arguments A1-A14 as  a0 + a1 k + a2 T^2  (degrees), and
+    their common correction coefficients (days).  */
+
+static const double plA0[] = {
+	299.77, 251.88, 251.83, 349.42, 84.66, 141.74, 207.14, 154.84,
+	34.52, 207.19, 291.34, 161.72, 239.56, 331.55
+};
+static const double plA1[] = {
+	0.107408, 0.016321, 26.651886, 36.412478, 18.206239, 53.303771,
+	2.453732, 7.306860, 27.261239, 0.121824, 1.844379, 24.198154,
+	25.513099, 3.592518
+};
+static const double plA2[] = {
+	-0.009173, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+static const double plcoef[] = {
+	0.000325, 0.000165, 0.000164, 0.000126, 0.000110, 0.000062,
+	0.000060, 0.000056, 0.000047, 0.000042, 0.000040, 0.000037,
+	0.000035, 0.000023
+};
+
+/*  The tables above are written compactly; MAKESERIES copies them into
+    padded, lane-aligned columns.  EPOW gives the power of E for each
+    term; the position tables derive it from the multiplier of the
+    Sun's mean anomaly instead.  */
+
+#define MAXTERMS 64
+
+struct columns {
+	double a0[MAXTERMS], a1[MAXTERMS], a2[MAXTERMS], a3[MAXTERMS];
+	double e1[MAXTERMS], e2[MAXTERMS], coef[MAXTERMS];
+};
+
+static struct columns lcol, rcol, bcol, newcol, fullcol, qcol, plcol;
+static struct series lser, rser, bser, newser, fullser, qser, plser;
+static int initialised = FALSE;
+
+static void makeseries(struct series *s, struct columns *c, int n,
+		       const double *a0, const double *a1, const double *a2,
+		       const double *a3, const double *epow,
+		       const double *coef, double shift)
+{
+	int i;
+
+	for (i = 0; i < n; i++) {
+	   c->a0[i] = a0 ? a0[i] : 0;
+	   c->a1[i] = a1 ? a1[i] : 0;
+	   c->a2[i] = a2 ? a2[i] : 0;
+	   c->a3[i] = a3 ? a3[i] : 0;
+	   c->e1[i] = epow && abs(epow[i]) == 1;
+	   c->e2[i] = epow && abs(epow[i]) == 2;
+	   c->coef[i] = coef[i];
+	}
+	s->n = (n + LANES - 1) / LANES * LANES;
+	s->a0 = c->a0;
+	s->a1 = c->a1;
+	s->a2 = c->a2;
+	s->a3 = c->a3;
+	s->e1 = c->e1;
+	s->e2 = c->e2;
+	s->coef = c->coef;
+	s->shift = shift;
+}
+
+#define COUNT(a) ((int) (sizeof(a) / sizeof((a)[0])))
+
+static void initseries(void)
+{
+	makeseries(&lser, &lcol, COUNT(lcoef), lrD, lrM, lrMp, lrF, lrM, lcoef, 0.0);
+	makeseries(&rser, &rcol, COUNT(rcoef), lrD, lrM, lrMp, lrF, lrM, rcoef, 90.0);
+	makeseries(&bser, &bcol, COUNT(bcoef), bD, bM, bMp, bF, bM, bcoef, 0.0);
+	makeseries(&newser, &newcol, COUNT(newcoef), nfM, nfMp, nfF, nfO, nfE, newcoef, 0.0);
+	makeseries(&fullser, &fullcol, COUNT(fullcoef), nfM, nfMp, nfF, nfO, nfE, fullcoef, 0.0);
+	makeseries(&qser, &qcol, COUNT(quartercoef), qM, qMp, qF, qO, qE, quartercoef, 0.0);
+	makeseries(&plser, &plcol, COUNT(plcoef), plA0, plA1, plA2, NULL, NULL, plcoef, 0.0);
+	initialised = TRUE;
+}
+
+/*  DELTAT  --  Difference TD - UT in days for a Julian date, from the
+		polynomial fits of Espenak and Meeus (1800-2150) and
+		the long-term parabola outside them.  */
+
+double deltat(double jd)
+{
+	double y, t, u, dt;
+
+	y = 2000.0 + (jd - J2000) / 365.25;
+	u = (y - 1820) / 100;
+	if (y < 1800 || y >= 2150) {
+	   dt = -20 + 32 * u * u;
+	} else if (y < 1860) {
+	   t = y - 1800;
+	   dt = 13.72 - 0.332447 * t + 0.0068612 * t * t + 0.0041116 * t * t * t
+		- 0.00037436 * pow(t, 4) + 0.0000121272 * pow(t, 5)
+		- 0.0000001699 * pow(t, 6) + 0.000000000875 * pow(t, 7);
+	} else if (y < 1900) {
+	   t = y - 1860;
+	   dt = 7.62 + 0.5737 * t - 0.251754 * t * t + 0.01680668 * t * t * t
+		- 0.0004473624 * pow(t, 4) + pow(t, 5) / 233174;
+	} else if (y < 1920) {
+	   t = y - 1900;
+	   dt = -2.79 + 1.494119 * t - 0.0598939 * t * t + 0.0061966 * t * t * t
+		- 0.000197 * pow(t, 4);
+	} else if (y < 1941) {
+	   t = y - 1920;
+	   dt = 21.20 + 0.84493 * t - 0.076100 * t * t + 0.0020936 * t * t * t;
+	} else if (y < 1961) {
+	   t = y - 1950;
+	   dt = 29.07 + 0.407 * t - t * t / 233 + t * t * t / 2547;
+	} else if (y < 1986) {
+	   t = y - 1975;
+	   dt = 45.45 + 1.067 * t - t * t / 260 - t * t * t / 718;
+	} else if (y < 2005) {
+	   t = y - 2000;
+	   dt = 63.86 + 0.3345 * t - 0.060374 * t * t + 0.0017275 * t * t * t
+		+ 0.000651814 * pow(t, 4) + 0.00002373599 * pow(t, 5);
+	} else if (y < 2050) {
+	   t = y - 2000;
+	   dt = 62.92 + 0.32217 * t + 0.005589 * t * t;
+	} else {
+	   dt = -20 + 32 * u * u - 0.5628 * (2150 - y);
+	}
+	return dt / 86400.0;
+}
+
+/*  MEEUSTRUEPHASE  --  TRUEPHASE from the chapter 49 series.  K counts
+			lunations from 1900 January as in TRUEPHASE,
+			and the result is in UT.  */
+
+double meeustruephase(k, phase)
+double k, phase;
+{
+	double t, t2, jde, e, x[4], w, m, mprime, f;
+
+	if (!initialised)
+	   initseries();
+	k += phase - 1237;	   /* Meeus counts from 2000 January 6 */
+	t = k / 1236.85;
+	t2 = t * t;
+	jde = 2451550.09766 + 29.530588861 * k + 0.00015437 * t2
+	      - 0.000000150 * t2 * t + 0.00000000073 * t2 * t2;
+	e = 1 - 0.002516 * t - 0.0000074 * t2;
+	m = x[0] = fixangle(2.5534 + 29.10535670 * k - 0.0000014 * t2
+			   - 0.00000011 * t2 * t);
+	mprime = x[1] = fixangle(201.5643 + 385.81693528 * k + 0.0107582 * t2
+				+ 0.00001238 * t2 * t - 0.000000058 * t2 * t2);
+	f = x[2] = fixangle(160.7108 + 390.67050284 * k - 0.0016118 * t2
+			   - 0.00000227 * t2 * t + 0.000000011 * t2 * t2);
+	x[3] = fixangle(124.7746 - 1.56375588 * k + 0.0020672 * t2
+			+ 0.00000215 * t2 * t);
+	if ((phase < 0.01) || (abs(phase - 0.5) < 0.01)) {
+	   jde += sumseries(phase < 0.01 ? &newser : &fullser, x, e);
+	} else if ((abs(phase - 0.25) < 0.01 || (abs(phase - 0.75) < 0.01))) {
+	   jde += sumseries(&qser, x, e);
+	   w = 0.00306 - 0.00038 * e * dcos(m) + 0.00026 * dcos(mprime)
+	       - 0.00002 * dcos(mprime - m) + 0.00002 * dcos(mprime + m)
+	       + 0.00002 * dcos(2 * f);
+	   jde += (phase < 0.5) ? w : -w;
+	} else {
+	   fprintf(stderr, "MEEUSTRUEPHASE called with invalid phase selector.\n");
+	   abort();
+	}
+	x[0] = 1;
+	x[1] = k;
+	x[2] = t2;
+	x[3] = 0;
+	jde += sumseries(&plser, x, 0);
+	return jde - deltat(jde);
+}
+
+/*  MEEUSPHASE  --  PHASE from the chapter 47 series for the Moon and
+		    the chapter 25 solar theory.  Same arguments and
+		    results as PHASE; the illuminated fraction allows
+		    for the Moon's latitude and the Sun's distance.  */
+
+double meeusphase(pdate, pphase, mage, dist, angdia, sudist, suangdia)
+double pdate;
+double *pphase, *mage, *dist, *angdia, *sudist, *suangdia;
+{
+	double t, t2, t3, t4, x[4], e, lp, a1, a2, a3, sl, sb, sr,
+	       lambda, beta, delta, l0, ms, c, ecc, nu, r, omega, lsun,
+	       elong, cpsi, psi, i;
+
+	if (!initialised)
+	   initseries();
+	t = (pdate + deltat(pdate) - J2000) / 36525;
+	t2 = t * t;
+	t3 = t2 * t;
+	t4 = t3 * t;
+
+	/* Moon's mean longitude and the fundamental arguments */
+
+	lp = fixangle(218.3164477 + 481267.88123421 * t - 0.0015786 * t2
+		      + t3 / 538841 - t4 / 65194000);
+	x[0] = fixangle(297.8501921 + 445267.1114034 * t - 0.0018819 * t2
+			+ t3 / 545868 - t4 / 113065000);
+	x[1] = fixangle(357.5291092 + 35999.0502909 * t - 0.0001536 * t2
+			+ t3 / 24490000);
+	x[2] = fixangle(134.9633964 + 477198.8675055 * t + 0.0087414 * t2
+			+ t3 / 69699 - t4 / 14712000);
+	x[3] = fixangle(93.2720950 + 483202.0175233 * t - 0.0036539 * t2
+			- t3 / 3526000 + t4 / 863310000);
+	a1 = 119.75 + 131.849 * t;
+	a2 = 53.09 + 479264.290 * t;
+	a3 = 313.45 + 481266.484 * t;
+	e = 1 - 0.002516 * t - 0.0000074 * t2;
+
+	sl = sumseries(&lser, x, e)
+	     + 3958 * dsin(a1) + 1962 * dsin(lp - x[3]) + 318 * dsin(a2);
+	sr = sumseries(&rser, x, e);
+	sb = sumseries(&bser, x, e)
+	     - 2235 * dsin(lp) + 382 * dsin(a3) + 175 * dsin(a1 - x[3])
+	     + 175 * dsin(a1 + x[3]) + 127 * dsin(lp - x[2])
+	     - 115 * dsin(lp + x[2]);
+
+	lambda = lp + sl / 1000000;
+	beta = sb / 1000000;
+	delta = 385000.56 + sr / 1000;
+
+	/* Sun's apparent longitude and distance */
+
+	l0 = 280.46646 + 36000.76983 * t + 0.0003032 * t2;
+	ms = 357.52911 + 35999.05029 * t - 0.0001537 * t2;
+	ecc = 0.016708634 - 0.000042037 * t - 0.0000001267 * t2;
+	c = (1.914602 - 0.004817 * t - 0.000014 * t2) * dsin(ms)
+	    + (0.019993 - 0.000101 * t) * dsin(2 * ms)
+	    + 0.000289 * dsin(3 * ms);
+	nu = ms + c;
+	r = 1.000001018 * (1 - ecc * ecc) / (1 + ecc * dcos(nu)) * AUKM;
+	omega = 125.04 - 1934.136 * t;
+	lsun = fixangle(l0 + c - 0.00569 - 0.00478 * dsin(omega));
+
+	/* Phase angle and illuminated fraction, chapter 48 */
+
+	elong = fixangle(lambda - lsun);
+	cpsi = dcos(beta) * dcos(elong);
+	psi = acos(cpsi);
+	i = atan2(r * sin(psi), delta - r * cpsi);
+
+	*pphase = (1 + cos(i)) / 2;
+	*mage = synmonth * (elong / 360.0);
+	*dist = delta;
+	*angdia = mangsiz * msmax / delta;
+	*sudist = r;
+	*suangdia = sunangsiz * sunsmax / r;
+	return elong / 360.0;
+}
@@ -0,0 +1,175 @@
+#include <string.h>
+#include "moonlib.h"
+#include "timing.h"
+
+/*  Find every perigee and apogee of the Moon over a range of years with
+    apsides(), and the full moons that are supermoons, against sampling
+    the distance from phase() every hour.  Reports:
+
+	- the events found and the time taken by each way, as events a
+	  second;
+	- the largest gap between an event and the hour sampling found,
+	  which must be within the hour, and any event only one way
+	  found;
+	- that the distance of moondist() at each event is phase()'s, and
+	  is no further from the Earth (perigee) or nearer (apogee) than
+	  phase() gives a minute either side;
+	- the supermoons: full moons with the Moon within 10% of the
+	  perigee end of the orbit it is on, from that perigee's distance
+	  to the apogee's nearest it.
+
+    In moontool's model the distance follows from the Moon's anomaly
+    alone, so every perigee is at a(1 - e) and every apogee at a(1 + e):
+    what the search finds is when, and so which full moons are near.
+
+    Usage: moonapsis [-y first last]
+
+    The exit status is non-zero if the two ways disagree or an event
+    is not an extreme.  */
+
+#define FIRST_YEAR 1500
+#define LAST_YEAR  2499
+#define SUPERMOON  0.1
+
+static char *kindname[2] = {"perigee", "apogee"};
+
+static double phasedist(double t)
+{
+  double cphase, aom, cdist, cangdia, csund, csuang;
+
+  phase(t, &cphase, &aom, &cdist, &cangdia, &csund, &csuang);
+  return cdist;
+}
+
+/*  Index of the event of kind nearest to t.  */
+
+static long nearest(double t, int kind, double *times, int *kinds, long n)
+{
+  long lo = 0, hi = n, i, best = -1;
+
+  while (lo < hi) {
+    i = (lo + hi) / 2;
+    if (times[i] < t)
+      lo = i + 1;
+    else
+      hi = i;
+  }
+  for (i = lo - 2; i <= lo + 1; i++)
+    if (i >= 0 && i < n && kinds[i] == kind &&
+        (best < 0 || fabs(times[i] - t) < fabs(times[best] - t)))
+      best = i;
+  return best;
+}
+
+int main(int argc, char *argv[])
+{
+  int firstyear = FIRST_YEAR, lastyear = LAST_YEAR, kind, *kinds, nkinds[2] = {0, 0};
+  long n, max, i, j, evals, hours, sampled = 0, unmatched = 0, badexact = 0, badextreme = 0, supermoons = 0, fulls = 0;
+  double first, last, *times, *dists, start, tengine, tnaive, anomaly, d, dprev, dnext, t, gap, maxgap = 0,
+         k, full, per, apo, closest = 1e30, farthest = 0;
+
+  if (argc == 4 && !strcmp(argv[1], "-y")) {
+    firstyear = atoi(argv[2]);
+    lastyear = atoi(argv[3]);
+  } else if (argc != 1) {
+    fprintf(stderr, "Usage: %s [-y first last]\n", argv[0]);
+    return 2;
+  }
+  first = jdn_from_civil(firstyear, 1, 1) - 0.5;
+  last = jdn_from_civil(lastyear + 1, 1, 1) - 0.5;
+  if (last <= first) {
+    fprintf(stderr, "%s: bad year range\n", argv[0]);
+    return 2;
+  }
+  max = (long) ((last - first) / 13) + 4;
+  times = malloc(max * sizeof(double));
+  dists = malloc(max * sizeof(double));
+  kinds = malloc(max * sizeof(int));
+
+  start = nanotime();
+  n = apsides(first, last, times, dists, kinds, max, &evals);
+  tengine = (nanotime() - start) / 1e9;
+  if (n > max) {
+    fprintf(stderr, "%s: %ld events, room for %ld\n", argv[0], n, max);
+    return 1;
+  }
+
+  /*  Each event against phase(): the same distance, and the extreme.  */
+
+  for (i = 0; i < n; i++) {
+    nkinds[kinds[i]]++;
+    if (kinds[i] == 0 && dists[i] < closest)
+      closest = dists[i];
+    if (kinds[i] == 1 && dists[i] > farthest)
+      farthest = dists[i];
+    d = phasedist(times[i]);
+    if (d != dists[i] && badexact++ < 10)
+      fprintf(stderr, "moonapsis: %s at %.5f: moondist() %.6f km, phase() %.6f\n",
+              kindname[kinds[i]], times[i], dists[i], d);
+    dprev = phasedist(times[i] - 1.0 / 1440);
+    dnext = phasedist(times[i] + 1.0 / 1440);
+    if ((kinds[i] == 0 ? (d > dprev || d > dnext) : (d < dprev || d < dnext)) && badextreme++ < 10)
+      fprintf(stderr, "moonapsis: %s at %.5f is not one: %.6f, %.6f, %.6f km\n",
+              kindname[kinds[i]], times[i], dprev, d, dnext);
+  }
+
+  /*  The hour sampling: an event wherever a sample is nearer or further
+      than both neighbours.  */
+
+  hours = (long) ((last - first) * 24);
+  start = nanotime();
+  dprev = phasedist(first - 1.0 / 24);
+  d = phasedist(first);
+  for (i = 0; i < hours; i++) {
+    dnext = phasedist(first + (i + 1) / 24.0);
+    kind = (d < dprev && d <= dnext) ? 0 : (d > dprev && d >= dnext) ? 1 : -1;
+    if (kind >= 0) {
+      t = first + i / 24.0;
+      sampled++;
+      j = nearest(t, kind, times, kinds, n);
+      gap = j < 0 ? 1e30 : fabs(times[j] - t) * 24;
+      if (gap > maxgap)
+        maxgap = gap;
+      if (gap > 1 && unmatched++ < 10)
+        fprintf(stderr, "moonapsis: %s at %.5f by the hour, none from apsides()\n", kindname[kind], t);
+    }
+    dprev = d;
+    d = dnext;
+  }
+  tnaive = (nanotime() - start) / 1e9;
+  if (sampled != n) {
+    fprintf(stderr, "moonapsis: %ld events by the hour, %ld from apsides()\n", sampled, n);
+    unmatched++;
+  }
+
+  /*  Supermoons, from the full moons of the lunations in the range.  */
+
+  for (k = floor((first - 2415020.75933) / synmonth) - 1; ; k++) {
+    full = truephase(k, 0.5);
+    if (full >= last)
+      break;
+    if (full < first)
+      continue;
+    fulls++;
+    i = nearest(full, 0, times, kinds, n);
+    if (i < 0)
+      continue;
+    j = nearest(times[i], 1, times, kinds, n);
+    if (j < 0)
+      continue;
+    per = dists[i];
+    apo = dists[j];
+    if (moondist(full, &anomaly) <= per + SUPERMOON * (apo - per))
+      supermoons++;
+  }
+
+  printf("Apsides over %d-%d: %ld perigees, %ld apogees\n", firstyear, lastyear, (long) nkinds[0], (long) nkinds[1]);
+  printf("  closest %.1f km, farthest %.1f km\n", closest, farthest);
+  printf("  supermoons: %ld of %ld full moons\n\n", supermoons, fulls);
+  printf("%-16s %10s %12s %10s %14s\n", "method", "events", "evaluations", "seconds", "events/s");
+  printf("%-16s %10ld %12ld %10.3f %14.0f\n", "apsides()", n, evals, tengine, n / tengine);
+  printf("%-16s %10ld %12ld %10.3f %14.0f\n", "hourly phase()", sampled, hours + 2, tnaive, sampled / tnaive);
+  printf("\nspeedup %.0fx, largest gap to the hour sampling %.2f h\n", tnaive / tengine, maxgap);
+
+  return (unmatched + badexact + badextreme) != 0;
+}
@@ -0,0 +1,249 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+/*  Rasterize the glyphs the watchface shows into a 1-bit sprite atlas.
+
+    Each tile font is rendered with FreeType at its resource size in
+    monochrome, as the SDK's font converter does, and only the
+    characters the tile can show are kept.  The glyphs are packed in
+    shelves into one bitmap, written as a raw resource in the SDK's
+    1-bit GBitmap layout (12 byte header, rows padded to 32 bits, least
+    significant bit leftmost, ink set), and their metrics are written
+    as tables for src/c/atlas.c.
+
+    Usage: moonatlas [-r resources] [-o header] [-v]
+
+	-r	resources directory (default ../resources)
+	-o	generated header (default ../src/c/atlas_glyphs.h)
+	-v	print every glyph as it is packed
+
+    Also prints the atlas against an estimate of the converted font
+    resources it stands in for.  */
+
+#define ATLAS_WIDTH 256
+#define MAX_GLYPHS  128
+#define ATLAS_FILE  "data/glyph_atlas.bin"
+
+static struct font {
+  const char *name, *file, *chars;
+  int size;
+} fonts[] = {
+  {"TIME", "fonts/wwDigital.ttf", "0123456789:", 52},
+  {"DAY", "fonts/wwDigital.ttf", "FMSTWadehinortu", 33},
+  {"MOON", "fonts/moon_phases.ttf", "01ABCDEFGHIJKLMNOPQRSTUVWXYZ", 33},
+  {"DATE", "fonts/wwDigital.ttf", "0123456789ADFJMNOSabceglnoprtuvy", 22},
+  {"AMPM", "fonts/wwDigital.ttf", "APM", 10},
+};
+#define FONTS (sizeof(fonts) / sizeof(fonts[0]))
+
+static struct glyph {
+  int font, code, x, y, w, h, left, top, advance;
+  unsigned char *bits;           /* w * h bytes, 1 = ink */
+} glyphs[MAX_GLYPHS];
+static int nglyphs, verbose;
+
+/*  RENDER  --  Render every character of one font into glyphs[].  */
+
+static int render(FT_Library lib, const char *dir, int f)
+{
+  char path[512];
+  FT_Face face;
+  FT_Bitmap *b;
+  struct glyph *g;
+  const char *c;
+  int ascent, x, y;
+
+  snprintf(path, sizeof(path), "%s/%s", dir, fonts[f].file);
+  if (FT_New_Face(lib, path, 0, &face)) {
+    fprintf(stderr, "moonatlas: cannot open %s\n", path);
+    return 0;
+  }
+  FT_Set_Pixel_Sizes(face, 0, fonts[f].size);
+  ascent = (face->size->metrics.ascender + 32) >> 6;
+  for (c = fonts[f].chars; *c; c++) {
+    if (nglyphs == MAX_GLYPHS || FT_Load_Char(face, *c, FT_LOAD_RENDER | FT_LOAD_MONOCHROME | FT_LOAD_TARGET_MONO)) {
+      fprintf(stderr, "moonatlas: cannot render '%c' from %s\n", *c, path);
+      FT_Done_Face(face);
+      return 0;
+    }
+    b = &face->glyph->bitmap;
+    g = &glyphs[nglyphs++];
+    g->font = f;
+    g->code = *c;
+    g->w = b->width;
+    g->h = b->rows;
+    g->left = face->glyph->bitmap_left;
+    g->top = ascent - face->glyph->bitmap_top;
+    g->advance = (face->glyph->advance.x + 32) >> 6;
+    g->bits = calloc(g->w * g->h + 1, 1);
+    for (y = 0; y < g->h; y++)
+      for (x = 0; x < g->w; x++)
+        g->bits[y * g->w + x] = b->buffer[y * b->pitch + x / 8] >> (7 - (x & 7)) & 1;
+  }
+  FT_Done_Face(face);
+  return 1;
+}
+
+/*  PACK  --  Place glyphs left to right in shelves as tall as the
+                tallest glyph on them; returns the atlas height.  */
+
+static int pack(void)
+{
+  int i, x = 0, y = 0, shelf = 0;
+
+  for (i = 0; i < nglyphs; i++) {
+    if (x + glyphs[i].w > ATLAS_WIDTH || (i > 0 && glyphs[i].font != glyphs[i - 1].font)) {
+      x = 0;
+      y += shelf;
+      shelf = 0;
+    }
+    glyphs[i].x = x;
+    glyphs[i].y = y;
+    x += glyphs[i].w;
+    if (glyphs[i].h > shelf)
+      shelf = glyphs[i].h;
+    if (verbose)
+      printf("%-4s '%c' %3dx%-3d at %3d,%-3d left %3d top %3d advance %3d\n", fonts[glyphs[i].font].name,
+             glyphs[i].code, glyphs[i].w, glyphs[i].h, glyphs[i].x, glyphs[i].y, glyphs[i].left,
+             glyphs[i].top, glyphs[i].advance);
+  }
+  return y + shelf;
+}
+
+static void put16(unsigned char *p, int v)
+{
+  p[0] = v & 0xFF;
+  p[1] = v >> 8 & 0xFF;
+}
+
+/*  WRITEATLAS  --  Write the packed bitmap; returns its size in bytes.  */
+
+static long writeatlas(const char *dir, int height)
+{
+  char path[512];
+  int rowbytes = (ATLAS_WIDTH + 31) / 32 * 4, i, x, y;
+  long size = 12 + (long) rowbytes * height;
+  unsigned char *data = calloc(size, 1);
+  struct glyph *g;
+  FILE *f;
+
+  put16(data, rowbytes);
+  put16(data + 2, 1 << 12);      /* Version 1, GBitmapFormat1Bit */
+  put16(data + 4, 0);
+  put16(data + 6, 0);
+  put16(data + 8, ATLAS_WIDTH);
+  put16(data + 10, height);
+  for (i = 0; i < nglyphs; i++) {
+    g = &glyphs[i];
+    for (y = 0; y < g->h; y++)
+      for (x = 0; x < g->w; x++)
+        if (g->bits[y * g->w + x])
+          data[12 + (g->y + y) * rowbytes + (g->x + x) / 8] |= 1 << ((g->x + x) & 7);
+  }
+  snprintf(path, sizeof(path), "%s/%s", dir, ATLAS_FILE);
+  if (!(f = fopen(path, "wb")) || fwrite(data, 1, size, f) != size || fclose(f)) {
+    fprintf(stderr, "moonatlas: cannot write %s\n", path);
+    return -1;
+  }
+  free(data);
+  return size;
+}
+
+/*  WRITEHEADER  --  Write the glyph and font tables for atlas.c.  */
+
+static int writeheader(const char *path, int height)
+{
+  FILE *f;
+  int i, n, first;
+
+  if (!(f = fopen(path, "w"))) {
+    fprintf(stderr, "moonatlas: cannot write %s\n", path);
+    return 0;
+  }
+  fprintf(f, "/* Application:   \tPebble Moontiles Watchface\n\n");
+  fprintf(f, "   Filename: \t  \tatlas_glyphs.h\n\n");
+  fprintf(f, "   Purpose:\t  \t\tGlyph positions and metrics in resources/%s.\n", ATLAS_FILE);
+  fprintf(f, "   \t\t\t\t\tGenerated by util/moonatlas from the tile fonts; do not edit.\n*/\n\n");
+  fprintf(f, "#define ATLAS_WIDTH %d\n#define ATLAS_HEIGHT %d\n\n", ATLAS_WIDTH, height);
+  fprintf(f, "/* x, y, width, height, left, top, advance */\n");
+  fprintf(f, "static const AtlasGlyph AtlasGlyphs[%d] =\n{\n", nglyphs);
+  for (i = 0; i < nglyphs; i++)
+    fprintf(f, "\t{%3d, %3d, %2d, %2d, %3d, %3d, %2d},  /* %-4s '%c' */\n", glyphs[i].x, glyphs[i].y,
+            glyphs[i].w, glyphs[i].h, glyphs[i].left, glyphs[i].top, glyphs[i].advance,
+            fonts[glyphs[i].font].name, glyphs[i].code);
+  fprintf(f, "};\n\n");
+  fprintf(f, "static const AtlasFont AtlasFonts[ATLAS_FONT_COUNT] =\n{\n");
+  for (i = 0, first = 0; i < FONTS; i++, first += n) {
+    n = strlen(fonts[i].chars);
+    fprintf(f, "\t{\"%s\", %3d, %2d},  /* ATLAS_FONT_%s, %d px */\n", fonts[i].chars, first, n,
+            fonts[i].name, fonts[i].size);
+  }
+  fprintf(f, "};\n");
+  return fclose(f) == 0;
+}
+
+/*  FONTESTIMATE  --  Approximate size of the converted font resource
+                      for one tile font: a 10 byte header, a 255 entry
+                      hash table of 4 byte entries, a 6 byte offset
+                      entry and an 8 byte glyph header per glyph, and
+                      the glyph bits packed into 32-bit words.  */
+
+static long fontestimate(int f)
+{
+  long size = 10 + 255 * 4;
+  int i;
+
+  for (i = 0; i < nglyphs; i++)
+    if (glyphs[i].font == f)
+      size += 6 + 8 + (glyphs[i].w * glyphs[i].h + 31) / 32 * 4;
+  return size;
+}
+
+int main(int argc, char *argv[])
+{
+  const char *dir = "../resources", *header = "../src/c/atlas_glyphs.h";
+  FT_Library lib;
+  long atlas, total = 0, est;
+  int i, height;
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-r") && i + 1 < argc)
+      dir = argv[++i];
+    else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+      header = argv[++i];
+    else if (!strcmp(argv[i], "-v"))
+      verbose = 1;
+    else {
+      fprintf(stderr, "Usage: %s [-r resources] [-o header] [-v]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (FT_Init_FreeType(&lib))
+    return 1;
+  for (i = 0; i < FONTS; i++)
+    if (!render(lib, dir, i))
+      return 1;
+  FT_Done_FreeType(lib);
+
+  height = pack();
+  if (height > 256) {
+    fprintf(stderr, "moonatlas: atlas is %d rows, more than the glyph table can address\n", height);
+    return 1;
+  }
+  if ((atlas = writeatlas(dir, height)) < 0 || !writeheader(header, height))
+    return 1;
+
+  printf("%d glyphs in a %dx%d atlas: %ld bytes resource, %d bytes of metrics\n\n",
+         nglyphs, ATLAS_WIDTH, height, atlas, nglyphs * 7);
+  printf("font  size glyphs  font resource (est.)\n");
+  for (i = 0; i < FONTS; i++) {
+    est = fontestimate(i);
+    total += est;
+    printf("%-4s %5d %6d %12ld\n", fonts[i].name, fonts[i].size, (int) strlen(fonts[i].chars), est);
+  }
+  printf("total             %12ld\n", total);
+  return 0;
+}
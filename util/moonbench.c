@@ -0,0 +1,210 @@
+#include <string.h>
+#include "moonlib.h"
+#include "timing.h"
+
+/*  Microbenchmarks for the moonlib ephemeris functions.
+
+    Every function is timed over three fixed-seed date distributions:
+    consecutive days from 2000, random dates across 1000-3000, and
+    dates within an hour of a principal phase.  Each combination is run
+    RUNS times and reported as mean ns/call, calls per second and the
+    standard deviation between runs.
+
+    Usage: moonbench [-f text|csv] [-n samples] [-r runs]
+
+    CSV output has one row per function and distribution and is meant
+    to be kept alongside a revision for regression tracking.  */
+
+#define SAMPLES   20000
+#define RUNS      10
+#define SEED      0x9E3779B97F4A7C15ULL
+
+enum { SEQUENTIAL, RANDOM, BOUNDARY, DISTRIBUTIONS };
+
+static char *distname[DISTRIBUTIONS] = {"sequential", "random", "boundary"};
+
+static double *dates[DISTRIBUTIONS];	   /* Julian dates */
+static double *ks[DISTRIBUTIONS];	   /* Lunation numbers for truephase */
+static struct tm *tms[DISTRIBUTIONS];	   /* Civil times for jtime */
+static int samples = SAMPLES;
+static volatile double sink;
+
+/*  Fixed-seed xorshift generator, uniform on [0, 1).  */
+
+static unsigned long long state = SEED;
+
+static double uniform(void)
+{
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return (state >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static void makeinputs(void)
+{
+  int d, i, yy, mm, dd, h, m, s;
+  double k, jd;
+
+  for (d = 0; d < DISTRIBUTIONS; d++) {
+    dates[d] = malloc(samples * sizeof(double));
+    ks[d] = malloc(samples * sizeof(double));
+    tms[d] = calloc(samples, sizeof(struct tm));
+    for (i = 0; i < samples; i++) {
+      switch (d) {
+      case SEQUENTIAL:
+        jd = 2451544.5 + i;
+        break;
+      case RANDOM:
+        jd = 2086302.5 + uniform() * 730485.0;   /* 1000 to 3000 */
+        break;
+      default:
+        k = floor(uniform() * 24737) - 11000;
+        jd = truephase(k, floor(uniform() * 4) * 0.25) + (uniform() - 0.5) / 12;
+        break;
+      }
+      dates[d][i] = jd;
+      ks[d][i] = floor((jd - 2415020.75933) / synmonth);
+      jyear(jd, &yy, &mm, &dd);
+      jhms(jd, &h, &m, &s);
+      tms[d][i].tm_year = yy - 1900;
+      tms[d][i].tm_mon = mm - 1;
+      tms[d][i].tm_mday = dd;
+      tms[d][i].tm_hour = h;
+      tms[d][i].tm_min = m;
+      tms[d][i].tm_sec = s;
+    }
+  }
+}
+
+/*  One run of a function over every sample of a distribution.  */
+
+static void runphase(int d)
+{
+  int i;
+  double pphase, mage, dist, angdia, sudist, suangdia;
+
+  for (i = 0; i < samples; i++)
+    sink = phase(dates[d][i], &pphase, &mage, &dist, &angdia, &sudist, &suangdia);
+}
+
+static void runtruephase(int d)
+{
+  int i;
+
+  for (i = 0; i < samples; i++)
+    sink = truephase(ks[d][i], (i & 3) * 0.25);
+}
+
+static void runmeanphase(int d)
+{
+  int i;
+  double k;
+
+  for (i = 0; i < samples; i++)
+    sink = meanphase(dates[d][i], 0.0, &k);
+}
+
+static void runphasehunt(int d)
+{
+  int i;
+  double phases[5];
+
+  for (i = 0; i < samples; i++) {
+    phasehunt(dates[d][i], phases);
+    sink = phases[0];
+  }
+}
+
+static void runkepler(int d)
+{
+  int i;
+
+  for (i = 0; i < samples; i++)
+    sink = kepler(fixangle(dates[d][i] * (360 / 365.2422)), eccent);
+}
+
+static void runjyear(int d)
+{
+  int i, yy, mm, dd;
+
+  for (i = 0; i < samples; i++) {
+    jyear(dates[d][i], &yy, &mm, &dd);
+    sink = dd;
+  }
+}
+
+static void runjtime(int d)
+{
+  int i;
+
+  for (i = 0; i < samples; i++)
+    sink = jtime(&tms[d][i]);
+}
+
+static struct {
+  char *name;
+  void (*run)(int);
+} benches[] = {
+  {"phase", runphase},
+  {"truephase", runtruephase},
+  {"meanphase", runmeanphase},
+  {"phasehunt", runphasehunt},
+  {"kepler", runkepler},
+  {"jyear", runjyear},
+  {"jtime", runjtime},
+};
+
+/*  Main program  */
+
+int main(int argc, char *argv[])
+{
+  int i, d, r, runs = RUNS, csv = FALSE;
+  double start, ns[RUNS * 10], mean, var;
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-f") && i + 1 < argc)
+      csv = !strcmp(argv[++i], "csv");
+    else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+      samples = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-r") && i + 1 < argc)
+      runs = atoi(argv[++i]);
+    else {
+      fprintf(stderr, "Usage: %s [-f text|csv] [-n samples] [-r runs]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (samples < 1 || runs < 2 || runs > RUNS * 10) {
+    fprintf(stderr, "%s: need at least one sample and 2-%d runs\n", argv[0], RUNS * 10);
+    return 2;
+  }
+  makeinputs();
+
+  if (csv)
+    printf("function,distribution,samples,runs,ns_per_call,calls_per_sec,stddev_ns\n");
+  else
+    printf("%-10s %-11s %10s %14s %10s\n", "function", "dates", "ns/call", "calls/s", "stddev ns");
+  for (i = 0; i < sizeof(benches) / sizeof(benches[0]); i++)
+    for (d = 0; d < DISTRIBUTIONS; d++) {
+      benches[i].run(d);	   /* Warm up caches and branch predictors */
+      mean = 0;
+      for (r = 0; r < runs; r++) {
+        start = nanotime();
+        benches[i].run(d);
+        ns[r] = (nanotime() - start) / samples;
+        mean += ns[r];
+      }
+      mean /= runs;
+      var = 0;
+      for (r = 0; r < runs; r++)
+        var += (ns[r] - mean) * (ns[r] - mean);
+      var /= runs - 1;
+      if (csv)
+        printf("%s,%s,%d,%d,%.3f,%.0f,%.3f\n", benches[i].name, distname[d], samples, runs,
+               mean, 1e9 / mean, sqrt(var));
+      else
+        printf("%-10s %-11s %10.1f %14.0f %10.2f\n", benches[i].name, distname[d], mean,
+               1e9 / mean, sqrt(var));
+    }
+  return 0;
+}
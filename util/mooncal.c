@@ -0,0 +1,174 @@
+#include "moonlib.h"
+#include "timing.h"
+
+/*  Check the integer calendar kernel in calendar.h by round trip over
+    +/- 10,000 years, against the floating-point jyear() it replaced and
+    against the sequential cursor, then time the conversions.  */
+
+#define FIRST_YEAR -10000
+#define LAST_YEAR   10000
+#define BENCH_DAYS  2000000L
+#define PASSES      5
+
+static int mdays[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+/*  JYEARFLOAT  --  The original floating-point jyear(), kept as the
+		    reference.  */
+
+static void jyearfloat(double td, int *yy, int *mm, int *dd)
+{
+  double j, d, y, m;
+
+  td += 0.5;
+  j = floor(td);
+  j = j - 1721119.0;
+  y = floor(((4 * j) - 1) / 146097.0);
+  j = (j * 4.0) - (1.0 + (146097.0 * y));
+  d = floor(j / 4.0);
+  j = floor(((4.0 * d) + 3.0) / 1461.0);
+  d = ((4.0 * d) + 3.0) - (1461.0 * j);
+  d = floor((d + 4.0) / 4.0);
+  m = floor(((5.0 * d) - 3) / 153.0);
+  d = (5.0 * d) - (3.0 + (153.0 * m));
+  d = floor((d + 5.0) / 5.0);
+  y = (100.0 * y) + j;
+  if (m < 10.0)
+    m = m + 3;
+  else {
+    m = m - 9;
+    y = y + 1;
+  }
+  *yy = y;
+  *mm = m;
+  *dd = d;
+}
+
+static int leap(long y)
+{
+  return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+}
+
+/*  Walk every civil date in the range in order, checking that each maps
+    to the next Julian day number and back, in 32 and 64 bits, and that
+    jyearfloat() agrees wherever it is defined.  */
+
+static long roundtrip(long *checked)
+{
+  long y, errors = 0, n = 0, j64y;
+  int32_t jdn, expect, m, d, last, m64, d64;
+  int yy, mm, dd;
+  CivilDate c;
+
+  expect = jdn_from_civil(FIRST_YEAR, 1, 1);
+  for (y = FIRST_YEAR; y <= LAST_YEAR; y++)
+    for (m = 1; m <= 12; m++) {
+      last = mdays[m - 1] + (m == 2 && leap(y));
+      for (d = 1; d <= last; d++, expect++, n++) {
+        jdn = jdn_from_civil(y, m, d);
+        c = civil_from_jdn(jdn);
+        civil_from_jdn64(jdn_from_civil64(y, m, d), &j64y, &m64, &d64);
+        if (jdn != expect || c.year != y || c.month != m || c.day != d
+            || jdn_from_civil64(y, m, d) != jdn || j64y != y || m64 != m || d64 != d) {
+          if (errors++ < 10)
+            fprintf(stderr, "round trip failed: %ld-%02d-%02d -> %d\n", y, m, d, jdn);
+        }
+        if (y > 0) {
+          jyearfloat(jdn, &yy, &mm, &dd);
+          if (yy != y || mm != m || dd != d) {
+            if (errors++ < 10)
+              fprintf(stderr, "jyear mismatch: %ld-%02d-%02d vs %d-%02d-%02d\n", y, m, d, yy, mm, dd);
+          }
+        }
+      }
+    }
+  *checked = n;
+  return errors;
+}
+
+/*  Step a cursor over the whole range and compare every day with
+    jyear().  */
+
+static long cursorwalk(void)
+{
+  CalendarCursor day;
+  int32_t last;
+  long errors = 0;
+  int yy, mm, dd;
+
+  last = jdn_from_civil(LAST_YEAR, 12, 31);
+  for (calendar_cursor_init(&day, jdn_from_civil(FIRST_YEAR, 1, 1)); day.jdn <= last;
+       calendar_cursor_next(&day)) {
+    jyear(day.jdn, &yy, &mm, &dd);
+    if (day.date.year != yy || day.date.month != mm || day.date.day != dd) {
+      if (errors++ < 10)
+        fprintf(stderr, "cursor mismatch at %d: %d-%02d-%02d vs %d-%02d-%02d\n", day.jdn,
+                day.date.year, day.date.month, day.date.day, yy, mm, dd);
+    }
+  }
+  return errors;
+}
+
+/*  Main program  */
+
+int main(int argc, char *argv[])
+{
+  long checked, errors, i;
+  int pass, yy, mm, dd;
+  double start, elapsed, best[4];
+  CalendarCursor day;
+  int32_t *jdns;
+  CivilDate *out;
+  volatile int sink = 0;
+
+  errors = roundtrip(&checked);
+  printf("Round trip over %d..%d: %ld dates, %ld errors\n", FIRST_YEAR, LAST_YEAR, checked, errors);
+  i = cursorwalk();
+  printf("Cursor against jyear() over the same range: %ld errors\n", i);
+  errors += i;
+
+  jdns = malloc(BENCH_DAYS * sizeof(*jdns));
+  out = malloc(BENCH_DAYS * sizeof(*out));
+  for (i = 0; i < BENCH_DAYS; i++)
+    jdns[i] = 2415021 + i;
+  for (pass = 0; pass < PASSES; pass++) {
+    start = nanotime();
+    for (i = 0; i < BENCH_DAYS; i++) {
+      jyearfloat(jdns[i], &yy, &mm, &dd);
+      sink += dd;
+    }
+    elapsed = nanotime() - start;
+    if (pass == 0 || elapsed < best[0])
+      best[0] = elapsed;
+
+    start = nanotime();
+    for (i = 0; i < BENCH_DAYS; i++) {
+      jyear(jdns[i], &yy, &mm, &dd);
+      sink += dd;
+    }
+    elapsed = nanotime() - start;
+    if (pass == 0 || elapsed < best[1])
+      best[1] = elapsed;
+
+    start = nanotime();
+    civil_from_jdn_batch(jdns, out, BENCH_DAYS);
+    elapsed = nanotime() - start;
+    sink += out[BENCH_DAYS - 1].day;
+    if (pass == 0 || elapsed < best[2])
+      best[2] = elapsed;
+
+    start = nanotime();
+    for (calendar_cursor_init(&day, jdns[0]), i = 0; i < BENCH_DAYS; i++, calendar_cursor_next(&day))
+      sink += day.date.day;
+    elapsed = nanotime() - start;
+    if (pass == 0 || elapsed < best[3])
+      best[3] = elapsed;
+  }
+  printf("\n%-28s %8s\n", "conversion", "ns/day");
+  printf("%-28s %8.2f\n", "floating-point jyear", best[0] / BENCH_DAYS);
+  printf("%-28s %8.2f\n", "integer jyear", best[1] / BENCH_DAYS);
+  printf("%-28s %8.2f\n", "civil_from_jdn_batch", best[2] / BENCH_DAYS);
+  printf("%-28s %8.2f\n", "calendar_cursor_next", best[3] / BENCH_DAYS);
+  free(jdns);
+  free(out);
+  return errors != 0;
+}
@@ -0,0 +1,268 @@
+#include <string.h>
+#include "moonlib.h"
+
+/*  Reference-accuracy oracle for the fast moon paths.
+
+    The reference is Walker's model evaluated in long double.  Each
+    candidate phase()/truephase() pair is swept over every day of the
+    range and judged by the watch table semantics: the glyph index
+    myround(cphase * 14) plus the waxing flag.  The sweep reports glyph
+    mismatches with their dates, and the largest error in illuminated
+    fraction and in principal-phase time.  The exit status is non-zero
+    if any gated candidate shows a glyph mismatch, so 'make check' can
+    gate changes to moonlib.c.
+
+    Usage: mooncheck [-y first last] [-c candidate] [-l] [-v]
+
+    Mismatch dates are listed for gated candidates, and for all of them
+    with -v.  */
+
+#define FIRST_YEAR 1900
+#define LAST_YEAR  2100
+#define SHOWN      20		   /* Mismatch dates listed per candidate */
+
+typedef long double ldouble;
+
+#define LPI 3.141592653589793238462643383279502884L
+#define lfixangle(a) ((a) - 360.0L * (floorl((a) / 360.0L)))
+#define ltorad(d) ((d) * (LPI / 180.0L))
+#define ltodeg(d) ((d) * (180.0L / LPI))
+#define ldsin(x) (sinl(ltorad((x))))
+
+static ldouble refkepler(ldouble m, ldouble ecc)
+{
+  ldouble e, delta;
+
+  e = m = ltorad(m);
+  do {
+    delta = e - ecc * sinl(e) - m;
+    e -= delta / (1 - ecc * cosl(e));
+  } while (fabsl(delta) > 1e-15L);
+  return e;
+}
+
+/*  REFPHASE  --  PHASE in long double; returns the illuminated
+		  fraction.  */
+
+static ldouble refphase(ldouble pdate)
+{
+  ldouble Day, N, M, Ec, Lambdasun, ml, MM, Ev, Ae, A3, MmP, mEc, A4, lP, V, lPP;
+
+  Day = pdate - epoch;
+  N = lfixangle((360 / 365.2422L) * Day);
+  M = lfixangle(N + elonge - elongp);
+  Ec = refkepler(M, eccent);
+  Ec = sqrtl((1 + eccent) / (1 - eccent)) * tanl(Ec / 2);
+  Ec = 2 * ltodeg(atanl(Ec));
+  Lambdasun = lfixangle(Ec + elongp);
+  ml = lfixangle(13.1763966L * Day + mmlong);
+  MM = lfixangle(ml - 0.1114041L * Day - mmlongp);
+  Ev = 1.2739L * sinl(ltorad(2 * (ml - Lambdasun) - MM));
+  Ae = 0.1858L * sinl(ltorad(M));
+  A3 = 0.37L * sinl(ltorad(M));
+  MmP = MM + Ev - Ae - A3;
+  mEc = 6.2886L * sinl(ltorad(MmP));
+  A4 = 0.214L * sinl(ltorad(2 * MmP));
+  lP = ml + Ev + mEc - Ae + A4;
+  V = 0.6583L * sinl(ltorad(2 * (lP - Lambdasun)));
+  lPP = lP + V;
+  return (1 - cosl(ltorad(lPP - Lambdasun))) / 2;
+}
+
+/*  REFTRUEPHASE  --  TRUEPHASE in long double.  */
+
+static ldouble reftruephase(ldouble k, ldouble phase)
+{
+  ldouble t, t2, t3, pt, m, mprime, f;
+
+  k += phase;
+  t = k / 1236.85L;
+  t2 = t * t;
+  t3 = t2 * t;
+  pt = 2415020.75933L + 29.53058868L * k + 0.0001178L * t2 - 0.000000155L * t3
+       + 0.00033L * ldsin(166.56L + 132.87L * t - 0.009173L * t2);
+  m = 359.2242L + 29.10535608L * k - 0.0000333L * t2 - 0.00000347L * t3;
+  mprime = 306.0253L + 385.81691806L * k + 0.0107306L * t2 + 0.00001236L * t3;
+  f = 21.2964L + 390.67050646L * k - 0.0016528L * t2 - 0.00000239L * t3;
+  if (phase < 0.01L || fabsl(phase - 0.5L) < 0.01L) {
+    pt += (0.1734L - 0.000393L * t) * ldsin(m) + 0.0021L * ldsin(2 * m)
+          - 0.4068L * ldsin(mprime) + 0.0161L * ldsin(2 * mprime)
+          - 0.0004L * ldsin(3 * mprime) + 0.0104L * ldsin(2 * f)
+          - 0.0051L * ldsin(m + mprime) - 0.0074L * ldsin(m - mprime)
+          + 0.0004L * ldsin(2 * f + m) - 0.0004L * ldsin(2 * f - m)
+          - 0.0006L * ldsin(2 * f + mprime) + 0.0010L * ldsin(2 * f - mprime)
+          + 0.0005L * ldsin(m + 2 * mprime);
+  } else {
+    pt += (0.1721L - 0.0004L * t) * ldsin(m) + 0.0021L * ldsin(2 * m)
+          - 0.6280L * ldsin(mprime) + 0.0089L * ldsin(2 * mprime)
+          - 0.0004L * ldsin(3 * mprime) + 0.0079L * ldsin(2 * f)
+          - 0.0119L * ldsin(m + mprime) - 0.0047L * ldsin(m - mprime)
+          + 0.0003L * ldsin(2 * f + m) - 0.0004L * ldsin(2 * f - m)
+          - 0.0006L * ldsin(2 * f + mprime) + 0.0021L * ldsin(2 * f - mprime)
+          + 0.0003L * ldsin(m + 2 * mprime) + 0.0004L * ldsin(m - 2 * mprime)
+          - 0.0003L * ldsin(2 * m + mprime);
+    if (phase < 0.5L)
+      pt += 0.0028L - 0.0004L * cosl(ltorad(m)) + 0.0003L * cosl(ltorad(mprime));
+    else
+      pt += -0.0028L + 0.0004L * cosl(ltorad(m)) - 0.0003L * cosl(ltorad(mprime));
+  }
+  return pt;
+}
+
+/*  Candidates.  Each supplies the illuminated fraction for a Julian
+    date and the time of a principal phase; gated candidates must match
+    the reference glyph for glyph.  */
+
+static double candphase(double jd)
+{
+  double pphase, mage, dist, angdia, sudist, suangdia;
+
+  phase(jd, &pphase, &mage, &dist, &angdia, &sudist, &suangdia);
+  return pphase;
+}
+
+static double candreduced(double jd)
+{
+  double pphase, mage, dist, angdia, sudist, suangdia;
+
+  phasetier(TIER_REDUCED, jd, &pphase, &mage, &dist, &angdia, &sudist, &suangdia);
+  return pphase;
+}
+
+static double candcoarse(double jd)
+{
+  double pphase, mage, dist, angdia, sudist, suangdia;
+
+  phasetier(TIER_COARSE, jd, &pphase, &mage, &dist, &angdia, &sudist, &suangdia);
+  return pphase;
+}
+
+static double candtruereduced(double k, double phase)
+{
+  return truephasetier(TIER_REDUCED, k, phase);
+}
+
+static double candtruecoarse(double k, double phase)
+{
+  return truephasetier(TIER_COARSE, k, phase);
+}
+
+static struct {
+  char *name;
+  double (*illum)(double jd);
+  double (*event)(double k, double phase);
+  int gated;
+} candidates[] = {
+  {"phase", candphase, truephase, TRUE},
+  {"tier-reduced", candreduced, candtruereduced, FALSE},
+  {"tier-coarse", candcoarse, candtruecoarse, FALSE},
+};
+
+#define CANDIDATES ((int) (sizeof(candidates) / sizeof(candidates[0])))
+
+static double *refillum;	   /* Reference fraction per day, from first - 1 */
+static ldouble *refevent;	   /* Reference phase times per lunation */
+
+static int glyph(double cphase, double lastcphase)
+{
+  return myround(cphase * 14) * 2 + (lastcphase < cphase);
+}
+
+/*  Sweep one candidate; returns the number of glyph mismatches.  */
+
+static long sweep(int c, long first, long days, long firstk, long lunations, int verbose)
+{
+  long i, mismatches = 0;
+  int yy, mm, dd, q;
+  double illum, last, err, maxillum = 0, maxevent = 0;
+
+  last = candidates[c].illum(first - 1);
+  for (i = 0; i < days; i++) {
+    illum = candidates[c].illum(first + i);
+    err = abs(illum - refillum[i + 1]);
+    if (err > maxillum)
+      maxillum = err;
+    if (glyph(illum, last) != glyph(refillum[i + 1], refillum[i])) {
+      if ((candidates[c].gated && mismatches < SHOWN) || verbose) {
+        jyear(first + i, &yy, &mm, &dd);
+        printf("  %-12s glyph mismatch %ld (%d-%02d-%02d): %d%c vs reference %d%c\n",
+               candidates[c].name, first + i, yy, mm, dd, myround(illum * 14),
+               last < illum ? '+' : '-', myround(refillum[i + 1] * 14),
+               refillum[i] < refillum[i + 1] ? '+' : '-');
+      }
+      mismatches++;
+    }
+    last = illum;
+  }
+  for (i = 0; i < lunations; i++)
+    for (q = 0; q < 4; q++) {
+      err = fabsl(candidates[c].event(firstk + i, q * 0.25) - refevent[i * 4 + q]) * 1440;
+      if (err > maxevent)
+        maxevent = err;
+    }
+  printf("%-14s %10ld %14.3g %14.3g %s\n", candidates[c].name, mismatches, maxillum, maxevent,
+         !candidates[c].gated ? "info" : mismatches ? "FAIL" : "ok");
+  return mismatches;
+}
+
+/*  Main program  */
+
+int main(int argc, char *argv[])
+{
+  int i, c, q, only = -1, verbose = FALSE, firstyear = FIRST_YEAR, lastyear = LAST_YEAR, failed = 0;
+  long first, days, firstk, lunations;
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-y") && i + 2 < argc) {
+      firstyear = atoi(argv[++i]);
+      lastyear = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+      for (only = 0; only < CANDIDATES && strcmp(candidates[only].name, argv[i + 1]); only++)
+        ;
+      if (only == CANDIDATES) {
+        fprintf(stderr, "%s: no candidate %s (-l lists them)\n", argv[0], argv[i + 1]);
+        return 2;
+      }
+      i++;
+    } else if (!strcmp(argv[i], "-l")) {
+      for (c = 0; c < CANDIDATES; c++)
+        printf("%s%s\n", candidates[c].name, candidates[c].gated ? " (gated)" : "");
+      return 0;
+    } else if (!strcmp(argv[i], "-v")) {
+      verbose = TRUE;
+    } else {
+      fprintf(stderr, "Usage: %s [-y first last] [-c candidate] [-l] [-v]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (lastyear < firstyear) {
+    fprintf(stderr, "%s: empty year range\n", argv[0]);
+    return 2;
+  }
+
+  first = jdn_from_civil(firstyear, 1, 1);
+  days = jdn_from_civil(lastyear + 1, 1, 1) - first;
+  firstk = floor((first - 2415020.75933) / synmonth) + 1;
+  lunations = floor((first + days - 2415020.75933) / synmonth) - firstk;
+  if (lunations < 0)
+    lunations = 0;
+
+  refillum = malloc((days + 1) * sizeof(double));
+  refevent = malloc((lunations * 4 + 1) * sizeof(ldouble));
+  for (i = 0; i <= days; i++)
+    refillum[i] = refphase(first - 1 + i);
+  for (i = 0; i < lunations; i++)
+    for (q = 0; q < 4; q++)
+      refevent[i * 4 + q] = reftruephase(firstk + i, q * 0.25);
+
+  printf("Reference: Walker model in long double, %d-%d (%ld days, %ld lunations)\n\n",
+         firstyear, lastyear, days, lunations);
+  printf("%-14s %10s %14s %14s\n", "candidate", "glyph diff", "max dillum", "max dt min");
+  for (c = 0; c < CANDIDATES; c++)
+    if (only < 0 || only == c)
+      if (sweep(c, first, days, firstk, lunations, verbose) && candidates[c].gated)
+        failed++;
+  free(refillum);
+  free(refevent);
+  return failed != 0;
+}
@@ -0,0 +1,107 @@
+#include <string.h>
+#include "moonlib.h"
+#include "timing.h"
+
+/*  Check and time phaseglyphs(), which classifies days into the
+    watch's phase buckets with the truncated model of phasebound() and
+    falls back to phase() only near a bucket edge or the waxing turn.
+    For each tier of the truncated model, over a range of years:
+
+	- the widest bound on the illuminated fraction, and the largest
+	  distance from phase()'s as a share of the bound given, which
+	  must not exceed 1;
+	- every glyph code against those phase() gives, which must be
+	  identical;
+	- the share of days phase() was needed for, and the time per
+	  day against phase() alone.
+
+    Usage: moonclass [-y first last]
+
+    The exit status is non-zero if a bound is exceeded or a code
+    differs.  */
+
+#define FIRST_YEAR 1500
+#define LAST_YEAR  2499
+#define PASSES     3
+
+static char *tiername[TIERS] = {"full", "reduced", "coarse"};
+
+int main(int argc, char *argv[])
+{
+  int firstyear = FIRST_YEAR, lastyear = LAST_YEAR, tier, pass;
+  long first, days, day, exact = 0, mismatches, errors = 0;
+  double cphase, lastc, aom, cdist, cangdia, csund, csuang, c, b, ratio, maxbound, start, elapsed, tfull, tadapt;
+  unsigned char *reference, *codes;
+
+  if (argc == 4 && !strcmp(argv[1], "-y")) {
+    firstyear = atoi(argv[2]);
+    lastyear = atoi(argv[3]);
+  } else if (argc != 1) {
+    fprintf(stderr, "Usage: %s [-y first last]\n", argv[0]);
+    return 2;
+  }
+  first = jdn_from_civil(firstyear, 1, 1);
+  days = jdn_from_civil(lastyear + 1, 1, 1) - first;
+  if (days <= 0) {
+    fprintf(stderr, "%s: bad year range\n", argv[0]);
+    return 2;
+  }
+  reference = malloc(days);
+  codes = malloc(days);
+
+  /*  The reference, timed as phase() alone works it out.  */
+
+  tfull = 1e30;
+  for (pass = 0; pass < PASSES; pass++) {
+    start = nanotime();
+    phase(first - 1, &lastc, &aom, &cdist, &cangdia, &csund, &csuang);
+    for (day = 0; day < days; day++) {
+      phase(first + day, &cphase, &aom, &cdist, &cangdia, &csund, &csuang);
+      reference[day] = myround(cphase * 14) * 2 + (lastc < cphase);
+      lastc = cphase;
+    }
+    elapsed = (nanotime() - start) / days;
+    if (elapsed < tfull)
+      tfull = elapsed;
+  }
+
+  printf("Adaptive phase classification over %d-%d: %ld days, phase() %.1f ns/day\n\n",
+         firstyear, lastyear, days, tfull);
+  printf("%-8s %12s %10s %10s %10s %9s %8s\n", "tier", "max bound", "max/bound", "fallbacks",
+         "mismatches", "ns/day", "speedup");
+  for (tier = 0; tier < TIERS; tier++) {
+    ratio = maxbound = 0;
+    for (day = -1; day < days; day++) {
+      c = phasebound(tier, first + day, &b);
+      phase(first + day, &cphase, &aom, &cdist, &cangdia, &csund, &csuang);
+      if (b > maxbound)
+        maxbound = b;
+      if (fabs(c - cphase) / b > ratio)
+        ratio = fabs(c - cphase) / b;
+    }
+
+    tadapt = 1e30;
+    for (pass = 0; pass < PASSES; pass++) {
+      start = nanotime();
+      exact = phaseglyphs(tier, first, days, codes);
+      elapsed = (nanotime() - start) / days;
+      if (elapsed < tadapt)
+        tadapt = elapsed;
+    }
+    for (day = mismatches = 0; day < days; day++)
+      if (codes[day] != reference[day]) {
+        if (mismatches++ < 10)
+          fprintf(stderr, "moonclass: %s: JDN %ld code %d, phase() gives %d\n",
+                  tiername[tier], first + day, codes[day], reference[day]);
+      }
+    if (ratio > 1) {
+      fprintf(stderr, "moonclass: %s: distance %.3g times the bound\n", tiername[tier], ratio);
+      errors++;
+    }
+    errors += mismatches;
+
+    printf("%-8s %12.3g %10.3f %9.3f%% %10ld %9.1f %7.2fx\n", tiername[tier], maxbound,
+           ratio, 100.0 * exact / days, mismatches, tadapt, tfull / tadapt);
+  }
+  return errors != 0;
+}
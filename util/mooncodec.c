@@ -0,0 +1,454 @@
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include "moonlib.h"
+#include "moondecode.h"
+#include "timing.h"
+
+/*  Candidate encodings of the moon glyph for each day, for deciding how
+    phase data should be stored on the watch.  Every candidate is built
+    from the glyphs phase() gives over a range of years, as moontool
+    works them out, decoded again for every day and checked against
+    them with its decoder in src/c/moondecode.h, which the watch can
+    include.  For each one the report gives the encoded size, the size
+    of the decoder in this program's own code from its symbol table,
+    which is x86-64 or whatever the host is and says nothing of its
+    size in Thumb-2 on the watch, the mean decode time in day order and
+    in random order, and the worst time any one day took.
+
+    pair	2 bytes a day, phase 0-14 and waxing, as MoonPhaseDateLookup
+    byte	the moon font character, 1 byte a day
+    packed5	phase and waxing as a 5-bit code, bit-packed
+    delta	blocks of 32 days: the first day's code, then for each day
+		the change in phase (3 bits) and waxing (1 bit)
+    lunation	the minute of each new moon and quarter; the Moon's age runs
+		evenly between them and gives the phase against thresholds,
+		with the days that gives wrongly listed as exceptions
+    poly	the Moon's age every 5 days, quadratic between them, and
+		the phase from it as for lunation, with exceptions
+
+    Usage: mooncodec [-y first last] [-r bytes] [-o file]
+
+    With a budget for the encoded data (-r), the fastest candidate in
+    random order that fits is chosen, and with -o its data written as a
+    C header that reads a day through the candidate's decoder.  The exit
+    status is non-zero if any candidate decodes a day wrongly.  */
+
+#define FIRST_YEAR 2020
+#define LAST_YEAR  2119
+#define PASSES     3
+
+static long first, days;	   /* Julian day number of day 0, and days */
+static unsigned char *code;	   /* Phase * 2 + waxing of each day */
+static double *illum;		   /* Illuminated fraction, from day -1 */
+
+/*  WR16, WR32  --  Little-endian fields of an encoding, as
+		    moon_rd16() and moon_rd32() read them.  */
+
+static void wr16(unsigned char *p, unsigned v)
+{
+  p[0] = v;
+  p[1] = v >> 8;
+}
+
+static void wr32(unsigned char *p, int32_t v)
+{
+  wr16(p, v & 0xFFFF);
+  wr16(p + 2, (uint32_t) v >> 16);
+}
+
+/*  ADDEXCEPTIONS  --  Append to an encoding of size bytes the days its
+		       model gets wrong; returns the new size.  */
+
+static long addexceptions(unsigned char *out, long size, int (*model)(const unsigned char *, long), long *count)
+{
+  long day, n = 0;
+  unsigned char *ex = out + size;
+
+  wr32(out, size);
+  for (day = 0; day < days; day++)
+    if (model(out, day) != moon_glyph(code[day] / 2, code[day] & 1))
+      n++;
+  wr32(ex, n);
+  n = 0;
+  for (day = 0; day < days; day++)
+    if (model(out, day) != moon_glyph(code[day] / 2, code[day] & 1))
+      wr32(ex + 4 + 4 * n++, day);
+  for (day = 0; day < n; day++)
+    ex[4 + 4 * n + day] = moon_glyph(code[moon_rd32(ex + 4 + 4 * day)] / 2, code[moon_rd32(ex + 4 + 4 * day)] & 1);
+  *count = n;
+  return size + 4 + 5 * n;
+}
+
+/*  Pair: MoonPhaseDateLookup[day][2].  */
+
+static long encode_pair(unsigned char *out, long *exceptions)
+{
+  long day;
+
+  (void) exceptions;
+  for (day = 0; day < days; day++) {
+    out[2 * day] = code[day] / 2;
+    out[2 * day + 1] = code[day] & 1;
+  }
+  return 2 * days;
+}
+
+/*  Byte: the character itself.  */
+
+static long encode_byte(unsigned char *out, long *exceptions)
+{
+  long day;
+
+  (void) exceptions;
+  for (day = 0; day < days; day++)
+    out[day] = moon_glyph(code[day] / 2, code[day] & 1);
+  return days;
+}
+
+/*  Packed5: 5 bits a day, low bits first, with a byte of padding so a
+    code can always be read from two bytes.  */
+
+static long encode_packed5(unsigned char *out, long *exceptions)
+{
+  long day, size = (5 * days + 7) / 8 + 1;
+
+  (void) exceptions;
+  memset(out, 0, size);
+  for (day = 0; day < days; day++) {
+    out[5 * day / 8] |= code[day] << (5 * day % 8);
+    out[5 * day / 8 + 1] |= code[day] >> (8 - 5 * day % 8);
+  }
+  return size;
+}
+
+/*  Delta: per block the code of its first day, then a nibble for each
+    later day, the change in phase plus 4 in the low 3 bits and the
+    waxing flag above.  A change outside -4..3 cannot be encoded.  */
+
+static long encode_delta(unsigned char *out, long *exceptions)
+{
+  long day, size = (days + MOON_DELTA_DAYS - 1) / MOON_DELTA_DAYS * MOON_DELTA_BLOCK;
+  unsigned char *block;
+  int i, change;
+
+  (void) exceptions;
+  memset(out, 0, size);
+  for (day = 0; day < days; day++) {
+    block = out + day / MOON_DELTA_DAYS * MOON_DELTA_BLOCK;
+    i = day % MOON_DELTA_DAYS;
+    if (i == 0) {
+      block[0] = code[day];
+      continue;
+    }
+    change = code[day] / 2 - code[day - 1] / 2;
+    if (change < -4 || change > 3)
+      return -1;
+    block[1 + (i - 1) / 2] |= ((change + 4) | (code[day] & 1) << 3) << ((i - 1) % 2 * 4);
+  }
+  return size;
+}
+
+/*  THRESHOLDS  --  The 14 phase thresholds on the Moon's distance from
+		    new moon, as fractions of a turn of 65536, that
+		    moon_turnglyph() reads.  */
+
+static void thresholds(unsigned char *out)
+{
+  int i;
+
+  for (i = 1; i <= 14; i++)
+    wr16(out + 2 * (i - 1), myround(acos(1 - 2 * (i - 0.5) / 14) / (2 * PI) * 65536));
+}
+
+/*  Lunation: exceptions offset, the number of anchors, the thresholds,
+    then the new moons and quarters in turn, in minutes from noon UT of
+    day 0.  The Moon's age runs evenly from one anchor to the next; it
+    is far from even over a whole lunation.  */
+
+/*  ANCHOR  --  Time of a new moon or quarter by phase() itself, which
+	       truephase()'s series puts up to hours away: from that
+	       estimate, step by the age still to go.  */
+
+static double anchor(double k, double q)
+{
+  double jd = truephase(k, 0.0) + q * synmonth, cphase, aom, cdist, cangdia, csund, csuang, f;
+  int i;
+
+  for (i = 0; i < 8; i++) {
+    phase(jd, &cphase, &aom, &cdist, &cangdia, &csund, &csuang);
+    f = aom / synmonth - q;
+    f -= floor(f + 0.5);
+    jd -= f * synmonth;
+  }
+  return jd;
+}
+
+static long encode_lunation(unsigned char *out, long *exceptions)
+{
+  double usek, jd;
+  long n = 0, k;
+  int q;
+
+  thresholds(out + 8);
+  meanphase(first - 2 * synmonth, 0, &usek);
+  for (k = (long) usek; truephase(k, 0.0) <= first; k++)
+    ;
+  for (k -= 2; ; k++)
+    for (q = 0; q < MOON_ANCHORS; q++) {
+      jd = anchor(k, (double) q / MOON_ANCHORS);
+      wr32(out + 8 + 2 * 14 + 4 * n++, (int32_t) floor((jd - first) * 1440 + 0.5));
+      if (jd > first + days + 1) {
+        wr32(out + 4, n);
+        return addexceptions(out, 8 + 2 * 14 + 4 * n, moon_lunation_model, exceptions);
+      }
+    }
+}
+
+/*  Poly: exceptions offset, the number of nodes, the thresholds, then
+    the Moon's age as a fraction of a turn (of 65536) every
+    MOON_POLY_STEP days from day -2 * MOON_POLY_STEP.  Each
+    2 * MOON_POLY_STEP days take the quadratic through three nodes,
+    unwrapped across whole turns.  The
+    age is nearly linear in time, where the illuminated fraction is
+    not.  */
+
+static long encode_poly(unsigned char *out, long *exceptions)
+{
+  long n = (days + 2 * MOON_POLY_STEP) / MOON_POLY_STEP + 3, i;
+  double cphase, aom, cdist, cangdia, csund, csuang;
+
+  thresholds(out + 8);
+  for (i = 0; i < n; i++) {
+    phase(first + (i - 2) * MOON_POLY_STEP, &cphase, &aom, &cdist, &cangdia, &csund, &csuang);
+    wr16(out + 8 + 2 * 14 + 2 * i, myround(aom / synmonth * 65536) & 0xFFFF);
+  }
+  wr32(out + 4, n);
+  return addexceptions(out, 8 + 2 * 14 + 2 * n, moon_poly_model, exceptions);
+}
+
+/*  The candidates, and the functions that make up each decoder.  */
+
+static struct codec {
+  char *name;
+  long (*encode)(unsigned char *out, long *exceptions);
+  int (*decode)(const unsigned char *data, long day);
+  char *symbols;
+  unsigned char *data;
+  long size, exceptions, code, mismatches;
+  double seqns, randns, worst;
+} codecs[] = {
+  {"pair", encode_pair, moon_decode_pair, "moon_decode_pair"},
+  {"byte", encode_byte, moon_decode_byte, "moon_decode_byte"},
+  {"packed5", encode_packed5, moon_decode_packed5, "moon_decode_packed5"},
+  {"delta", encode_delta, moon_decode_delta, "moon_decode_delta"},
+  {"lunation", encode_lunation, moon_decode_lunation, "moon_decode_lunation moon_lunation_model moon_turnglyph moon_exception"},
+  {"poly", encode_poly, moon_decode_poly, "moon_decode_poly moon_poly_model moon_turnglyph moon_exception"},
+};
+#define CODECS (sizeof(codecs) / sizeof(codecs[0]))
+
+/*  CODESIZE  --  Bytes of host code in the named functions, from the
+		  symbol table of this program, or -1 without nm.  Only
+		  for comparing the candidates with each other.  */
+
+static long codesize(const char *symbols)
+{
+  char line[256], name[128], want[128], exe[200];
+  unsigned long size, total = 0;
+  const char *s;
+  ssize_t length = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+  FILE *f;
+  int n, found = 0;
+
+  if (length <= 0)
+    return -1;
+  exe[length] = '\0';
+  snprintf(line, sizeof(line), "nm -S --defined-only '%s' 2>/dev/null", exe);
+  if (!(f = popen(line, "r")))
+    return -1;
+  while (fgets(line, sizeof(line), f)) {
+    if (sscanf(line, "%*s %lx %*c %127s", &size, name) != 2)
+      continue;
+    name[strcspn(name, ".")] = '\0';
+    for (s = symbols; sscanf(s, "%127s%n", want, &n) == 1; s += n)
+      if (!strcmp(name, want)) {
+        total += size;
+        found++;
+      }
+  }
+  pclose(f);
+  return found ? (long) total : -1;
+}
+
+/*  MEASURE  --  Decode every day in order and in a shuffled order,
+		 best of PASSES each, and time each day alone for the
+		 worst case, in cycles less the cost of reading the
+		 counter.  */
+
+static volatile long sink;
+
+static void measure(struct codec *c, const long *order)
+{
+  double start, elapsed;
+  unsigned long long t0, t1, best, overhead = ~0ULL, worst = 0;
+  long day;
+  int pass;
+
+  c->seqns = c->randns = 1e30;
+  for (pass = 0; pass < PASSES; pass++) {
+    start = nanotime();
+    for (day = 0; day < days; day++)
+      sink += c->decode(c->data, day);
+    elapsed = (nanotime() - start) / days;
+    if (elapsed < c->seqns)
+      c->seqns = elapsed;
+    start = nanotime();
+    for (day = 0; day < days; day++)
+      sink += c->decode(c->data, order[day]);
+    elapsed = (nanotime() - start) / days;
+    if (elapsed < c->randns)
+      c->randns = elapsed;
+  }
+  for (pass = 0; pass < 1000; pass++) {
+    t0 = cycles();
+    t1 = cycles();
+    if (t1 - t0 < overhead)
+      overhead = t1 - t0;
+  }
+  for (day = 0; day < days; day++) {
+    best = ~0ULL;
+    for (pass = 0; pass < PASSES; pass++) {
+      t0 = cycles();
+      sink += c->decode(c->data, day);
+      t1 = cycles();
+      if (t1 - t0 < best)
+        best = t1 - t0;
+    }
+    if (best - overhead > worst && best > overhead)
+      worst = best - overhead;
+  }
+  c->worst = worst;
+}
+
+/*  EMIT  --  Write an encoding as a C header.  */
+
+static int emit(const char *path, struct codec *c, int firstyear, int lastyear)
+{
+  FILE *f = fopen(path, "w");
+  long i;
+
+  if (!f)
+    return 0;
+  fprintf(f, "/* Moon glyphs for %d-%d, %s encoding, written by util/mooncodec.\n", firstyear, lastyear, c->name);
+  fprintf(f, "   Day 0 is Julian day number %ld; moon_table_glyph() reads a day's\n", first);
+  fprintf(f, "   glyph from MoonTable with moon_decode_%s() in moondecode.h. */\n\n", c->name);
+  fprintf(f, "#include \"moondecode.h\"\n\n");
+  fprintf(f, "#define MOON_TABLE_FIRST %ld\n#define MOON_TABLE_DAYS %ld\n\n", first, days);
+  fprintf(f, "static const uint8_t MoonTable[%ld] =\n{", c->size);
+  for (i = 0; i < c->size; i++)
+    fprintf(f, "%s%d%s", i % 16 ? " " : "\n\t", c->data[i], i + 1 < c->size ? "," : "");
+  fprintf(f, "\n};\n\n");
+  fprintf(f, "// the glyph for day jdn, or '\\0' if the table does not hold it\n");
+  fprintf(f, "static inline char moon_table_glyph(int32_t jdn)\n{\n");
+  fprintf(f, "\tif (jdn < MOON_TABLE_FIRST || jdn - MOON_TABLE_FIRST >= MOON_TABLE_DAYS)\n\t{\n\t\treturn '\\0';\n\t}\n");
+  fprintf(f, "\treturn moon_decode_%s(MoonTable, jdn - MOON_TABLE_FIRST);\n}\n", c->name);
+  return fclose(f) == 0;
+}
+
+/*  Main program  */
+
+int main(int argc, char *argv[])
+{
+  int firstyear = FIRST_YEAR, lastyear = LAST_YEAR, i;
+  long ram = -1, day, j, *order, errors = 0, t;
+  const char *output = NULL;
+  double cphase, aom, cdist, cangdia, csund, csuang;
+  struct codec *c, *best = NULL;
+  unsigned long seed = 1;
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-y") && i + 2 < argc) {
+      firstyear = atoi(argv[++i]);
+      lastyear = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-r") && i + 1 < argc)
+      ram = atol(argv[++i]);
+    else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+      output = argv[++i];
+    else {
+      fprintf(stderr, "Usage: %s [-y first last] [-r bytes] [-o file]\n", argv[0]);
+      return 2;
+    }
+  }
+  first = jdn_from_civil(firstyear, 1, 1);
+  days = jdn_from_civil(lastyear + 1, 1, 1) - first;
+  if (days <= 0) {
+    fprintf(stderr, "%s: bad year range\n", argv[0]);
+    return 2;
+  }
+
+  /*  The reference: phase at noon UT of each day, waxing if larger than
+      the day before's, as the old lookup table had it.  */
+
+  code = malloc(days);
+  illum = malloc((days + 1) * sizeof(double));
+  order = malloc(days * sizeof(long));
+  for (day = -1; day < days; day++) {
+    phase(first + day, &cphase, &aom, &cdist, &cangdia, &csund, &csuang);
+    illum[day + 1] = cphase;
+    if (day >= 0)
+      code[day] = myround(cphase * 14) * 2 + (illum[day] < cphase);
+  }
+  for (day = 0; day < days; day++)
+    order[day] = day;
+  for (day = days - 1; day > 0; day--) {
+    seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+    j = (seed >> 33) % (day + 1);
+    t = order[day];
+    order[day] = order[j];
+    order[j] = t;
+  }
+
+  printf("Moon glyph encodings over %d-%d: %ld days\n\n", firstyear, lastyear, days);
+  printf("%-9s %10s %9s %10s %10s %9s %9s %10s\n", "codec", "data bytes", "bytes/day", "host code",
+         "exceptions", "seq ns", "rand ns", "worst cyc");
+  for (c = codecs; c < codecs + CODECS; c++) {
+    c->data = malloc(8 * days + 1024);
+    c->exceptions = 0;
+    c->size = c->encode(c->data, &c->exceptions);
+    if (c->size < 0) {
+      printf("%-9s does not fit this range\n", c->name);
+      continue;
+    }
+    for (day = 0; day < days; day++)
+      if (c->decode(c->data, day) != moon_glyph(code[day] / 2, code[day] & 1)) {
+        if (c->mismatches++ < 10)
+          fprintf(stderr, "mooncodec: %s decodes JDN %ld wrongly\n", c->name, first + day);
+      }
+    errors += c->mismatches;
+    c->code = codesize(c->symbols);
+    measure(c, order);
+    printf("%-9s %10ld %9.3f %10ld %10ld %9.2f %9.2f %10.0f%s\n", c->name, c->size, (double) c->size / days,
+           c->code, c->exceptions, c->seqns, c->randns, c->worst, c->mismatches ? "  MISMATCH" : "");
+    if (!c->mismatches && (ram < 0 || c->size <= ram) &&
+        (!best || c->randns < best->randns))
+      best = c;
+  }
+
+  if (ram >= 0 || output) {
+    printf("\n");
+    if (!best) {
+      if (ram >= 0)
+        printf("No encoding fits %ld bytes\n", ram);
+      else
+        printf("No encoding decodes every day\n");
+      return 1;
+    }
+    printf("Best: %s, %ld data bytes, %ld bytes of host code, %.2f ns a random day\n",
+           best->name, best->size, best->code, best->randns);
+    if (output && !emit(output, best, firstyear, lastyear)) {
+      fprintf(stderr, "%s: cannot write %s\n", argv[0], output);
+      return 1;
+    }
+  }
+  return errors != 0;
+}
@@ -0,0 +1,158 @@
+#include <string.h>
+#include "moonlib.h"
+#include "timing.h"
+
+/*  Find the eclipses over a range of years with eclipses(), once
+    working out every new and full moon in full and once turning away
+    first those too far from a node.  Reports:
+
+	- the syzygies checked, those the first test rejected and the
+	  time taken by each way, which must find the same eclipses;
+	- the eclipses of each kind, and that some well known ones are
+	  among them;
+
+    and with -o writes the eclipse days as a C header: a day count from
+    the last eclipse, or from the first day of the range, times 4 plus
+    the kind, two bytes each.  Nothing on the watch reads it: the moon
+    glyphs are worked out by the worker, and the moon font has no
+    eclipse glyph to show.
+
+    Usage: mooneclipse [-y first last] [-o file]
+
+    The exit status is non-zero if the two ways disagree or a known
+    eclipse is missing.  */
+
+#define FIRST_YEAR 1000
+#define LAST_YEAR  2999
+#define PASSES     3
+
+static char *kindname[3] = {"solar", "penumbral", "umbral"};
+
+/*  Eclipses the model has to find: the day (UT) and kind.  */
+
+static struct {
+  int year, month, day, kind;
+} known[] = {
+  {1999, 8, 11, ECLIPSE_SOLAR},
+  {2017, 8, 21, ECLIPSE_SOLAR},
+  {2024, 4, 8, ECLIPSE_SOLAR},
+  {2000, 1, 21, ECLIPSE_UMBRAL},
+  {2019, 1, 21, ECLIPSE_UMBRAL},
+  {2022, 11, 8, ECLIPSE_UMBRAL},
+  {2020, 1, 10, ECLIPSE_PENUMBRAL},
+  {2023, 5, 5, ECLIPSE_PENUMBRAL},
+};
+#define KNOWN (sizeof(known) / sizeof(known[0]))
+
+/*  EMIT  --  Write the eclipse days as a C header.  */
+
+static int emit(const char *path, long first, double *times, int *kinds, long n, int firstyear, int lastyear)
+{
+  FILE *f = fopen(path, "w");
+  long i, day, last = first;
+
+  if (!f)
+    return 0;
+  fprintf(f, "/* Eclipses for %d-%d, written by util/mooneclipse.  Each entry is the\n", firstyear, lastyear);
+  fprintf(f, "   days since the one before, or since ECLIPSE_TABLE_FIRST, times 4 plus\n");
+  fprintf(f, "   the kind: 0 solar, 1 penumbral lunar, 2 umbral lunar. */\n\n");
+  fprintf(f, "#define ECLIPSE_TABLE_FIRST %ld\n#define ECLIPSE_TABLE_COUNT %ld\n\n", first, n);
+  fprintf(f, "static const uint16_t EclipseTable[%ld] =\n{", n);
+  for (i = 0; i < n; i++) {
+    day = (long) floor(times[i] + 0.5);
+    fprintf(f, "%s%ld%s", i % 12 ? " " : "\n\t", (day - last) * 4 + kinds[i], i + 1 < n ? "," : "");
+    last = day;
+  }
+  fprintf(f, "\n};\n");
+  return fclose(f) == 0;
+}
+
+int main(int argc, char *argv[])
+{
+  int firstyear = FIRST_YEAR, lastyear = LAST_YEAR, prune, pass, *kinds[2], counts[3] = {0, 0, 0}, i;
+  long first, max, n[2], checked[2], rejected[2], j, errors = 0;
+  double *times[2], start, elapsed, best[2];
+  const char *output = NULL;
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-y") && i + 2 < argc) {
+      firstyear = atoi(argv[++i]);
+      lastyear = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+      output = argv[++i];
+    else {
+      fprintf(stderr, "Usage: %s [-y first last] [-o file]\n", argv[0]);
+      return 2;
+    }
+  }
+  first = jdn_from_civil(firstyear, 1, 1);
+  max = jdn_from_civil(lastyear + 1, 1, 1) - first;
+  if (max <= 0) {
+    fprintf(stderr, "%s: bad year range\n", argv[0]);
+    return 2;
+  }
+  max = max / 14 + 4;
+
+  for (prune = 0; prune < 2; prune++) {
+    times[prune] = malloc(max * sizeof(double));
+    kinds[prune] = malloc(max * sizeof(int));
+    best[prune] = 1e30;
+    for (pass = 0; pass < PASSES; pass++) {
+      start = nanotime();
+      n[prune] = eclipses(first - 0.5, jdn_from_civil(lastyear + 1, 1, 1) - 0.5, prune,
+                          times[prune], kinds[prune], max, &checked[prune], &rejected[prune]);
+      elapsed = (nanotime() - start) / 1e9;
+      if (elapsed < best[prune])
+        best[prune] = elapsed;
+    }
+    if (n[prune] > max) {
+      fprintf(stderr, "%s: %ld eclipses, room for %ld\n", argv[0], n[prune], max);
+      return 1;
+    }
+  }
+
+  /*  The pruned search against the full one.  */
+
+  if (n[0] != n[1]) {
+    fprintf(stderr, "mooneclipse: %ld eclipses in full, %ld pruned\n", n[0], n[1]);
+    errors++;
+  }
+  for (j = 0; j < n[0] && j < n[1]; j++)
+    if (times[0][j] != times[1][j] || kinds[0][j] != kinds[1][j]) {
+      if (errors++ < 10)
+        fprintf(stderr, "mooneclipse: %s at %.4f in full, %s at %.4f pruned\n", kindname[kinds[0][j]],
+                times[0][j], kindname[kinds[1][j]], times[1][j]);
+    }
+  for (j = 0; j < n[1]; j++)
+    counts[kinds[1][j]]++;
+
+  for (i = 0; i < (int) KNOWN; i++) {
+    long day = jdn_from_civil(known[i].year, known[i].month, known[i].day);
+
+    if (known[i].year < firstyear || known[i].year > lastyear)
+      continue;
+    for (j = 0; j < n[1]; j++)
+      if ((long) floor(times[1][j] + 0.5) == day && kinds[1][j] == known[i].kind)
+        break;
+    if (j == n[1]) {
+      fprintf(stderr, "mooneclipse: no %s eclipse on %d-%02d-%02d\n", kindname[known[i].kind],
+              known[i].year, known[i].month, known[i].day);
+      errors++;
+    }
+  }
+
+  printf("Eclipses over %d-%d: %d solar, %d penumbral, %d umbral\n\n", firstyear, lastyear,
+         counts[ECLIPSE_SOLAR], counts[ECLIPSE_PENUMBRAL], counts[ECLIPSE_UMBRAL]);
+  printf("%-8s %10s %10s %10s %10s %10s\n", "search", "checked", "rejected", "refined", "eclipses", "ms");
+  for (prune = 0; prune < 2; prune++)
+    printf("%-8s %10ld %10ld %10ld %10ld %10.2f\n", prune ? "pruned" : "full", checked[prune],
+           rejected[prune], checked[prune] - rejected[prune], n[prune], best[prune] * 1e3);
+  printf("\nspeedup %.2fx, %.1f%% of syzygies rejected\n", best[0] / best[1],
+         100.0 * rejected[1] / checked[1]);
+
+  if (output && !emit(output, first, times[1], kinds[1], n[1], firstyear, lastyear)) {
+    fprintf(stderr, "%s: cannot write %s\n", argv[0], output);
+    return 1;
+  }
+  return errors != 0;
+}
@@ -0,0 +1,164 @@
+#include "moonlib.h"
+#include "timing.h"
+
+/*  Compare the Walker model in moonlib.c with the Meeus series engine
+    in meeus.c: time per call, agreement over 1900-2100, and the error
+    of each against published principal-phase times.  The exit status
+    is non-zero if the series engine is over its cost bound or either
+    engine is further from a published time than its limit.  */
+
+#define FIRST_JD 2415021L        /* 1 January 1900 */
+#define LAST_JD  2488070L        /* 1 January 2101 */
+#define FIRST_K  0
+#define LAST_K   2474
+#define DAYS     (LAST_JD - FIRST_JD)
+#define PASSES   3
+
+/*  The series engine is budgeted at this many times the cost of the
+    Walker model per call.  */
+
+#define COST_BOUND 4.0
+
+/*  Minutes either engine may lie from a published time.  The times are
+    to the minute, so half a minute is the best that can be asked; the
+    Walker model's mean elements and few terms leave it a few minutes
+    out.  */
+
+#define MEEUS_LIMIT  0.5
+#define WALKER_LIMIT 3.0
+
+/*  Principal phases as published by the US Naval Observatory, UT to
+    the minute.  */
+
+static struct {
+  int yy, mm, dd, h, m;
+  double phase;
+} published[] = {
+  {2000,  1,  6, 18, 14, 0.0},
+  {2000,  1, 14, 13, 34, 0.25},
+  {2000,  1, 21,  4, 40, 0.5},
+  {2000,  1, 28,  7, 57, 0.75},
+  {2017,  8, 21, 18, 30, 0.0},
+  {2019,  1, 21,  5, 16, 0.5},
+  {2024,  4,  8, 18, 21, 0.0},
+};
+
+static double illum[2][DAYS];
+static unsigned char glyph[2][DAYS];
+
+typedef double (*phasefn)(double, double *, double *, double *, double *, double *, double *);
+typedef double (*truephasefn)(double, double);
+
+static double timephase(phasefn f, double *out)
+{
+  long jd, i;
+  int pass;
+  double best = 0, start, elapsed, aom, cdist, cangdia, csund, csuang;
+
+  for (pass = 0; pass < PASSES; pass++) {
+    start = nanotime();
+    for (jd = FIRST_JD, i = 0; jd < LAST_JD; jd++, i++)
+      f(jd, &out[i], &aom, &cdist, &cangdia, &csund, &csuang);
+    elapsed = nanotime() - start;
+    if (pass == 0 || elapsed < best)
+      best = elapsed;
+  }
+  return best / DAYS;
+}
+
+static double timetruephase(truephasefn f)
+{
+  int k, q, pass;
+  long n = 0;
+  double best = 0, start, elapsed;
+  volatile double sink;
+
+  for (pass = 0; pass < PASSES; pass++) {
+    start = nanotime();
+    for (k = FIRST_K, n = 0; k <= LAST_K; k++)
+      for (q = 0; q < 4; q++, n++)
+        sink = f(k, q * 0.25);
+    elapsed = nanotime() - start;
+    if (pass == 0 || elapsed < best)
+      best = elapsed;
+  }
+  return best / n;
+}
+
+/*  Main program  */
+
+int main(int argc, char *argv[])
+{
+  struct tm t;
+  long i, mismatches = 0;
+  int k, q, e, fails = 0;
+  double nsphase[2], nstrue[2], last[2], jd, aom, cdist, cangdia, csund, csuang;
+  double dt, maxdt = 0, sumdt = 0, maxillum = 0, kk, walker, meeus, maxwalker = 0, maxmeeus = 0;
+
+  nsphase[0] = timephase(phase, illum[0]);
+  nsphase[1] = timephase(meeusphase, illum[1]);
+  nstrue[0] = timetruephase(truephase);
+  nstrue[1] = timetruephase(meeustruephase);
+
+  phase(FIRST_JD - 1, &last[0], &aom, &cdist, &cangdia, &csund, &csuang);
+  meeusphase(FIRST_JD - 1, &last[1], &aom, &cdist, &cangdia, &csund, &csuang);
+  for (i = 0; i < DAYS; i++) {
+    for (e = 0; e < 2; e++) {
+      glyph[e][i] = myround(illum[e][i] * 14) * 2 + (last[e] < illum[e][i]);
+      last[e] = illum[e][i];
+    }
+    if (glyph[0][i] != glyph[1][i])
+      mismatches++;
+    if (abs(illum[0][i] - illum[1][i]) > maxillum)
+      maxillum = abs(illum[0][i] - illum[1][i]);
+  }
+  for (k = FIRST_K; k <= LAST_K; k++)
+    for (q = 0; q < 4; q++) {
+      dt = abs(truephase(k, q * 0.25) - meeustruephase(k, q * 0.25)) * 1440;
+      sumdt += dt;
+      if (dt > maxdt)
+        maxdt = dt;
+    }
+
+  printf("Engines over 1900-2100 (%ld days, %d phases)\n\n", DAYS, (LAST_K - FIRST_K + 1) * 4);
+  printf("%-8s %10s %14s\n", "engine", "ns/phase", "ns/truephase");
+  printf("%-8s %10.1f %14.1f\n", "walker", nsphase[0], nstrue[0]);
+  printf("%-8s %10.1f %14.1f\n", "meeus", nsphase[1], nstrue[1]);
+  printf("\nCost ratio meeus/walker: phase %.2fx, truephase %.2fx (bound %.1fx)\n",
+         nsphase[1] / nsphase[0], nstrue[1] / nstrue[0], COST_BOUND);
+  printf("Phase times differ by %.2f min mean, %.2f min max\n", sumdt / ((LAST_K - FIRST_K + 1) * 4), maxdt);
+  printf("Illuminated fraction differs by at most %.4f; %ld of %ld daily glyphs differ\n\n",
+         maxillum, mismatches, DAYS);
+
+  printf("%-17s %6s %12s %12s\n", "published (UT)", "phase", "walker min", "meeus min");
+  for (i = 0; i < sizeof(published) / sizeof(published[0]); i++) {
+    t.tm_year = published[i].yy - 1900;
+    t.tm_mon = published[i].mm - 1;
+    t.tm_mday = published[i].dd;
+    t.tm_hour = published[i].h;
+    t.tm_min = published[i].m;
+    t.tm_sec = 0;
+    jd = jtime(&t);
+    kk = floor((jd - 2415020.75933) / synmonth - published[i].phase + 0.5);
+    walker = (truephase(kk, published[i].phase) - jd) * 1440;
+    meeus = (meeustruephase(kk, published[i].phase) - jd) * 1440;
+    printf("%04d-%02d-%02d %02d:%02d %6.2f %+12.2f %+12.2f\n", published[i].yy, published[i].mm,
+           published[i].dd, published[i].h, published[i].m, published[i].phase, walker, meeus);
+    if (abs(walker) > maxwalker)
+      maxwalker = abs(walker);
+    if (abs(meeus) > maxmeeus)
+      maxmeeus = abs(meeus);
+  }
+  printf("%-24s %12.2f %12.2f\n", "largest", maxwalker, maxmeeus);
+  printf("%-24s %12.2f %12.2f\n", "limit", WALKER_LIMIT, MEEUS_LIMIT);
+
+  if (nsphase[1] > COST_BOUND * nsphase[0] || nstrue[1] > COST_BOUND * nstrue[0]) {
+    printf("\nFAIL: series engine exceeds %.1fx the cost of the Walker model\n", COST_BOUND);
+    fails++;
+  }
+  if (maxwalker > WALKER_LIMIT || maxmeeus > MEEUS_LIMIT) {
+    printf("\nFAIL: an engine is further from a published phase time than its limit\n");
+    fails++;
+  }
+  return fails;
+}
@@ -0,0 +1,180 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "format.h"
+#include "timing.h"
+
+/*  Check the tile formatters in format.c against the strftime() calls
+    they replaced, for every minute of the day in both clock styles and
+    every weekday, date, month and year, then time a day of ticks
+    through each path.  */
+
+#define PASSES 200
+
+/*  STRIP  --  The watchface's old leading space or zero trim.  */
+
+static char *strip(char *input)
+{
+  if (strlen(input) > 1 && (input[0] == ' ' || input[0] == '0'))
+    return input + 1;
+  return input;
+}
+
+static long compare(const char *what, const struct tm *t, const char *want, const char *got)
+{
+  if (strcmp(want, got) == 0)
+    return 0;
+  fprintf(stderr, "%s mismatch at %02d:%02d wday %d mday %d mon %d year %d: \"%s\" vs \"%s\"\n",
+          what, t->tm_hour, t->tm_min, t->tm_wday, t->tm_mday, t->tm_mon,
+          t->tm_year + 1900, want, got);
+  return 1;
+}
+
+static long equivalence(long *checked)
+{
+  struct tm t;
+  char want[8], got[8];
+  long errors = 0, n = 0;
+  int h, m, i;
+
+  memset(&t, 0, sizeof(t));
+  t.tm_year = 120;
+  for (h = 0; h < 24; h++)
+    for (m = 0; m < 60; m++) {
+      t.tm_hour = h;
+      t.tm_min = m;
+      strftime(want, sizeof(want), "%R", &t);
+      format_time(got, &t, true);
+      errors += compare("24h time", &t, strip(want), got);
+      strftime(want, sizeof(want), "%I:%M", &t);
+      format_time(got, &t, false);
+      errors += compare("12h time", &t, strip(want), got);
+      strftime(want, sizeof(want), "%p", &t);
+      format_ampm(got, &t);
+      errors += compare("am/pm", &t, want, got);
+      n += 3;
+    }
+  for (i = 0; i < 7; i++, n++) {
+    t.tm_wday = i;
+    strftime(want, sizeof(want), "%a", &t);
+    format_weekday(got, &t);
+    errors += compare("weekday", &t, want, got);
+  }
+  for (i = 1; i <= 31; i++, n++) {
+    t.tm_mday = i;
+    strftime(want, sizeof(want), "%e", &t);
+    format_date(got, &t);
+    errors += compare("date", &t, strip(want), got);
+  }
+  for (i = 0; i < 12; i++, n++) {
+    t.tm_mon = i;
+    strftime(want, sizeof(want), "%b", &t);
+    format_month(got, &t);
+    errors += compare("month", &t, strip(want), got);
+  }
+  for (i = 0; i <= 200; i++, n++) {
+    t.tm_year = i;
+    strftime(want, sizeof(want), "%y", &t);
+    format_year(got, &t);
+    errors += compare("year", &t, want, got);
+  }
+  *checked = n;
+  return errors;
+}
+
+/*  The text work of one day of minute ticks, as handle_tick() did it
+    before and after: every tick sets the time (and AM/PM in 12-hour
+    style); the midnight tick also sets the day, date, month and year.  */
+
+static volatile char sink;
+
+static void daystrftime(struct tm *t, int clock_24h)
+{
+  char buffer[8];
+  int h, m;
+
+  for (h = 0; h < 24; h++)
+    for (m = 0; m < 60; m++) {
+      t->tm_hour = h;
+      t->tm_min = m;
+      strftime(buffer, sizeof(buffer), clock_24h ? "%R" : "%I:%M", t);
+      sink = *strip(buffer);
+      if (!clock_24h) {
+        strftime(buffer, sizeof(buffer), "%p", t);
+        sink = buffer[0];
+      }
+      if (h == 0 && m == 0) {
+        strftime(buffer, sizeof(buffer), "%a", t);
+        strftime(buffer, sizeof(buffer), "%e", t);
+        sink = *strip(buffer);
+        strftime(buffer, sizeof(buffer), "%b", t);
+        strftime(buffer, sizeof(buffer), "%y", t);
+        sink = buffer[0];
+      }
+    }
+}
+
+static void dayformat(struct tm *t, int clock_24h)
+{
+  char buffer[8];
+  int h, m;
+
+  for (h = 0; h < 24; h++)
+    for (m = 0; m < 60; m++) {
+      t->tm_hour = h;
+      t->tm_min = m;
+      format_time(buffer, t, clock_24h);
+      sink = buffer[0];
+      if (!clock_24h) {
+        format_ampm(buffer, t);
+        sink = buffer[0];
+      }
+      if (h == 0 && m == 0) {
+        format_weekday(buffer, t);
+        format_date(buffer, t);
+        sink = buffer[0];
+        format_month(buffer, t);
+        format_year(buffer, t);
+        sink = buffer[0];
+      }
+    }
+}
+
+static void bench(const char *name, void (*day)(struct tm *, int), int clock_24h)
+{
+  struct tm t;
+  double t0, ns;
+  unsigned long long c0, cyc;
+  int i;
+
+  memset(&t, 0, sizeof(t));
+  t.tm_year = 120;
+  t.tm_mon = 1;
+  t.tm_mday = 29;
+  t.tm_wday = 6;
+  day(&t, clock_24h);
+  t0 = nanotime();
+  c0 = cycles();
+  for (i = 0; i < PASSES; i++)
+    day(&t, clock_24h);
+  cyc = cycles() - c0;
+  ns = nanotime() - t0;
+  printf("%-9s %-4s %8.1f ns/tick %8.1f cycles/tick\n", name, clock_24h ? "24h" : "12h",
+         ns / (PASSES * 1440.0), cyc / (PASSES * 1440.0));
+}
+
+int main(void)
+{
+  long checked, errors;
+
+  errors = equivalence(&checked);
+  printf("equivalence: %ld strings checked, %ld mismatches\n", checked, errors);
+
+  bench("strftime", daystrftime, 0);
+  bench("format", dayformat, 0);
+  bench("strftime", daystrftime, 1);
+  bench("format", dayformat, 1);
+
+  return errors != 0;
+}
@@ -17,20 +17,7 @@ int myround(double number)
 
 long jdate(struct tm *t)
 {
-	long c, m, y;
-
-	y = t->tm_year + 1900;
-	m = t->tm_mon + 1;
-	if (m > 2)
-	   m = m - 3;
-	else {
-	   m = m + 9;
-	   y--;
-	}
-	c = y / 100L;		   /* Compute century */
-	y -= 100L * c;
-	return t->tm_mday + (c * 146097L) / 4 + (y * 1461L) / 4 +
-	    (m * 153L + 2) / 5 + 1721119L;
+	return jdn_from_civil(t->tm_year + 1900, t->tm_mon + 1, t->tm_mday);
 }
 
 
@@ -52,30 +39,12 @@ void jyear(td, yy, mm, dd)
 double td;
 int *yy, *mm, *dd;
 {
-	double j, d, y, m;
-
-	td += 0.5;		   /* Astronomical to civil */
-	j = floor(td);
-	j = j - 1721119.0;
-	y = floor(((4 * j) - 1) / 146097.0);
-	j = (j * 4.0) - (1.0 + (146097.0 * y));
-	d = floor(j / 4.0);
-	j = floor(((4.0 * d) + 3.0) / 1461.0);
-	d = ((4.0 * d) + 3.0) - (1461.0 * j);
-	d = floor((d + 4.0) / 4.0);
-	m = floor(((5.0 * d) - 3) / 153.0);
-	d = (5.0 * d) - (3.0 + (153.0 * m));
-	d = floor((d + 5.0) / 5.0);
-	y = (100.0 * y) + j;
-	if (m < 10.0)
-	   m = m + 3;
-	else {
-	   m = m - 9;
-	   y = y + 1;
-	}
-	*yy = y;
-	*mm = m;
-	*dd = d;
+	CivilDate c;
+
+	c = civil_from_jdn((int32_t) floor(td + 0.5));	/* Astronomical to civil */
+	*yy = c.year;
+	*mm = c.month;
+	*dd = c.day;
 }
 
 /*  JHMS  --  Convert Julian time to hour, minutes, and seconds.  */
@@ -137,6 +106,17 @@ double *usek;
 
 double truephase(k, phase)
 double k, phase;
+{
+	return truephasetier(MOONLIB_TIER, k, phase);
+}
+
+/*  TRUEPHASETIER  --  TRUEPHASE evaluated at the given accuracy
+		       tier.  TIER_REDUCED and below drop the
+		       periodic terms of 0.0006 days or less.  */
+
+double truephasetier(tier, k, phase)
+int tier;
+double k, phase;
 {
 	double t, t2, t3, pt, m, mprime, f;
 	int apcor = FALSE;
@@ -172,14 +152,15 @@ double k, phase;
 		    + 0.0021 * dsin(2 * m)
 		    - 0.4068 * dsin(mprime)
 		    + 0.0161 * dsin(2 * mprime)
-		    - 0.0004 * dsin(3 * mprime)
 		    + 0.0104 * dsin(2 * f)
 		    - 0.0051 * dsin(m + mprime)
 		    - 0.0074 * dsin(m - mprime)
+		    + 0.0010 * dsin(2 * f - mprime);
+	   if (tier < TIER_REDUCED)
+	      pt += - 0.0004 * dsin(3 * mprime)
 		    + 0.0004 * dsin(2 * f + m)
 		    - 0.0004 * dsin(2 * f - m)
 		    - 0.0006 * dsin(2 * f + mprime)
-		    + 0.0010 * dsin(2 * f - mprime)
 		    + 0.0005 * dsin(m + 2 * mprime);
 	   apcor = TRUE;
 	} else if ((abs(phase - 0.25) < 0.01 || (abs(phase - 0.75) < 0.01))) {
@@ -187,23 +168,27 @@ double k, phase;
 		    + 0.0021 * dsin(2 * m)
 		    - 0.6280 * dsin(mprime)
 		    + 0.0089 * dsin(2 * mprime)
-		    - 0.0004 * dsin(3 * mprime)
 		    + 0.0079 * dsin(2 * f)
 		    - 0.0119 * dsin(m + mprime)
 		    - 0.0047 * dsin(m - mprime)
+		    + 0.0021 * dsin(2 * f - mprime);
+	   if (tier < TIER_REDUCED)
+	      pt += - 0.0004 * dsin(3 * mprime)
 		    + 0.0003 * dsin(2 * f + m)
 		    - 0.0004 * dsin(2 * f - m)
 		    - 0.0006 * dsin(2 * f + mprime)
-		    + 0.0021 * dsin(2 * f - mprime)
 		    + 0.0003 * dsin(m + 2 * mprime)
 		    + 0.0004 * dsin(m - 2 * mprime)
 		    - 0.0003 * dsin(2 * m + mprime);
-	   if (phase < 0.5)
-	      /* First quarter correction */
-	      pt += 0.0028 - 0.0004 * dcos(m) + 0.0003 * dcos(mprime);
-	   else
-	      /* Last quarter correction */
-	      pt += -0.0028 + 0.0004 * dcos(m) - 0.0003 * dcos(mprime);
+	   if (tier < TIER_REDUCED) {
+	      if (phase < 0.5)
+		 /* First quarter correction */
+		 pt += 0.0028 - 0.0004 * dcos(m) + 0.0003 * dcos(mprime);
+	      else
+		 /* Last quarter correction */
+		 pt += -0.0028 + 0.0004 * dcos(m) - 0.0003 * dcos(mprime);
+	   } else
+	      pt += (phase < 0.5) ? 0.0028 : -0.0028;
 	   apcor = TRUE;
 	}
 	if (!apcor) {
@@ -278,6 +263,20 @@ double *dist;			   /* Distance in kilometres */
 double *angdia; 		   /* Angular diameter in degrees */
 double *sudist; 		   /* Distance to Sun */
 double *suangdia;                  /* Sun's angular diameter */
+{
+	return phasetier(MOONLIB_TIER, pdate, pphase, mage, dist, angdia,
+			 sudist, suangdia);
+}
+
+/*  PHASETIER  --  PHASE evaluated at the given accuracy tier.
+		   TIER_REDUCED drops the A4 correction to the
+		   Moon's longitude; TIER_COARSE also drops the
+		   annual equation and the variation.  */
+
+double phasetier(tier, pdate, pphase, mage, dist, angdia, sudist, suangdia)
+int tier;
+double pdate;
+double *pphase, *mage, *dist, *angdia, *sudist, *suangdia;
 {
 
 	double Day, N, M, Ec, Lambdasun, ml, MM, MN, Ev, Ae, A3, MmP,
@@ -318,7 +317,7 @@ double *suangdia;                  /* Sun's angular diameter */
 	Ev = 1.2739 * sin(torad(2 * (ml - Lambdasun) - MM));
 
 	/* Annual equation */
-	Ae = 0.1858 * sin(torad(M));
+	Ae = (tier < TIER_COARSE) ? 0.1858 * sin(torad(M)) : 0.0;
 
 	/* Correction term */
 	A3 = 0.37 * sin(torad(M));
@@ -330,13 +329,14 @@ double *suangdia;                  /* Sun's angular diameter */
 	mEc = 6.2886 * sin(torad(MmP));
 
 	/* Another correction term */
-	A4 = 0.214 * sin(torad(2 * MmP));
+	A4 = (tier < TIER_REDUCED) ? 0.214 * sin(torad(2 * MmP)) : 0.0;
 
 	/* Corrected longitude */
 	lP = ml + Ev + mEc - Ae + A4;
 
 	/* Variation */
-	V = 0.6583 * sin(torad(2 * (lP - Lambdasun)));
+	V = (tier < TIER_COARSE) ?
+	    0.6583 * sin(torad(2 * (lP - Lambdasun))) : 0.0;
 
 	/* True longitude */
 	lPP = lP + V;
@@ -388,3 +388,400 @@ double *suangdia;                  /* Sun's angular diameter */
 	return fixangle(MoonAge) / 360.0;
 }
 
+
+/*  AGEBOUND  --  Bound in degrees on the distance between the Moon's
+		  age from PHASEBOUND at a tier and from PHASE.  The
+		  Sun's true anomaly differs by the tail of the series
+		  for the equation of the centre, under 2 e^4, and by
+		  what KEPLER leaves, under EPSILON / (1 - e) in the
+		  eccentric anomaly and some 1.02 times that in the true
+		  anomaly.  A term dropped differs by its amplitude; a
+		  term kept by its amplitude times the error in its
+		  argument, in radians.  */
+
+static double agebound(tier)
+int tier;
+{
+	double ds, dEv, dAe, dMmP, dmEc, dA4, dlP, dV;
+
+	ds = todeg(2 * pow(eccent, 4) +
+		   sqrt((1 + eccent) / (1 - eccent)) * EPSILON / (1 - eccent));
+	dEv = 1.2739 * torad(2 * ds);
+	dAe = (tier < TIER_COARSE) ? 0.0 : 0.1858;
+	dMmP = dEv + dAe;
+	dmEc = 6.2886 * torad(dMmP);
+	dA4 = (tier < TIER_REDUCED) ? 0.214 * torad(2 * dMmP) : 0.214;
+	dlP = dEv + dmEc + dAe + dA4;
+	dV = (tier < TIER_COARSE) ? 0.6583 * torad(2 * (dlP + ds)) : 0.6583;
+	return dlP + dV + ds;
+}
+
+/*  PHASEBOUND  --  Illuminated fraction of the Moon at Julian date
+		    pdate by a truncated model, storing into bound how
+		    far at most it lies from the fraction PHASE gives.
+		    The Sun's true anomaly comes from the series for the
+		    equation of the centre instead of Kepler's equation,
+		    the Moon's latitude, longitude and distance are not
+		    worked out, and the tier drops terms as in PHASETIER.
+		    The bound follows from AGEBOUND by Taylor's theorem,
+		    with room for rounding.  */
+
+double phasebound(tier, pdate, bound)
+int tier;
+double pdate;
+double *bound;
+{
+	static double dage[TIERS];
+	double Day, M, sM, cM, Ec, Lambdasun, ml, MM, Ev, Ae, A3, MmP, mEc,
+	       A4, lP, V, MoonAge, e2, c, d;
+
+	if (dage[tier] == 0)
+		dage[tier] = torad(agebound(tier));
+
+	Day = pdate - epoch;
+	M = torad(fixangle(fixangle((360 / 365.2422) * Day) + elonge - elongp));
+	sM = sin(M);		   /* Multiples of M from its sine and cosine */
+	cM = cos(M);
+	e2 = eccent * eccent;
+	Ec = M + 2 * eccent * sM + 2.5 * e2 * sM * cM +
+	     e2 * eccent * sM * ((13.0 / 12.0) * (3 - 4 * sM * sM) - 0.25);
+	Lambdasun = fixangle(todeg(Ec) + elongp);
+
+	ml = fixangle(13.1763966 * Day + mmlong);
+	MM = fixangle(ml - 0.1114041 * Day - mmlongp);
+	Ev = 1.2739 * sin(torad(2 * (ml - Lambdasun) - MM));
+	Ae = (tier < TIER_COARSE) ? 0.1858 * sM : 0.0;
+	A3 = 0.37 * sM;
+	MmP = MM + Ev - Ae - A3;
+	mEc = 6.2886 * sin(torad(MmP));
+	A4 = (tier < TIER_REDUCED) ? 0.214 * sin(torad(2 * MmP)) : 0.0;
+	lP = ml + Ev + mEc - Ae + A4;
+	V = (tier < TIER_COARSE) ? 0.6583 * sin(torad(2 * (lP - Lambdasun))) : 0.0;
+
+	MoonAge = torad(lP + V - Lambdasun);
+	c = cos(MoonAge);
+	d = dage[tier];
+	/* |sin| from the cosine, which can be short by 1e-8 near a turn */
+	*bound = ((sqrt(1 - c * c) + 1e-8) * d + d * d / 2) / 2 + 1e-12;
+	return (1 - c) / 2;
+}
+
+/*  PHASEGLYPHS  --  The watch glyph code, myround(cphase * 14) * 2
+		     plus 1 when waxing, of count days from Julian date
+		     first, exactly as PHASE gives them: PHASEBOUND at the
+		     tier decides each day unless its bound leaves the
+		     phase bucket or the turn between waxing and waning
+		     in doubt, and PHASE is evaluated then.  Returns the
+		     number of evaluations of PHASE it took.  */
+
+long phaseglyphs(tier, first, count, codes)
+int tier;
+double first;
+long count;
+unsigned char *codes;
+{
+	double c, b, lastc, lastb, aom, cdist, cangdia, csund, csuang;
+	long i, exact = 0;
+
+	lastc = phasebound(tier, first - 1, &lastb);
+	for (i = 0; i < count; i++) {
+		c = phasebound(tier, first + i, &b);
+		if (myround((c - b) * 14) != myround((c + b) * 14)) {
+			phase(first + i, &c, &aom, &cdist, &cangdia, &csund, &csuang);
+			b = 0;
+			exact++;
+		}
+		if (c - b <= lastc + lastb && c + b >= lastc - lastb) {
+			/* The two days' intervals meet: compare exact values */
+			if (lastb != 0) {
+				phase(first + i - 1, &lastc, &aom, &cdist, &cangdia, &csund, &csuang);
+				lastb = 0;
+				exact++;
+			}
+			if (b != 0) {
+				phase(first + i, &c, &aom, &cdist, &cangdia, &csund, &csuang);
+				b = 0;
+				exact++;
+			}
+		}
+		codes[i] = myround(c * 14) * 2 + (lastc < c);
+		lastc = c;
+		lastb = b;
+	}
+	return exact;
+}
+
+/*  MOONDIST  --  Distance of the Moon from the centre of the Earth in
+		  kilometres at Julian date pdate, as PHASE works it out
+		  at the full tier, storing into anomaly the angle that
+		  sets it, the corrected anomaly plus the equation of the
+		  centre.  Only the terms the distance needs are
+		  evaluated.  */
+
+double moondist(pdate, anomaly)
+double pdate;
+double *anomaly;
+{
+	double Day, N, M, Ec, Lambdasun, ml, MM, Ev, Ae, A3, MmP, mEc;
+
+	Day = pdate - epoch;
+	N = fixangle((360 / 365.2422) * Day);
+	M = fixangle(N + elonge - elongp);
+	Ec = kepler(M, eccent);
+	Ec = sqrt((1 + eccent) / (1 - eccent)) * tan(Ec / 2);
+	Ec = 2 * todeg(atan(Ec));
+	Lambdasun = fixangle(Ec + elongp);
+
+	ml = fixangle(13.1763966 * Day + mmlong);
+	MM = fixangle(ml - 0.1114041 * Day - mmlongp);
+	Ev = 1.2739 * sin(torad(2 * (ml - Lambdasun) - MM));
+	Ae = 0.1858 * sin(torad(M));
+	A3 = 0.37 * sin(torad(M));
+	MmP = MM + Ev - Ae - A3;
+	mEc = 6.2886 * sin(torad(MmP));
+
+	*anomaly = fixangle(MmP + mEc);
+	return (msmax * (1 - mecc * mecc)) /
+	   (1 + mecc * cos(torad(MmP + mEc)));
+}
+
+/*  APSISOFFSET  --  How far the anomaly of MOONDIST is past target at
+		     Julian date t, in degrees from -180 to 180.  */
+
+static long apsisevals;
+
+static double apsisoffset(t, target)
+double t, target;
+{
+	double anomaly;
+
+	moondist(t, &anomaly);
+	apsisevals++;
+	return anomaly - target - 360.0 * floor((anomaly - target + 180.0) / 360.0);
+}
+
+/*  APSISROOT  --  Brent's method for the instant in [a, b], where the
+		   offset changes sign, that the anomaly reaches target,
+		   to within tol days.  */
+
+static double apsisroot(target, a, b, tol)
+double target, a, b, tol;
+{
+	double fa = apsisoffset(a, target), fb = apsisoffset(b, target),
+	       c = a, fc = fa, d = b - a, e = d, p, q, r, s, m, t;
+
+	while (TRUE) {
+		if ((fb > 0) == (fc > 0)) {
+			c = a;
+			fc = fa;
+			d = e = b - a;
+		}
+		if (abs(fc) < abs(fb)) {
+			a = b; b = c; c = a;
+			fa = fb; fb = fc; fc = fa;
+		}
+		t = 2 * 1e-15 * abs(b) + tol / 2;
+		m = (c - b) / 2;
+		if (abs(m) <= t || fb == 0)
+			return b;
+		if (abs(e) >= t && abs(fa) > abs(fb)) {
+			/* Secant or inverse quadratic interpolation */
+			s = fb / fa;
+			if (a == c) {
+				p = 2 * m * s;
+				q = 1 - s;
+			} else {
+				q = fa / fc;
+				r = fb / fc;
+				p = s * (2 * m * q * (q - r) - (b - a) * (r - 1));
+				q = (q - 1) * (r - 1) * (s - 1);
+			}
+			if (p > 0)
+				q = -q;
+			else
+				p = -p;
+			if (2 * p < 3 * m * q - abs(t * q) && p < abs(e * q / 2)) {
+				e = d;
+				d = p / q;
+			} else {
+				d = m;
+				e = m;
+			}
+		} else {
+			/* Bisection */
+			d = m;
+			e = m;
+		}
+		a = b;
+		fa = fb;
+		b += (abs(d) > t) ? d : (m > 0 ? t : -t);
+		fb = apsisoffset(b, target);
+	}
+}
+
+/*  APSIDES  --  Perigees and apogees of the Moon from Julian date first
+		 up to last.  The mean anomaly gives each one to within
+		 a day; a bracket of two days either side holds it, and
+		 Brent's method on the anomaly of MOONDIST finds it to a
+		 second.  Stores the instants, distances and kinds (0
+		 for perigee, 1 for apogee) of up to max of them and
+		 returns how many there are; evals, if not NULL, gets
+		 the number of distance evaluations.  */
+
+#define MMRATE 13.0649929	   /* Mean anomaly, degrees a day */
+
+long apsides(first, last, times, dists, kinds, max, evals)
+double first, last;
+double *times, *dists;
+int *kinds;
+long max, *evals;
+{
+	double MM, t, target, est, anomaly;
+	long n = 0;
+	int kind;
+
+	apsisevals = 0;
+	MM = fixangle((13.1763966 - 0.1114041) * (first - epoch) + mmlong - mmlongp);
+	kind = MM >= 180.0 ? 0 : 1;
+	est = first + (kind * 180.0 + (kind ? 0.0 : 360.0) - MM) / MMRATE;
+	for (; est - 2 < last; est += 180.0 / MMRATE, kind ^= 1) {
+		target = kind * 180.0;
+		t = apsisroot(target, est - 2, est + 2, 1e-5);
+		if (t < first || t >= last)
+			continue;
+		if (n < max) {
+			times[n] = t;
+			dists[n] = moondist(t, &anomaly);
+			kinds[n] = kind;
+		}
+		n++;
+	}
+	if (evals)
+		*evals = apsisevals;
+	return n;
+}
+
+/*  MOONLATITUDE  --  Ecliptic latitude of the Moon in degrees at Julian
+		      date pdate, from the terms of PHASE at the full
+		      tier that the Moon's true longitude and the node
+		      need.  */
+
+double moonlatitude(pdate)
+double pdate;
+{
+	double Day, N, M, Ec, Lambdasun, ml, MM, MN, Ev, Ae, A3, MmP, mEc,
+	       A4, lP, V, lPP, NP;
+
+	Day = pdate - epoch;
+	N = fixangle((360 / 365.2422) * Day);
+	M = fixangle(N + elonge - elongp);
+	Ec = kepler(M, eccent);
+	Ec = sqrt((1 + eccent) / (1 - eccent)) * tan(Ec / 2);
+	Ec = 2 * todeg(atan(Ec));
+	Lambdasun = fixangle(Ec + elongp);
+
+	ml = fixangle(13.1763966 * Day + mmlong);
+	MM = fixangle(ml - 0.1114041 * Day - mmlongp);
+	MN = fixangle(mlnode - 0.0529539 * Day);
+	Ev = 1.2739 * sin(torad(2 * (ml - Lambdasun) - MM));
+	Ae = 0.1858 * sin(torad(M));
+	A3 = 0.37 * sin(torad(M));
+	MmP = MM + Ev - Ae - A3;
+	mEc = 6.2886 * sin(torad(MmP));
+	A4 = 0.214 * sin(torad(2 * MmP));
+	lP = ml + Ev + mEc - Ae + A4;
+	V = 0.6583 * sin(torad(2 * (lP - Lambdasun)));
+	lPP = lP + V;
+	NP = MN - 0.16 * sin(torad(M));
+
+	return todeg(asin(sin(torad(lPP - NP)) * sin(torad(minc))));
+}
+
+/*  ECLIPSES  --  Eclipses from Julian date first up to last.  For each
+		  new and full moon, the mean Sun's longitude at the
+		  mean syzygy, less the mean node, is within a few
+		  degrees of the Moon's argument of latitude at the true
+		  one: the Sun's equation of the centre, under 1.92
+		  degrees, the Sun's motion while the true syzygy is
+		  away from the mean, under 0.6, and the node's
+		  correction, 0.16.  A Moon further than ECLMARGIN past
+		  the widest eclipse limit from a node is rejected
+		  there; for the rest TRUEPHASE gives the syzygy and
+		  PHASE the sizes and distances, and the Moon's latitude
+		  is held against the limits for them.  With prune zero
+		  every syzygy is worked out in full.  Stores the
+		  instants and kinds of up to max eclipses and returns
+		  how many there are; checked and rejected, if not
+		  NULL, get the syzygies looked at and those the first
+		  test turned away.  */
+
+#define ECLLIMIT  1.7		   /* Widest eclipse limit in latitude,
+				      degrees */
+#define ECLMARGIN 4.0		   /* Mean to true argument of latitude,
+				      degrees */
+
+long eclipses(first, last, prune, times, kinds, max, checked, rejected)
+double first, last;
+int prune;
+double *times;
+int *kinds;
+long max, *checked, *rejected;
+{
+	double k, ph, mean, Day, F, window, t, beta, cphase, aom, cdist,
+	       cangdia, csund, csuang, mpar, spar, sm, ss;
+	long n = 0, nchecked = 0, nrejected = 0;
+	int kind;
+
+	window = todeg(asin(sin(torad(ECLLIMIT)) / sin(torad(minc)))) + ECLMARGIN;
+	for (k = floor((first - 2415020.75933) / synmonth) - 1; ; k++) {
+		for (ph = 0.0; ph < 1.0; ph += 0.5) {
+			mean = 2415020.75933 + synmonth * (k + ph);
+			if (mean - 1 >= last)
+				goto done;
+			if (mean + 1 < first)
+				continue;
+			nchecked++;
+			if (prune) {
+				Day = mean - epoch;
+				F = fixangle((360 / 365.2422) * Day + elonge +
+					     ph * 360.0 - (mlnode - 0.0529539 * Day));
+				F = fmod(F, 180.0);
+				if (F > window && F < 180.0 - window) {
+					nrejected++;
+					continue;
+				}
+			}
+			t = truephase(k, ph);
+			if (t < first || t >= last)
+				continue;
+			beta = abs(moonlatitude(t));
+			phase(t, &cphase, &aom, &cdist, &cangdia, &csund, &csuang);
+			mpar = mparallax * msmax / cdist;
+			spar = todeg(asin(earthrad / csund));
+			sm = cangdia / 2;
+			ss = csuang / 2;
+			if (ph == 0.0)
+				kind = (beta < mpar - spar + sm + ss) ?
+				    ECLIPSE_SOLAR : -1;
+			else if (beta < 1.02 * (mpar + spar - ss) + sm)
+				kind = ECLIPSE_UMBRAL;
+			else if (beta < 1.02 * (mpar + spar + ss) + sm)
+				kind = ECLIPSE_PENUMBRAL;
+			else
+				kind = -1;
+			if (kind < 0)
+				continue;
+			if (n < max) {
+				times[n] = t;
+				kinds[n] = kind;
+			}
+			n++;
+		}
+	}
+done:
+	if (checked)
+		*checked = nchecked;
+	if (rejected)
+		*rejected = nrejected;
+	return n;
+}
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <time.h>
 #include <math.h>
+#include "calendar.h"
 
 /*  Astronomical constants  */
 
@@ -57,6 +58,25 @@
 #define dsin(x) (sin(torad((x))))			  /* Sin from deg */
 #define dcos(x) (cos(torad((x))))			  /* Cos from deg */
 
+/*  Accuracy tiers for phase() and truephase().  Lower tiers drop the
+    smallest periodic terms; MOONLIB_TIER selects the tier used by the
+    plain entry points and defaults to the full model.  */
+
+#define TIER_FULL	0	   /* Every term in Walker's model */
+#define TIER_REDUCED	1	   /* No 0.0003-0.0006 day phase terms, no A4 */
+#define TIER_COARSE	2	   /* Also no annual equation or variation */
+#define TIERS		3
+
+#ifndef MOONLIB_TIER
+#define MOONLIB_TIER TIER_FULL
+#endif
+
+/*  Kinds of eclipse from eclipses().  */
+
+#define ECLIPSE_SOLAR	  0	   /* Partial at least, somewhere */
+#define ECLIPSE_PENUMBRAL 1	   /* Lunar, penumbral only */
+#define ECLIPSE_UMBRAL	  2	   /* Lunar, partial or total */
+
 int myround(double number);
 long jdate(struct tm *t);
 double jtime(struct tm *t);
@@ -64,7 +84,21 @@ void jyear(double td, int *yy, int *mm, int *dd);
 void jhms(double j, int *h, int *m, int *s);
 double meanphase(double sdate, double phase, double *usek);
 double truephase(double k, double phase);
+double truephasetier(int tier, double k, double phase);
 void phasehunt(double sdate, double phases[5]);
 double kepler(double m, double ecc);
 double phase(double pdate, double *pphase, double *mage, double *dist, double *angdia, double *sudist, double *suangdia);
+double phasetier(int tier, double pdate, double *pphase, double *mage, double *dist, double *angdia, double *sudist, double *suangdia);
+double phasebound(int tier, double pdate, double *bound);
+long phaseglyphs(int tier, double first, long count, unsigned char *codes);
+double moondist(double pdate, double *anomaly);
+long apsides(double first, double last, double *times, double *dists, int *kinds, long max, long *evals);
+double moonlatitude(double pdate);
+long eclipses(double first, double last, int prune, double *times, int *kinds, long max, long *checked, long *rejected);
+
+/*  Lunar series engine (meeus.c)  */
+
+double deltat(double jd);
+double meeustruephase(double k, double phase);
+double meeusphase(double pdate, double *pphase, double *mage, double *dist, double *angdia, double *sudist, double *suangdia);
 
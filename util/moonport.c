@@ -0,0 +1,91 @@
+#include <string.h>
+#include "moonlib.h"
+#include "moonmath.h"
+#include "timing.h"
+
+/*  Check the watch port of phase() in worker_src/c/moonmath.c, which
+    has its own sine, cosine and arc tangent, against phase() here:
+    the illuminated fraction at noon UT of every day in a range of
+    years, and the glyph the worker picks from it, phase bucket and
+    waxing or waning as moontool works them out.  Then time a
+    pass over the days through each.
+
+    Usage: moonport [-y first last]
+           moonport -g jdn days
+
+    With -g, print the moon font character phase() gives for each of
+    the days from Julian day number jdn on instead, for comparing the
+    phone side in src/pkjs/moon.js.  */
+
+/*  GLYPH  --  Bucket and waxing flag of a day in one number.  */
+
+static int glyph(double cphase, double lastcphase)
+{
+  return myround(cphase * 14) * 2 + (lastcphase < cphase);
+}
+
+/*  GLYPHS  --  Print the moon font characters for count days.  */
+
+static void glyphs(long first, long count)
+{
+  static const char waxing[] = "0ABCDEFGHIJKLM1", waning[] = "0ZYXWVUTSRQPON1";
+  double cphase, lastc, aom, cdist, cangdia, csund, csuang;
+  long jd;
+
+  phase(first - 1, &lastc, &aom, &cdist, &cangdia, &csund, &csuang);
+  for (jd = first; jd < first + count; jd++) {
+    phase(jd, &cphase, &aom, &cdist, &cangdia, &csund, &csuang);
+    putchar((lastc < cphase ? waxing : waning)[myround(cphase * 14)]);
+    lastc = cphase;
+  }
+  putchar('\n');
+}
+
+int main(int argc, char *argv[])
+{
+  long first = 1000, last = 3000, jd, j0, j1, errors = 0;
+  double cphase, lastc, wphase, lastw, maxdiff = 0, aom, cdist, cangdia, csund, csuang, start, tlib, tport;
+  volatile double sink = 0;
+
+  if (argc == 4 && !strcmp(argv[1], "-g")) {
+    glyphs(atol(argv[2]), atol(argv[3]));
+    return 0;
+  } else if (argc == 4 && !strcmp(argv[1], "-y")) {
+    first = atol(argv[2]);
+    last = atol(argv[3]);
+  } else if (argc != 1) {
+    fprintf(stderr, "Usage: %s [-y first last] | -g jdn days\n", argv[0]);
+    return 2;
+  }
+  j0 = jdn_from_civil(first, 1, 1);
+  j1 = jdn_from_civil(last + 1, 1, 1);
+
+  phase(j0 - 1, &lastc, &aom, &cdist, &cangdia, &csund, &csuang);
+  lastw = moon_illumination(j0 - 1);
+  for (jd = j0; jd < j1; jd++) {
+    phase(jd, &cphase, &aom, &cdist, &cangdia, &csund, &csuang);
+    wphase = moon_illumination(jd);
+    if (fabs(wphase - cphase) > maxdiff)
+      maxdiff = fabs(wphase - cphase);
+    if (glyph(cphase, lastc) != glyph(wphase, lastw)) {
+      if (errors++ < 10)
+        fprintf(stderr, "moonport: JD %ld glyph differs: %.15f vs %.15f\n", jd, cphase, wphase);
+    }
+    lastc = cphase;
+    lastw = wphase;
+  }
+
+  start = nanotime();
+  for (jd = j0; jd < j1; jd++)
+    sink += phase(jd, &cphase, &aom, &cdist, &cangdia, &csund, &csuang) + cphase;
+  tlib = (nanotime() - start) / (j1 - j0);
+  start = nanotime();
+  for (jd = j0; jd < j1; jd++)
+    sink += moon_illumination(jd);
+  tport = (nanotime() - start) / (j1 - j0);
+
+  printf("Watch port over %ld-%ld: %ld days, %ld glyph mismatches, max illumination difference %.3g\n",
+         first, last, j1 - j0, errors, maxdiff);
+  printf("phase()            %8.1f ns/day\nmoon_illumination()%8.1f ns/day\n", tlib, tport);
+  return errors != 0;
+}
@@ -0,0 +1,248 @@
+#include <string.h>
+#include <stdint.h>
+#include "moonlib.h"
+#include "timing.h"
+
+/*  Export the illuminated fraction and age of the Moon for every minute
+    of a range of years, from phase() at a few nodes instead of every
+    minute.  Between nodes the Moon's age in cycles, which phase()
+    returns, is interpolated linearly, and the two values are worked out
+    from it as phase() does.
+
+    An interval of the coarse grid is cut in two at its middle until the
+    interpolation is good enough.  The middle sample gives the second
+    derivative of the age at some point of the interval, from how far it
+    lies off the chord; no point is further from that than the interval
+    times AGE3, a bound on the third derivative.  Linear interpolation
+    over each half then errs by no more than the half squared over 8
+    times that, which must be under the tolerance.  The age's curvature
+    comes and goes with the Moon's anomaly, so the nodes bunch up where
+    the Moon is gaining or losing speed fastest and thin out at perigee
+    and apogee.
+
+    AGE3 is the sum, over the periodic terms of the Moon's age in
+    Walker's model, of each amplitude times the fastest rate of its
+    argument cubed: 0.079 degrees a day cubed for the equation of the
+    centre, 0.078 for the variation, 0.022 for A4 and 0.010 for the
+    evection, with a quarter again for their arguments not moving
+    evenly.  The illuminated fraction, (1 - cos(2 pi u)) / 2 of an age
+    of u cycles, moves by no more than pi times u; the age in days by
+    synmonth times u.
+
+    phase() solves Kepler's equation for the Sun with kepler(), which
+    stops once a Newton step moves it by EPSILON, 1e-6 radians, or less,
+    but keeps that step: the eccentric anomaly is left off by no more
+    than e / (2 (1 - e)) times (EPSILON / (1 - e)) squared, 9e-15
+    radians, and a few roundings of an angle under 2 pi.  Through the
+    true anomaly and the terms of the Moon that follow the Sun that is
+    under KEPLER in the age, wherever the count of steps changes.  Each
+    node and each minute it is checked against may be off by that much,
+    so twice KEPLER is kept out of the tolerance and both bounds, and
+    the middle sample's error, over the halves' product, is added to
+    the curvature four times over.
+
+    Between nodes the cosine is turned on a minute at a time rather
+    than called for.
+
+    The output is columnar, in blocks of a day so that it can be
+    written as it is made, all in the byte order of the host, after a
+    32 byte header:
+
+	char magic[8]		"MOONSER1"
+	double first		Julian date of the first minute
+	uint32_t step		seconds between rows, 60
+	uint32_t block		rows in a block, 1440; the last may be short
+	uint64_t rows
+	then per block:
+	float illumination[n]	illuminated fraction, 0 to 1
+	float age[n]		age in days, 0 to synmonth
+
+    Usage: moonseries [-y first last] [-e tolerance] [-o file] [-n]
+
+    The tolerance is on the illuminated fraction.  Unless -n is given
+    every minute is also worked out with phase() and compared; the
+    exit status is non-zero if an error is over the bound.  */
+
+#define FIRST_YEAR 2020
+#define LAST_YEAR  2029
+#define TOLERANCE  1e-6
+#define COARSE     360		   /* Minutes between coarse nodes */
+#define BLOCK      1440		   /* Rows in a block */
+#define AGE3       (0.25 / 360)	   /* Age's third derivative, cycles a day cubed */
+#define DAY        1440.0	   /* Minutes a day */
+#define KEPLER     1e-14	   /* kepler()'s error in the age, cycles */
+
+static double first, tolerance;
+static long calls;
+static float illum[BLOCK], age[BLOCK];
+
+/*  SAMPLE  --  The age in cycles at a minute from phase(), taken whole
+		cycles from near.  */
+
+static double sample(long minute, double near)
+{
+  double p, cphase, aom, cdist, cangdia, csund, csuang;
+
+  p = phase(first + minute / DAY, &cphase, &aom, &cdist, &cangdia, &csund, &csuang);
+  calls++;
+  return p + floor(near - p + 0.5);
+}
+
+/*  FILL  --  The minutes from a up to b along a straight line of age,
+	      the cosine turned on by a rotation a minute.  */
+
+static void fill(long a, long b, double ua, double ub)
+{
+  double du = (ub - ua) / (b - a), c = cos(2 * PI * ua), s = sin(2 * PI * ua), cd = cos(2 * PI * du),
+         sd = sin(2 * PI * du), t, u;
+  long i;
+
+  for (i = a; i < b; i++) {
+    u = ua + du * (i - a);
+    illum[i % BLOCK] = (1 - c) / 2;
+    age[i % BLOCK] = synmonth * (u - floor(u));
+    t = c * cd - s * sd;
+    s = s * cd + c * sd;
+    c = t;
+  }
+}
+
+/*  REFINE  --  Fill the minutes from a up to b, with the ages at both
+		ends known.  */
+
+static void refine(long a, long b, double ua, double ub)
+{
+  long m = (a + b) / 2;
+  double um, curvature, half, span;
+
+  if (b - a < 2) {
+    fill(a, b, ua, ub);
+    return;
+  }
+  um = sample(m, ua);
+  span = (m - a) / DAY * ((b - m) / DAY);
+  curvature = (2 * fabs(um - ua - (ub - ua) * (m - a) / (b - a)) + 4 * KEPLER) / span + (b - a) / DAY * AGE3;
+  half = (b - m) / DAY;
+  if (half * half / 8 * curvature > tolerance) {
+    refine(a, m, ua, um);
+    refine(m, b, um, ub);
+    return;
+  }
+  fill(a, m, ua, um);
+  fill(m, b, um, ub);
+}
+
+static void header(FILE *f, uint64_t rows)
+{
+  uint32_t step = 60, block = BLOCK;
+
+  fwrite("MOONSER1", 1, 8, f);
+  fwrite(&first, sizeof(first), 1, f);
+  fwrite(&step, sizeof(step), 1, f);
+  fwrite(&block, sizeof(block), 1, f);
+  fwrite(&rows, sizeof(rows), 1, f);
+}
+
+int main(int argc, char *argv[])
+{
+  int firstyear = FIRST_YEAR, lastyear = LAST_YEAR, dense = 1, i;
+  long rows, base, n, a, b, minute, dcalls = 0;
+  double tol = TOLERANCE, ua, ub, start, tadapt = 0, tdense = 0, cphase, aom, cdist, cangdia, csund, csuang,
+         e, maxillum = 0, maxage = 0, boundillum, boundage;
+  static double dillum[BLOCK], dage[BLOCK];
+  const char *output = NULL;
+  FILE *f = NULL;
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-y") && i + 2 < argc) {
+      firstyear = atoi(argv[++i]);
+      lastyear = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-e") && i + 1 < argc)
+      tol = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+      output = argv[++i];
+    else if (!strcmp(argv[i], "-n"))
+      dense = 0;
+    else {
+      fprintf(stderr, "Usage: %s [-y first last] [-e tolerance] [-o file] [-n]\n", argv[0]);
+      return 2;
+    }
+  }
+  first = jdn_from_civil(firstyear, 1, 1) - 0.5;
+  rows = (jdn_from_civil(lastyear + 1, 1, 1) - 0.5 - first) * BLOCK;
+  tolerance = tol / PI - 2 * KEPLER;
+  if (rows <= 0 || tolerance <= 0) {
+    fprintf(stderr, "%s: bad year range or tolerance\n", argv[0]);
+    return 2;
+  }
+  if (output && !(f = fopen(output, "wb"))) {
+    fprintf(stderr, "%s: cannot write %s\n", argv[0], output);
+    return 1;
+  }
+  if (f)
+    header(f, rows);
+
+  /*  Half a float's spacing is added to each bound for the rounding of
+      the values written.  */
+
+  boundillum = PI * (tolerance + 2 * KEPLER) + ldexp(1, -25) + 1e-12;
+  boundage = synmonth * (tolerance + 2 * KEPLER) + ldexp(1, -20) + 1e-12;
+
+  ub = sample(0, 0);
+  for (base = 0; base < rows; base += BLOCK) {
+    n = rows - base < BLOCK ? rows - base : BLOCK;
+    start = nanotime();
+    for (a = base; a < base + n; a = b) {
+      b = a + COARSE < base + n ? a + COARSE : base + n;
+      ua = ub;
+      ub = sample(b, ua);
+      refine(a, b, ua, ub);
+    }
+    tadapt += nanotime() - start;
+
+    if (dense) {
+      start = nanotime();
+      for (minute = base; minute < base + n; minute++) {
+        phase(first + minute / DAY, &cphase, &aom, &cdist, &cangdia, &csund, &csuang);
+        dillum[minute - base] = cphase;
+        dage[minute - base] = aom;
+      }
+      tdense += nanotime() - start;
+      dcalls += n;
+      for (minute = 0; minute < n; minute++) {
+        e = fabs(illum[minute] - dillum[minute]);
+        if (e > maxillum)
+          maxillum = e;
+        e = fabs(age[minute] - dage[minute]);
+        if (e > synmonth / 2)
+          e = synmonth - e;
+        if (e > maxage)
+          maxage = e;
+      }
+    }
+
+    if (f && (fwrite(illum, sizeof(float), n, f) != (size_t) n || fwrite(age, sizeof(float), n, f) != (size_t) n)) {
+      fprintf(stderr, "%s: cannot write %s\n", argv[0], output);
+      return 1;
+    }
+  }
+  if (f && fclose(f)) {
+    fprintf(stderr, "%s: cannot write %s\n", argv[0], output);
+    return 1;
+  }
+
+  printf("Minute series over %d-%d: %ld rows, tolerance %g\n\n", firstyear, lastyear, rows, tol);
+  printf("%-10s %12s %12s %10s\n", "method", "phase()", "per node", "ms");
+  printf("%-10s %12ld %12.1f %10.1f\n", "adaptive", calls, (double) rows / calls, tadapt / 1e6);
+  if (!dense)
+    return 0;
+  printf("%-10s %12ld %12.1f %10.1f\n", "dense", dcalls, 1.0, tdense / 1e6);
+  printf("\nspeedup %.1fx\n", tdense / tadapt);
+  printf("illuminated fraction: max error %.3g, bound %.3g\n", maxillum, boundillum);
+  printf("age: max error %.3g days, bound %.3g\n", maxage, boundage);
+  if (maxillum > boundillum || maxage > boundage) {
+    fprintf(stderr, "moonseries: error over the bound\n");
+    return 1;
+  }
+  return 0;
+}
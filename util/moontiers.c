@@ -0,0 +1,105 @@
+#include "moonlib.h"
+#include "timing.h"
+
+/*  Compare the accuracy tiers of phase() and truephase() against the
+    full model over 1900-2100, and report which tiers still reproduce
+    the watch's phase table.  */
+
+#define FIRST_JD 2415021L        /* 1 January 1900 */
+#define LAST_JD  2488070L        /* 1 January 2101 */
+#define FIRST_K  0               /* First new moon of 1900 */
+#define LAST_K   2474            /* Last new moon of 2100 */
+#define DAYS     (LAST_JD - FIRST_JD)
+#define PASSES   3
+
+static char *tiername[TIERS] = {"full", "reduced", "coarse"};
+
+static double illum[TIERS][DAYS], age[TIERS][DAYS];
+static unsigned char glyph[TIERS][DAYS];
+static double events[TIERS][(LAST_K - FIRST_K + 1) * 4];
+
+/*  Time one sweep of phasetier() over every day in the range, keeping
+    the best of PASSES runs, and record the watch glyph for each day.  */
+
+static double sweepphase(int tier)
+{
+  long jd, i;
+  int pass;
+  double best = 0, start, elapsed, p, last, aom, cdist, cangdia, csund, csuang;
+
+  for (pass = 0; pass < PASSES; pass++) {
+    start = nanotime();
+    for (jd = FIRST_JD, i = 0; jd < LAST_JD; jd++, i++)
+      p = phasetier(tier, jd, &illum[tier][i], &age[tier][i], &cdist, &cangdia, &csund, &csuang);
+    elapsed = nanotime() - start;
+    if (pass == 0 || elapsed < best)
+      best = elapsed;
+  }
+  p = phasetier(tier, FIRST_JD - 1, &last, &aom, &cdist, &cangdia, &csund, &csuang);
+  for (i = 0; i < DAYS; i++) {
+    glyph[tier][i] = myround(illum[tier][i] * 14) * 2 + (last < illum[tier][i]);
+    last = illum[tier][i];
+  }
+  return best / DAYS;
+}
+
+/*  Same for truephasetier() over every principal phase in the range.  */
+
+static double sweeptruephase(int tier)
+{
+  int k, q, pass;
+  long i;
+  double best = 0, start, elapsed;
+
+  for (pass = 0; pass < PASSES; pass++) {
+    start = nanotime();
+    for (k = FIRST_K, i = 0; k <= LAST_K; k++)
+      for (q = 0; q < 4; q++)
+        events[tier][i++] = truephasetier(tier, k, q * 0.25);
+    elapsed = nanotime() - start;
+    if (pass == 0 || elapsed < best)
+      best = elapsed;
+  }
+  return best / i;
+}
+
+/*  Main program  */
+
+int main(int argc, char *argv[])
+{
+  int tier, cheapest = TIER_FULL;
+  long i, mismatches, nevents = (LAST_K - FIRST_K + 1) * 4;
+  double nsphase[TIERS], nstrue[TIERS], maxillum, maxage, maxevent;
+
+  for (tier = 0; tier < TIERS; tier++) {
+    nsphase[tier] = sweepphase(tier);
+    nstrue[tier] = sweeptruephase(tier);
+  }
+
+  printf("Accuracy tiers against the full model, 1900-2100 (%ld days, %ld phases)\n\n", DAYS, nevents);
+  printf("%-8s %10s %10s %10s %10s %12s %10s\n", "tier", "ns/phase", "max dillum", "max dage h",
+         "glyph diff", "ns/truephase", "max dt min");
+  for (tier = 0; tier < TIERS; tier++) {
+    maxillum = maxage = maxevent = 0;
+    mismatches = 0;
+    for (i = 0; i < DAYS; i++) {
+      if (abs(illum[tier][i] - illum[TIER_FULL][i]) > maxillum)
+        maxillum = abs(illum[tier][i] - illum[TIER_FULL][i]);
+      if (abs(age[tier][i] - age[TIER_FULL][i]) > maxage
+          && abs(age[tier][i] - age[TIER_FULL][i]) < synmonth / 2)
+        maxage = abs(age[tier][i] - age[TIER_FULL][i]);
+      if (glyph[tier][i] != glyph[TIER_FULL][i])
+        mismatches++;
+    }
+    for (i = 0; i < nevents; i++)
+      if (abs(events[tier][i] - events[TIER_FULL][i]) > maxevent)
+        maxevent = abs(events[tier][i] - events[TIER_FULL][i]);
+    printf("%-8s %10.1f %10.6f %10.3f %10ld %12.1f %10.3f\n", tiername[tier], nsphase[tier],
+           maxillum, maxage * 24, mismatches, nstrue[tier], maxevent * 1440);
+    if (mismatches == 0)
+      cheapest = tier;
+  }
+  printf("\nCheapest tier reproducing the watch table: %s (build with -DMOONLIB_TIER=%d)\n",
+         tiername[cheapest], cheapest);
+  return 0;
+}
@@ -11,6 +11,7 @@ int main(int argc, char *argv[])
   long jmoonepic, jd;
   struct tm *gm;
   int yy, mm, dd;
+  CalendarCursor day;
   static char *moname[] = {"January", "February", "March",
            "April", "May", "June", "July", "August", "September",
            "October", "November", "December"};
@@ -25,11 +26,11 @@ int main(int argc, char *argv[])
   printf( "#define MOONPHASE_ARRAY_SIZE %d\n\n", MOONPHASE_ARRAY_SIZE);
   printf("static uint8_t MoonPhaseDateLookup[%d][2] =\n{\n\t/* {Julian Date-JULIAN_MOON_EPIC = array position, Phase (0-14), Waxing (1 - Yes, 0 - Waning)} */\n", MOONPHASE_ARRAY_SIZE);
   p = phase(jmoonepic-1, &lastcphase, &aom, &cdist, &cangdia, &csund, &csuang);
-  for (jd=jmoonepic; jd<(jmoonepic+MOONPHASE_ARRAY_SIZE); jd++)
+  calendar_cursor_init(&day, jmoonepic);
+  for (jd=jmoonepic; jd<(jmoonepic+MOONPHASE_ARRAY_SIZE); jd++, calendar_cursor_next(&day))
   {
-     jyear(jd, &yy, &mm, &dd);
      p = phase(jd, &cphase, &aom, &cdist, &cangdia, &csund, &csuang);
-     printf( "\t{%d, %d}%c /* %ld - %d %s %d - %d%%  */\n", myround(cphase*14),((lastcphase < cphase) ? 1 : 0),jd==jmoonepic+MOONPHASE_ARRAY_SIZE-1 ? ' ' : ',',jd,dd, moname[mm - 1], yy,(int) (cphase * 100));
+     printf( "\t{%d, %d}%c /* %ld - %d %s %d - %d%%  */\n", myround(cphase*14),((lastcphase < cphase) ? 1 : 0),jd==jmoonepic+MOONPHASE_ARRAY_SIZE-1 ? ' ' : ',',jd,day.date.day, moname[day.date.month - 1], day.date.year,(int) (cphase * 100));
      lastcphase = cphase;
   }
   printf ("};\n");
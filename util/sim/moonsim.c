@@ -0,0 +1,331 @@
+/*
+    Moontiles simulator driver.
+
+    Runs src/c/moontiles.c against the Pebble stub: starts the
+    background worker in worker_src/c and then the app,
+    replays simulated minute ticks through its tick handler, redraws
+    the frame buffer after each tick as the firmware would, and reports
+    calls per tick, redraws, heap use and host time per tick.  Frames at
+    fixed checkpoint times are compared with golden images.
+
+    Usage: moonsim [-s YYYY-MM-DD[THH:MM]] [-d days] [-24] [-g] [-G dir] [-q] [-H] [-c cycles] [-p file]
+		   [-W] [-m file] [-t]
+
+	-s	first simulated minute, UTC (default 2020-02-28T23:58)
+	-d	days of minute ticks to replay (default 366)
+	-24	use the 24-hour clock style
+	-g	write golden images instead of comparing with them
+	-G	golden image directory (default sim/golden)
+	-q	print only the summary line
+	-H	print only a hash of every frame drawn, for comparing builds
+	-c	after the replay, unload and reload the window this many times
+	-p	keep persistent storage in this file between runs; without it
+		every run starts from an empty store
+	-W	run without the background worker, as when another app's
+		worker holds the slot
+	-m	after the first frame, deliver the AppMessages in this file,
+		as written by sim/pkjs.js
+	-t	tap the watch after the replay, which makes a TELEMETRY build
+		log its figures
+
+*/
+
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+#include "sim.h"
+
+#undef time
+#undef localtime
+#undef strftime
+#undef malloc
+#undef calloc
+#undef free
+
+#define DEFAULT_START "2020-02-28T23:58"
+#define DEFAULT_DAYS 366
+
+/*  Golden frames: leap day, a date change, AM to PM and a month change.  */
+
+static const char *checkpoints[] = {
+	"2020-02-28T23:58",
+	"2020-02-29T00:00",
+	"2020-02-29T12:00",
+	"2020-03-01T00:00",
+};
+#define CHECKPOINTS (sizeof(checkpoints) / sizeof(checkpoints[0]))
+
+static long days = DEFAULT_DAYS;
+static const char *golden_dir = "sim/golden";
+static bool write_golden, quiet, hash_only, no_worker, tap;
+static const char *message_file;
+static uint64_t frame_hash = 0xCBF29CE484222325ULL;
+static int golden_checked, golden_failed;
+static double tick_ns, render_ns;
+static double first_frame_ns, full_frame_ns;
+static long first_frame_fonts;
+static long ticks, cycles;
+static SimStats after_load, after_replay, after_cycles;
+
+static double nanotime(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static bool parse_time(const char *text, time_t *t)
+{
+	struct tm tm;
+	int n;
+
+	memset(&tm, 0, sizeof(tm));
+	n = sscanf(text, "%d-%d-%dT%d:%d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday, &tm.tm_hour, &tm.tm_min);
+	if (n != 3 && n != 5)
+		return false;
+	tm.tm_year -= 1900;
+	tm.tm_mon -= 1;
+	*t = timegm(&tm);
+	return true;
+}
+
+/*  Write the frame as a binary PBM (1 = black) or compare it with one.  */
+
+static void checkpoint(void)
+{
+	char path[512], stamp[32];
+	unsigned char row[SIM_WIDTH / 8], golden[SIM_WIDTH / 8];
+	struct tm tm;
+	time_t t;
+	FILE *f;
+	int i, x, y, w, h, diff = 0;
+
+	for (i = 0; i < CHECKPOINTS; i++)
+		if (parse_time(checkpoints[i], &t) && t == sim_now)
+			break;
+	if (i == CHECKPOINTS)
+		return;
+	gmtime_r(&sim_now, &tm);
+	strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M", &tm);
+	snprintf(path, sizeof(path), "%s/%s-%s-%s.pbm", golden_dir, SIM_GOLDEN, sim_24h ? "24h" : "12h", stamp);
+
+	f = fopen(path, write_golden ? "wb" : "rb");
+	if (!f) {
+		fprintf(stderr, "moonsim: cannot open %s\n", path);
+		golden_checked++;
+		golden_failed++;
+		return;
+	}
+	if (write_golden)
+		fprintf(f, "P4\n%d %d\n", SIM_WIDTH, SIM_HEIGHT);
+	else if (fscanf(f, "P4 %d %d", &w, &h) != 2 || w != SIM_WIDTH || h != SIM_HEIGHT || fgetc(f) == EOF)
+		diff = -1;
+	for (y = 0; y < SIM_HEIGHT && diff >= 0; y++) {
+		memset(row, 0, sizeof(row));
+		for (x = 0; x < SIM_WIDTH; x++)
+			if (!sim_pixel_white(x, y))
+				row[x / 8] |= 0x80 >> (x & 7);
+		if (write_golden)
+			fwrite(row, 1, sizeof(row), f);
+		else if (fread(golden, 1, sizeof(golden), f) != sizeof(golden))
+			diff = -1;
+		else
+			for (x = 0; x < SIM_WIDTH; x++)
+				diff += ((row[x / 8] ^ golden[x / 8]) >> (7 - (x & 7))) & 1;
+	}
+	fclose(f);
+	golden_checked++;
+	if (diff) {
+		golden_failed++;
+		if (diff < 0)
+			fprintf(stderr, "moonsim: %s is not a %dx%d PBM\n", path, SIM_WIDTH, SIM_HEIGHT);
+		else
+			fprintf(stderr, "moonsim: %s differs in %d pixels\n", path, diff);
+	}
+}
+
+/*  Fold the frame buffer into the FNV-1a hash of all frames so far.  */
+
+static void hash_frame(void)
+{
+	int i;
+
+	for (i = 0; i < sizeof(sim_framebuffer); i++)
+		frame_hash = (frame_hash ^ sim_framebuffer[i]) * 0x100000001B3ULL;
+}
+
+/*  Called from app_event_loop(): draw the first frame, and again once
+    any timers it set have fired and any phone messages have arrived,
+    then one tick per simulated minute.  */
+
+void sim_replay(void)
+{
+	struct tm last, now;
+	TimeUnits units;
+	double start, mid;
+	long i, minutes = days * 24 * 60;
+
+	sim_render();
+	first_frame_ns = nanotime() - sim_stats.load_start;
+	first_frame_fonts = sim_stats.font_loads;
+	if (sim_run_timers())
+		sim_render();
+	full_frame_ns = nanotime() - sim_stats.load_start;
+	if (message_file) {
+		if (!sim_deliver_messages(message_file))
+			fprintf(stderr, "moonsim: cannot read %s\n", message_file);
+		sim_render();
+	}
+	after_load = sim_stats;
+	hash_frame();
+	checkpoint();
+	gmtime_r(&sim_now, &last);
+	for (i = 0; i < minutes; i++) {
+		sim_now += 60;
+		gmtime_r(&sim_now, &now);
+		units = SECOND_UNIT | MINUTE_UNIT;
+		if (now.tm_hour != last.tm_hour)
+			units |= HOUR_UNIT;
+		if (now.tm_mday != last.tm_mday)
+			units |= DAY_UNIT;
+		if (now.tm_mon != last.tm_mon)
+			units |= MONTH_UNIT;
+		if (now.tm_year != last.tm_year)
+			units |= YEAR_UNIT;
+		last = now;
+
+		start = nanotime();
+		sim_tick(units);
+		mid = nanotime();
+		sim_render();
+		render_ns += nanotime() - mid;
+		hash_frame();
+		tick_ns += mid - start;
+		ticks++;
+		checkpoint();
+	}
+
+	if (tap && !sim_tap())
+		fprintf(stderr, "moonsim: nothing listens for taps\n");
+	after_replay = sim_stats;
+	for (i = 0; i < cycles; i++) {
+		sim_reload();
+		sim_render();
+		if (sim_run_timers())
+			sim_render();
+	}
+	after_cycles = sim_stats;
+}
+
+static void report(void)
+{
+	SimStats s = after_replay, c = after_cycles, e = sim_stats;
+	double n = ticks ? ticks : 1;
+	int i;
+
+	if (hash_only) {
+		printf("%016llx\n", (unsigned long long) frame_hash);
+		return;
+	}
+	if (!quiet) {
+		printf("Platform %s (%s), %s clock, %ld ticks\n\n", SIM_PLATFORM, SIM_NAME, sim_24h ? "24h" : "12h", ticks);
+		printf("Startup (window load and first frame)\n");
+		printf("  api calls %ld, font loads %ld, allocations %ld, heap %ld bytes\n",
+		       after_load.api_calls, after_load.font_loads, after_load.allocs, after_load.heap_bytes);
+		printf("  persist reads %ld, timers %ld, load handler %.0f ns\n",
+		       after_load.persist_reads, after_load.timers, after_load.load_ns);
+		printf("  load to first frame %.0f ns (%ld font loads), to full frame %.0f ns\n\n",
+		       first_frame_ns, first_frame_fonts, full_frame_ns);
+		printf("Per tick\n");
+		printf("  api calls          %8.3f\n", (s.api_calls - after_load.api_calls) / n);
+		printf("  text_layer_set_text%8.3f\n", (s.set_text - after_load.set_text) / n);
+		printf("  layer_mark_dirty   %8.3f\n", (s.mark_dirty - after_load.mark_dirty) / n);
+		printf("  strftime           %8.3f\n", (s.strftime - after_load.strftime) / n);
+		printf("  clock_is_24h_style %8.3f\n", (s.clock_style - after_load.clock_style) / n);
+		printf("  redraws            %8.3f\n", (s.frames - after_load.frames) / n);
+		printf("  update procs       %8.3f\n", (s.update_procs - after_load.update_procs) / n);
+		printf("  fill rects         %8.3f\n", (s.fill_rects - after_load.fill_rects) / n);
+		printf("  draw texts         %8.3f\n", (s.draw_texts - after_load.draw_texts) / n);
+		printf("  draw bitmaps       %8.3f\n", (s.draw_bitmaps - after_load.draw_bitmaps) / n);
+		printf("  handler time ns    %8.1f\n", tick_ns / n);
+		printf("  render time ns     %8.1f\n", render_ns / n);
+		printf("    app layers ns    %8.1f\n", (s.layer_ns - after_load.layer_ns) / n);
+		printf("    text layers ns   %8.1f\n\n", (s.text_ns - after_load.text_ns) / n);
+		printf("text_layer_set_text by layer\n");
+		for (i = 0; i < sim_text_layer_count; i++)
+			printf("  (%3d,%3d %3dx%-3d) %10ld\n", sim_text_layers[i].frame.origin.x,
+			       sim_text_layers[i].frame.origin.y, sim_text_layers[i].frame.size.w,
+			       sim_text_layers[i].frame.size.h, sim_text_layers[i].set_text);
+		printf("\nHeap: %ld allocations, %ld frees, peak %ld bytes, %ld bytes live at exit\n",
+		       e.allocs, e.frees, e.heap_peak, e.heap_bytes);
+		printf("Fonts: %ld loads, %ld unloads\n", e.font_loads, e.font_unloads);
+		printf("Messages: %ld delivered, %ld dropped, %ld dictionary bytes\n",
+		       e.messages, e.messages_dropped, e.message_bytes);
+		printf("Worker: start %.0f ns, %ld day ticks, %.0f ns in all, %ld api calls, %ld messages\n",
+		       e.worker_start_ns, e.worker_ticks, e.worker_ns, e.worker_calls, e.worker_messages);
+		printf("Startup peak heap %ld bytes\n\n", after_load.heap_peak);
+		if (cycles) {
+			printf("After %ld window reloads\n", cycles);
+			printf("  font loads %ld, unloads %ld, allocations %ld, frees %ld\n",
+			       c.font_loads - s.font_loads, c.font_unloads - s.font_unloads,
+			       c.allocs - s.allocs, c.frees - s.frees);
+			printf("  heap live %ld bytes (%+ld), peak %ld bytes\n\n", c.heap_bytes,
+			       c.heap_bytes - s.heap_bytes, c.heap_peak);
+		}
+	}
+	printf("%s %s: %ld ticks, %.3f redraws/tick, %.1f ns/tick, peak heap %ld, golden %d/%d ok\n",
+	       SIM_NAME, sim_24h ? "24h" : "12h", ticks, (s.frames - after_load.frames) / n,
+	       (tick_ns + render_ns) / n, s.heap_peak, golden_checked - golden_failed, golden_checked);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *start = DEFAULT_START, *persist_file = NULL;
+	int i;
+
+	for (i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-s") && i + 1 < argc)
+			start = argv[++i];
+		else if (!strcmp(argv[i], "-d") && i + 1 < argc)
+			days = atol(argv[++i]);
+		else if (!strcmp(argv[i], "-24"))
+			sim_24h = true;
+		else if (!strcmp(argv[i], "-g"))
+			write_golden = true;
+		else if (!strcmp(argv[i], "-G") && i + 1 < argc)
+			golden_dir = argv[++i];
+		else if (!strcmp(argv[i], "-q"))
+			quiet = true;
+		else if (!strcmp(argv[i], "-H"))
+			hash_only = true;
+		else if (!strcmp(argv[i], "-c") && i + 1 < argc)
+			cycles = atol(argv[++i]);
+		else if (!strcmp(argv[i], "-p") && i + 1 < argc)
+			persist_file = argv[++i];
+		else if (!strcmp(argv[i], "-W"))
+			no_worker = true;
+		else if (!strcmp(argv[i], "-m") && i + 1 < argc)
+			message_file = argv[++i];
+		else if (!strcmp(argv[i], "-t"))
+			tap = true;
+		else {
+			fprintf(stderr, "Usage: %s [-s YYYY-MM-DD[THH:MM]] [-d days] [-24] [-g] [-G dir] [-q] [-H] [-c cycles] [-p file] [-W] [-m file] [-t]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (!parse_time(start, &sim_now) || days < 0) {
+		fprintf(stderr, "%s: bad start time or day count\n", argv[0]);
+		return 2;
+	}
+
+	if (persist_file && !sim_persist_load(persist_file))
+		fprintf(stderr, "%s: %s is not a store file, starting empty\n", argv[0], persist_file);
+	sim_run(!no_worker);
+	if (persist_file && !sim_persist_save(persist_file)) {
+		fprintf(stderr, "%s: cannot write %s\n", argv[0], persist_file);
+		return 1;
+	}
+	report();
+	return golden_failed != 0;
+}
@@ -0,0 +1,1376 @@
+/*
+    Host implementation of the Pebble SDK stub.
+
+    Layers form the same tree as on the watch and are drawn into an
+    in-memory frame buffer whenever one of them is dirty; like the
+    firmware, a dirty layer redraws the whole window.  Fonts are drawn
+    with stand-in glyphs (a per-character 5x7 pattern scaled to the font
+    size), so frames are stable for regression checks but do not look
+    like the real typefaces.
+
+*/
+
+#include <stdarg.h>
+#include "sim.h"
+
+#undef time
+#undef localtime
+#undef strftime
+#undef malloc
+#undef calloc
+#undef free
+
+SimStats sim_stats;
+SimTextLayerStats sim_text_layers[SIM_TEXT_LAYERS];
+int sim_text_layer_count;
+time_t sim_now;
+bool sim_24h;
+uint8_t sim_framebuffer[SIM_HEIGHT * SIM_ROW_BYTES];
+
+struct Layer {
+	GRect frame;
+	GRect bounds;
+	LayerUpdateProc update_proc;
+	Layer *parent, *first_child, *next_sibling;
+	TextLayer *text_layer;	   /* Owner, for text layers */
+};
+
+struct TextLayer {
+	Layer layer;
+	const char *text;
+	GFont font;
+	GColor text_color, background_color;
+	GTextAlignment alignment;
+	int index;		   /* Slot in sim_text_layers, or -1 */
+};
+
+struct Window {
+	Layer *root;
+	WindowHandlers handlers;
+	GColor background;
+	bool loaded;
+};
+
+struct FontInfo {
+	uint32_t resource_id;
+	int height;
+};
+
+struct GBitmap {
+	GSize size;		   /* Of the pixel data */
+	GRect bounds;		   /* Part drawn, in pixel data coordinates */
+	GBitmapFormat format;
+	uint16_t row_bytes;
+	uint8_t *data;
+	bool owns_data;
+};
+
+struct GContext {
+	GPoint offset;		   /* Screen position of the layer bounds */
+	GRect clip;		   /* Screen clip rectangle */
+	GColor fill, text;
+	GCompOp op;
+};
+
+static struct {
+	uint32_t id;
+	int height;		   /* Fonts: stand-in glyph height */
+	const char *file;	   /* Raw resources: file under SIM_RESOURCES */
+} resources[] = {
+	{RESOURCE_ID_FONT_MOONPHASE_33, 33},
+	{RESOURCE_ID_FONT_WW_DIGITAL_DATE_SUBSET_22, 22},
+	{RESOURCE_ID_FONT_WW_DIGITAL_DOW_SUBSET_33, 33},
+	{RESOURCE_ID_FONT_WW_DIGITAL_SUBSET_52, 52},
+	{RESOURCE_ID_FONT_WW_DIGITAL_SUBSET_10, 10},
+	{RESOURCE_ID_IMAGE_MENU_ICON, 0},
+	{RESOURCE_ID_GLYPH_ATLAS, 0, "data/glyph_atlas.bin"},
+};
+
+#ifdef PBL_PLATFORM_APLITE
+#define SCREEN_FORMAT GBitmapFormat1Bit
+#else
+#define SCREEN_FORMAT GBitmapFormat8Bit
+#endif
+
+static GBitmap screen = {{SIM_WIDTH, SIM_HEIGHT}, {{0, 0}, {SIM_WIDTH, SIM_HEIGHT}}, SCREEN_FORMAT, SIM_ROW_BYTES, sim_framebuffer};
+static bool captured;
+static Window *top_window;
+static bool dirty;
+static TickHandler tick_handler;
+static TickHandler worker_tick_handler;
+static TimeUnits worker_tick_units;
+
+static double nanotime(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/*  Heap accounting: every allocation carries its size in a header.  */
+
+typedef union {
+	size_t size;
+	max_align_t align;
+} AllocHeader;
+
+void *sim_malloc(size_t size)
+{
+	AllocHeader *h = malloc(sizeof(AllocHeader) + size);
+
+	if (!h)
+		return NULL;
+	h->size = size;
+	sim_stats.allocs++;
+	sim_stats.heap_bytes += size;
+	if (sim_stats.heap_bytes > sim_stats.heap_peak)
+		sim_stats.heap_peak = sim_stats.heap_bytes;
+	return h + 1;
+}
+
+void *sim_calloc(size_t count, size_t size)
+{
+	void *p = sim_malloc(count * size);
+
+	if (p)
+		memset(p, 0, count * size);
+	return p;
+}
+
+void sim_free(void *ptr)
+{
+	AllocHeader *h;
+
+	if (!ptr)
+		return;
+	h = (AllocHeader *) ptr - 1;
+	sim_stats.frees++;
+	sim_stats.heap_bytes -= h->size;
+	free(h);
+}
+
+/*  Frame buffer access  */
+
+static inline void set_pixel(int x, int y, GColor color)
+{
+#ifdef PBL_PLATFORM_APLITE
+	uint8_t bit = 1 << (x & 7);
+	uint8_t *p = &sim_framebuffer[y * SIM_ROW_BYTES + x / 8];
+
+	if (color.argb == GColorWhiteARGB8)
+		*p |= bit;
+	else
+		*p &= ~bit;
+#else
+	sim_framebuffer[y * SIM_ROW_BYTES + x] = color.argb;
+#endif
+}
+
+/*  Fill pixels [x0, x1) of row y, a byte at a time where possible.  */
+
+static void fill_span(int y, int x0, int x1, GColor color)
+{
+#ifdef PBL_PLATFORM_APLITE
+	uint8_t *row = &sim_framebuffer[y * SIM_ROW_BYTES];
+	uint8_t value = color.argb == GColorWhiteARGB8 ? 0xFF : 0x00;
+
+	for (; x0 < x1 && (x0 & 7); x0++)
+		set_pixel(x0, y, color);
+	for (; x1 > x0 && (x1 & 7); x1--)
+		set_pixel(x1 - 1, y, color);
+	if (x1 > x0)
+		memset(row + x0 / 8, value, (x1 - x0) / 8);
+#else
+	if (x1 > x0)
+		memset(&sim_framebuffer[y * SIM_ROW_BYTES + x0], color.argb, x1 - x0);
+#endif
+}
+
+bool sim_pixel_white(int x, int y)
+{
+#ifdef PBL_PLATFORM_APLITE
+	return sim_framebuffer[y * SIM_ROW_BYTES + x / 8] >> (x & 7) & 1;
+#else
+	return sim_framebuffer[y * SIM_ROW_BYTES + x] == GColorWhiteARGB8;
+#endif
+}
+
+/*  Plot a screen pixel through the context's clip rectangle.  */
+
+static inline void plot(GContext *ctx, int x, int y, GColor color)
+{
+	if (color.a == 0)
+		return;
+	if (x < ctx->clip.origin.x || y < ctx->clip.origin.y ||
+	    x >= ctx->clip.origin.x + ctx->clip.size.w || y >= ctx->clip.origin.y + ctx->clip.size.h)
+		return;
+	set_pixel(x, y, color);
+}
+
+static GRect intersect(GRect a, GRect b)
+{
+	int x0 = a.origin.x > b.origin.x ? a.origin.x : b.origin.x;
+	int y0 = a.origin.y > b.origin.y ? a.origin.y : b.origin.y;
+	int x1 = a.origin.x + a.size.w < b.origin.x + b.size.w ? a.origin.x + a.size.w : b.origin.x + b.size.w;
+	int y1 = a.origin.y + a.size.h < b.origin.y + b.size.h ? a.origin.y + a.size.h : b.origin.y + b.size.h;
+
+	return GRect(x0, y0, x1 > x0 ? x1 - x0 : 0, y1 > y0 ? y1 - y0 : 0);
+}
+
+/*  Graphics  */
+
+void graphics_context_set_fill_color(GContext *ctx, GColor color)
+{
+	sim_stats.api_calls++;
+	ctx->fill = color;
+}
+
+void graphics_context_set_text_color(GContext *ctx, GColor color)
+{
+	sim_stats.api_calls++;
+	ctx->text = color;
+}
+
+void graphics_context_set_compositing_mode(GContext *ctx, GCompOp mode)
+{
+	sim_stats.api_calls++;
+	ctx->op = mode;
+}
+
+/*  Columns to skip at each end of row y of a w x h rectangle with
+    rounded corners of radius r.  */
+
+static void corner_inset(int y, int w, int h, int r, GCornerMask mask, int *left, int *right)
+{
+	int dy, dx;
+
+	*left = *right = 0;
+	if (r <= 0 || (y >= r && y < h - r))
+		return;
+	dy = y < r ? r - y : y - (h - r - 1);
+	for (dx = 0; dx * dx + dy * dy <= r * r; dx++)
+		;
+	if ((y < r && (mask & GCornerTopLeft)) || (y >= h - r && (mask & GCornerBottomLeft)))
+		*left = r + 1 - dx;
+	if ((y < r && (mask & GCornerTopRight)) || (y >= h - r && (mask & GCornerBottomRight)))
+		*right = r + 1 - dx;
+}
+
+void graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius, GCornerMask corner_mask)
+{
+	int y, sx, sy, x0, x1, left, right;
+	GRect c = ctx->clip;
+
+	sim_stats.api_calls++;
+	sim_stats.fill_rects++;
+	if (ctx->fill.a == 0)
+		return;
+	for (y = 0; y < rect.size.h; y++) {
+		sy = ctx->offset.y + rect.origin.y + y;
+		if (sy < c.origin.y || sy >= c.origin.y + c.size.h)
+			continue;
+		corner_inset(y, rect.size.w, rect.size.h, corner_radius, corner_mask, &left, &right);
+		sx = ctx->offset.x + rect.origin.x;
+		x0 = sx + left > c.origin.x ? sx + left : c.origin.x;
+		x1 = sx + rect.size.w - right < c.origin.x + c.size.w ? sx + rect.size.w - right : c.origin.x + c.size.w;
+		fill_span(sy, x0, x1, ctx->fill);
+	}
+}
+
+/*  Stand-in glyph: bit (row * 5 + col) of a hash of the character.
+    Text is clipped to its box, as it is to a text layer's frame.  */
+
+static uint64_t glyph_bits(unsigned char c)
+{
+	uint64_t z = c * 0x9E3779B97F4A7C15ULL;
+
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+void graphics_draw_text(GContext *ctx, const char *text, GFont font, GRect box,
+			GTextOverflowMode overflow_mode, GTextAlignment alignment, void *layout)
+{
+	int n, i, x, y, gw, gh, sp, width, x0, y0, rowbits;
+	uint8_t column[64];
+	uint64_t bits;
+	GContext boxed = *ctx;
+
+	sim_stats.api_calls++;
+	sim_stats.draw_texts++;
+	if (!text || !font || !font->height)
+		return;
+	boxed.clip = intersect(ctx->clip, GRect(ctx->offset.x + box.origin.x, ctx->offset.y + box.origin.y,
+						box.size.w, box.size.h));
+	n = strlen(text);
+	gh = font->height;
+	gw = gh * 11 / 20;
+	sp = gh / 11 > 1 ? gh / 11 : 1;
+	width = n * gw + (n > 0 ? (n - 1) * sp : 0);
+	x0 = box.origin.x;
+	if (alignment == GTextAlignmentCenter)
+		x0 += (box.size.w - width) / 2;
+	else if (alignment == GTextAlignmentRight)
+		x0 += box.size.w - width;
+	y0 = box.origin.y;
+	for (x = 0; x < gw && x < sizeof(column); x++)
+		column[x] = x * 5 / gw;
+	for (i = 0; i < n; i++) {
+		if (text[i] == ' ')
+			continue;
+		bits = glyph_bits(text[i]);
+		for (y = 0; y < gh && y0 + y < box.origin.y + box.size.h; y++) {
+			rowbits = bits >> ((y * 7 / gh) * 5) & 31;
+			for (x = 0; x < gw && x < sizeof(column); x++)
+				if (rowbits >> column[x] & 1)
+					plot(&boxed, ctx->offset.x + x0 + i * (gw + sp) + x,
+					     ctx->offset.y + y0 + y, ctx->text);
+		}
+	}
+}
+
+/*  Bitmaps: 1-bit rows are padded to 32 bits, least significant bit
+    leftmost, as on aplite; 8-bit pixels are GColor8.  */
+
+GBitmap *gbitmap_create_blank(GSize size, GBitmapFormat format)
+{
+	GBitmap *bitmap;
+
+	sim_stats.api_calls++;
+	if (format != GBitmapFormat1Bit && format != GBitmapFormat8Bit)
+		return NULL;
+	bitmap = sim_calloc(1, sizeof(GBitmap));
+	bitmap->size = size;
+	bitmap->bounds = GRect(0, 0, size.w, size.h);
+	bitmap->format = format;
+	bitmap->row_bytes = format == GBitmapFormat1Bit ? (size.w + 31) / 32 * 4 : size.w;
+	bitmap->data = sim_calloc(size.h, bitmap->row_bytes);
+	bitmap->owns_data = true;
+	return bitmap;
+}
+
+/*  Data in the SDK's GBitmap resource layout: row size, version and
+    format flags, then the bounds, as little-endian 16-bit fields.  */
+
+GBitmap *gbitmap_create_with_data(const uint8_t *data)
+{
+	GBitmap *bitmap;
+	int flags;
+
+	sim_stats.api_calls++;
+	flags = data[2] | data[3] << 8;
+	if ((flags >> 1 & 7) != GBitmapFormat1Bit && (flags >> 1 & 7) != GBitmapFormat8Bit)
+		return NULL;
+	bitmap = sim_calloc(1, sizeof(GBitmap));
+	bitmap->row_bytes = data[0] | data[1] << 8;
+	bitmap->format = flags >> 1 & 7;
+	bitmap->size = GSize((int16_t) (data[8] | data[9] << 8), (int16_t) (data[10] | data[11] << 8));
+	bitmap->bounds = GRect(0, 0, bitmap->size.w, bitmap->size.h);
+	bitmap->data = (uint8_t *) data + 12;
+	return bitmap;
+}
+void gbitmap_destroy(GBitmap *bitmap)
+{
+	sim_stats.api_calls++;
+	if (!bitmap || bitmap == &screen)
+		return;
+	if (bitmap->owns_data)
+		sim_free(bitmap->data);
+	sim_free(bitmap);
+}
+
+uint8_t *gbitmap_get_data(const GBitmap *bitmap)
+{
+	sim_stats.api_calls++;
+	return bitmap->data;
+}
+
+uint16_t gbitmap_get_bytes_per_row(const GBitmap *bitmap)
+{
+	sim_stats.api_calls++;
+	return bitmap->row_bytes;
+}
+
+GBitmapFormat gbitmap_get_format(const GBitmap *bitmap)
+{
+	sim_stats.api_calls++;
+	return bitmap->format;
+}
+
+GRect gbitmap_get_bounds(const GBitmap *bitmap)
+{
+	sim_stats.api_calls++;
+	return bitmap->bounds;
+}
+
+void gbitmap_set_bounds(GBitmap *bitmap, GRect bounds)
+{
+	sim_stats.api_calls++;
+	bitmap->bounds = intersect(bounds, GRect(0, 0, bitmap->size.w, bitmap->size.h));
+}
+
+static GColor bitmap_pixel(const GBitmap *bitmap, int x, int y)
+{
+	if (bitmap->format == GBitmapFormat1Bit)
+		return bitmap->data[y * bitmap->row_bytes + x / 8] >> (x & 7) & 1 ? GColorWhite : GColorBlack;
+	return (GColor8){.argb = bitmap->data[y * bitmap->row_bytes + x]};
+}
+
+/*  Combine a source pixel with screen pixel (x, y).  1-bit sources
+    follow the aplite operators; 8-bit sources are assigned, or with
+    GCompOpSet drawn only where opaque.  */
+
+static void composite(int x, int y, GCompOp op, const GBitmap *bitmap, int bx, int by)
+{
+	GColor src = bitmap_pixel(bitmap, bx, by);
+	bool ink = src.argb == GColorWhiteARGB8;
+
+	if (bitmap->format != GBitmapFormat1Bit) {
+		if (op != GCompOpSet || src.a)
+			set_pixel(x, y, src);
+		return;
+	}
+	switch (op) {
+	case GCompOpAssign:
+		set_pixel(x, y, src);
+		break;
+	case GCompOpAssignInverted:
+		set_pixel(x, y, ink ? GColorBlack : GColorWhite);
+		break;
+	case GCompOpOr:
+	case GCompOpSet:
+		if (ink)
+			set_pixel(x, y, GColorWhite);
+		break;
+	case GCompOpAnd:
+		if (!ink)
+			set_pixel(x, y, GColorBlack);
+		break;
+	case GCompOpClear:
+		if (ink)
+			set_pixel(x, y, GColorBlack);
+		break;
+	}
+}
+
+/*  Draw the bitmap's bounds to the top left of rect, clipped.  Rows
+    are copied a byte at a time for GCompOpAssign when the source and
+    screen formats match and the columns line up on byte boundaries.  */
+
+void graphics_draw_bitmap_in_rect(GContext *ctx, const GBitmap *bitmap, GRect rect)
+{
+	int y, x, sx, sy, x0, x1, w, h, bx, by;
+	const uint8_t *src;
+	GRect c = ctx->clip;
+
+	sim_stats.api_calls++;
+	sim_stats.draw_bitmaps++;
+	if (!bitmap)
+		return;
+	bx = bitmap->bounds.origin.x;
+	by = bitmap->bounds.origin.y;
+	w = rect.size.w < bitmap->bounds.size.w ? rect.size.w : bitmap->bounds.size.w;
+	h = rect.size.h < bitmap->bounds.size.h ? rect.size.h : bitmap->bounds.size.h;
+	sx = ctx->offset.x + rect.origin.x;
+	x0 = sx > c.origin.x ? sx : c.origin.x;
+	x1 = sx + w < c.origin.x + c.size.w ? sx + w : c.origin.x + c.size.w;
+	for (y = 0; y < h && x1 > x0; y++) {
+		sy = ctx->offset.y + rect.origin.y + y;
+		if (sy < c.origin.y || sy >= c.origin.y + c.size.h)
+			continue;
+		src = bitmap->data + (by + y) * bitmap->row_bytes;
+		x = x0;
+		if (bitmap->format == SCREEN_FORMAT && ctx->op == GCompOpAssign) {
+#ifdef PBL_PLATFORM_APLITE
+			if (((bx - sx) & 7) == 0) {
+				for (; x < x1 && (x & 7); x++)
+					set_pixel(x, sy, bitmap_pixel(bitmap, bx + x - sx, by + y));
+				memcpy(&sim_framebuffer[sy * SIM_ROW_BYTES + x / 8], src + (bx + x - sx) / 8, (x1 - x) / 8);
+				x += (x1 - x) & ~7;
+			}
+#else
+			memcpy(&sim_framebuffer[sy * SIM_ROW_BYTES + x], src + (bx + x - sx), x1 - x);
+			x = x1;
+#endif
+		}
+		for (; x < x1; x++)
+			composite(x, sy, ctx->op, bitmap, bx + x - sx, by + y);
+	}
+}
+
+GBitmap *graphics_capture_frame_buffer(GContext *ctx)
+{
+	sim_stats.api_calls++;
+	sim_stats.captures++;
+	if (captured)
+		return NULL;
+	captured = true;
+	return &screen;
+}
+
+bool graphics_release_frame_buffer(GContext *ctx, GBitmap *buffer)
+{
+	sim_stats.api_calls++;
+	if (buffer != &screen || !captured)
+		return false;
+	captured = false;
+	return true;
+}
+
+/*  Layers  */
+
+Layer *layer_create(GRect frame)
+{
+	Layer *layer;
+
+	sim_stats.api_calls++;
+	layer = sim_calloc(1, sizeof(Layer));
+	layer->frame = frame;
+	layer->bounds = GRect(0, 0, frame.size.w, frame.size.h);
+	return layer;
+}
+
+static void layer_remove(Layer *layer)
+{
+	Layer **p;
+
+	if (!layer->parent)
+		return;
+	for (p = &layer->parent->first_child; *p; p = &(*p)->next_sibling)
+		if (*p == layer) {
+			*p = layer->next_sibling;
+			break;
+		}
+	layer->parent = NULL;
+	layer->next_sibling = NULL;
+}
+
+void layer_destroy(Layer *layer)
+{
+	sim_stats.api_calls++;
+	if (!layer)
+		return;
+	layer_remove(layer);
+	while (layer->first_child)
+		layer_remove(layer->first_child);
+	sim_free(layer);
+}
+
+void layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc)
+{
+	sim_stats.api_calls++;
+	layer->update_proc = update_proc;
+}
+
+void layer_add_child(Layer *parent, Layer *child)
+{
+	Layer **p;
+
+	sim_stats.api_calls++;
+	layer_remove(child);
+	for (p = &parent->first_child; *p; p = &(*p)->next_sibling)
+		;
+	*p = child;
+	child->parent = parent;
+	dirty = true;
+}
+
+void layer_mark_dirty(Layer *layer)
+{
+	sim_stats.api_calls++;
+	sim_stats.mark_dirty++;
+	dirty = true;
+}
+
+GRect layer_get_bounds(const Layer *layer)
+{
+	sim_stats.api_calls++;
+	return layer->bounds;
+}
+
+GRect layer_get_frame(const Layer *layer)
+{
+	sim_stats.api_calls++;
+	return layer->frame;
+}
+
+/*  Text layers  */
+
+static void text_layer_update(Layer *layer, GContext *ctx)
+{
+	TextLayer *t = layer->text_layer;
+
+	if (t->background_color.a) {
+		graphics_context_set_fill_color(ctx, t->background_color);
+		graphics_fill_rect(ctx, layer->bounds, 0, GCornerNone);
+	}
+	graphics_context_set_text_color(ctx, t->text_color);
+	graphics_draw_text(ctx, t->text, t->font, layer->bounds, GTextOverflowModeWordWrap, t->alignment, NULL);
+}
+
+TextLayer *text_layer_create(GRect frame)
+{
+	TextLayer *t;
+
+	sim_stats.api_calls++;
+	t = sim_calloc(1, sizeof(TextLayer));
+	t->layer.frame = frame;
+	t->layer.bounds = GRect(0, 0, frame.size.w, frame.size.h);
+	t->layer.update_proc = text_layer_update;
+	t->layer.text_layer = t;
+	t->text_color = GColorBlack;
+	t->background_color = GColorWhite;
+	t->alignment = GTextAlignmentLeft;
+	t->index = -1;
+	return t;
+}
+
+void text_layer_destroy(TextLayer *text_layer)
+{
+	sim_stats.api_calls++;
+	if (!text_layer)
+		return;
+	layer_remove(&text_layer->layer);
+	sim_free(text_layer);
+}
+
+Layer *text_layer_get_layer(TextLayer *text_layer)
+{
+	sim_stats.api_calls++;
+	return &text_layer->layer;
+}
+
+/*  Text layers are tracked by the frame they have when first given
+    text, so counts survive window unload and reload.  */
+
+void text_layer_set_text(TextLayer *text_layer, const char *text)
+{
+	int i;
+
+	sim_stats.api_calls++;
+	sim_stats.set_text++;
+	if (text_layer->index < 0) {
+		for (i = 0; i < sim_text_layer_count; i++)
+			if (!memcmp(&sim_text_layers[i].frame, &text_layer->layer.frame, sizeof(GRect)))
+				break;
+		if (i == sim_text_layer_count && i < SIM_TEXT_LAYERS)
+			sim_text_layers[sim_text_layer_count++].frame = text_layer->layer.frame;
+		text_layer->index = i < SIM_TEXT_LAYERS ? i : -1;
+	}
+	if (text_layer->index >= 0)
+		sim_text_layers[text_layer->index].set_text++;
+	text_layer->text = text;
+	layer_mark_dirty(&text_layer->layer);
+	sim_stats.api_calls--;	   /* The mark is internal, not an app call */
+}
+
+void text_layer_set_font(TextLayer *text_layer, GFont font)
+{
+	sim_stats.api_calls++;
+	text_layer->font = font;
+}
+
+void text_layer_set_text_color(TextLayer *text_layer, GColor color)
+{
+	sim_stats.api_calls++;
+	text_layer->text_color = color;
+}
+
+void text_layer_set_background_color(TextLayer *text_layer, GColor color)
+{
+	sim_stats.api_calls++;
+	text_layer->background_color = color;
+}
+
+void text_layer_set_text_alignment(TextLayer *text_layer, GTextAlignment alignment)
+{
+	sim_stats.api_calls++;
+	text_layer->alignment = alignment;
+}
+
+/*  Windows  */
+
+Window *window_create(void)
+{
+	Window *w;
+
+	sim_stats.api_calls++;
+	w = sim_calloc(1, sizeof(Window));
+	w->root = layer_create(GRect(0, 0, SIM_WIDTH, SIM_HEIGHT));
+	sim_stats.api_calls--;
+	w->background = GColorWhite;
+	return w;
+}
+
+void window_destroy(Window *window)
+{
+	sim_stats.api_calls++;
+	if (window == top_window)
+		window_stack_pop(false);
+	layer_destroy(window->root);
+	sim_stats.api_calls--;
+	sim_free(window);
+}
+
+void window_set_window_handlers(Window *window, WindowHandlers handlers)
+{
+	sim_stats.api_calls++;
+	window->handlers = handlers;
+}
+
+void window_set_background_color(Window *window, GColor color)
+{
+	sim_stats.api_calls++;
+	window->background = color;
+	dirty = true;
+}
+
+Layer *window_get_root_layer(const Window *window)
+{
+	sim_stats.api_calls++;
+	return window->root;
+}
+
+void window_stack_push(Window *window, bool animated)
+{
+	sim_stats.api_calls++;
+	top_window = window;
+	sim_stats.load_start = nanotime();
+	if (!window->loaded && window->handlers.load) {
+		window->loaded = true;
+		window->handlers.load(window);
+		sim_stats.load_ns = nanotime() - sim_stats.load_start;
+	}
+	window->loaded = true;
+	if (window->handlers.appear)
+		window->handlers.appear(window);
+	dirty = true;
+}
+
+Window *window_stack_pop(bool animated)
+{
+	Window *w = top_window;
+
+	sim_stats.api_calls++;
+	if (!w)
+		return NULL;
+	top_window = NULL;
+	if (w->handlers.disappear)
+		w->handlers.disappear(w);
+	if (w->loaded && w->handlers.unload)
+		w->handlers.unload(w);
+	w->loaded = false;
+	return w;
+}
+
+/*  Unload and load the top window again, as leaving it for another
+    window of the app and coming back does.  */
+
+void sim_reload(void)
+{
+	Window *w = top_window;
+
+	if (!w)
+		return;
+	window_stack_pop(false);
+	window_stack_push(w, false);
+	sim_stats.api_calls -= 2;
+}
+
+/*  Rendering: the whole tree, parents before children.  A clear window
+    background leaves the previous frame in place, as on the watch.  */
+
+static void render_layer(Layer *layer, GPoint origin, GRect clip)
+{
+	GContext ctx;
+	Layer *child;
+	double start;
+
+	origin.x += layer->frame.origin.x;
+	origin.y += layer->frame.origin.y;
+	clip = intersect(clip, GRect(origin.x, origin.y, layer->frame.size.w, layer->frame.size.h));
+	if (layer->update_proc) {
+		ctx.offset = GPoint(origin.x + layer->bounds.origin.x, origin.y + layer->bounds.origin.y);
+		ctx.clip = clip;
+		ctx.fill = GColorBlack;
+		ctx.text = GColorBlack;
+		ctx.op = GCompOpAssign;
+		sim_stats.update_procs++;
+		start = nanotime();
+		layer->update_proc(layer, &ctx);
+		*(layer->text_layer ? &sim_stats.text_ns : &sim_stats.layer_ns) += nanotime() - start;
+	}
+	for (child = layer->first_child; child; child = child->next_sibling)
+		render_layer(child, GPoint(origin.x + layer->bounds.origin.x, origin.y + layer->bounds.origin.y), clip);
+}
+
+bool sim_render(void)
+{
+	if (!dirty || !top_window)
+		return false;
+	dirty = false;
+	sim_stats.frames++;
+	if (top_window->background.a) {
+#ifdef PBL_PLATFORM_APLITE
+		memset(sim_framebuffer, top_window->background.argb == GColorWhiteARGB8 ? 0xFF : 0x00, sizeof(sim_framebuffer));
+#else
+		memset(sim_framebuffer, top_window->background.argb, sizeof(sim_framebuffer));
+#endif
+	}
+	render_layer(top_window->root, GPoint(0, 0), GRect(0, 0, SIM_WIDTH, SIM_HEIGHT));
+	return true;
+}
+
+/*  Fonts and resources  */
+
+ResHandle resource_get_handle(uint32_t resource_id)
+{
+	sim_stats.api_calls++;
+	return (ResHandle) (uintptr_t) resource_id;
+}
+
+GFont fonts_load_custom_font(ResHandle handle)
+{
+	GFont font;
+	int i;
+
+	sim_stats.api_calls++;
+	sim_stats.font_loads++;
+	font = sim_calloc(1, sizeof(struct FontInfo));
+	font->resource_id = (uint32_t) (uintptr_t) handle;
+	for (i = 0; i < sizeof(resources) / sizeof(resources[0]); i++)
+		if (resources[i].id == font->resource_id)
+			font->height = resources[i].height;
+	return font;
+}
+
+/*  Raw resources are read from the source tree on every load.  */
+
+static FILE *open_resource(ResHandle handle)
+{
+	char path[512];
+	int i;
+
+	for (i = 0; i < sizeof(resources) / sizeof(resources[0]); i++)
+		if (resources[i].id == (uint32_t) (uintptr_t) handle && resources[i].file) {
+			snprintf(path, sizeof(path), "%s/%s", SIM_RESOURCES, resources[i].file);
+			return fopen(path, "rb");
+		}
+	return NULL;
+}
+
+size_t resource_size(ResHandle handle)
+{
+	FILE *f;
+	long size = 0;
+
+	sim_stats.api_calls++;
+	if ((f = open_resource(handle))) {
+		fseek(f, 0, SEEK_END);
+		size = ftell(f);
+		fclose(f);
+	}
+	return size;
+}
+
+size_t resource_load(ResHandle handle, uint8_t *buffer, size_t max_length)
+{
+	FILE *f;
+	size_t n = 0;
+
+	sim_stats.api_calls++;
+	if ((f = open_resource(handle))) {
+		n = fread(buffer, 1, max_length, f);
+		fclose(f);
+	}
+	return n;
+}
+
+void fonts_unload_custom_font(GFont font)
+{
+	sim_stats.api_calls++;
+	sim_stats.font_unloads++;
+	sim_free(font);
+}
+
+/*  Persistent storage: a fixed table of keys, as small as the watch's
+    4 KB per app, kept in a file between runs when the driver asks.  */
+
+#define PERSIST_KEYS 16
+
+static struct {
+	uint32_t key;
+	int size;		   /* 0 for an empty slot */
+	uint8_t data[PERSIST_DATA_MAX_LENGTH];
+} persist[PERSIST_KEYS];
+
+static int persist_find(uint32_t key)
+{
+	int i;
+
+	for (i = 0; i < PERSIST_KEYS; i++)
+		if (persist[i].size && persist[i].key == key)
+			return i;
+	return -1;
+}
+
+bool persist_exists(const uint32_t key)
+{
+	sim_stats.api_calls++;
+	return persist_find(key) >= 0;
+}
+
+int persist_get_size(const uint32_t key)
+{
+	int i = persist_find(key);
+
+	sim_stats.api_calls++;
+	return i < 0 ? E_DOES_NOT_EXIST : persist[i].size;
+}
+
+int persist_read_data(const uint32_t key, void *buffer, const size_t buffer_size)
+{
+	int i = persist_find(key), n;
+
+	sim_stats.api_calls++;
+	sim_stats.persist_reads++;
+	if (i < 0)
+		return E_DOES_NOT_EXIST;
+	n = persist[i].size < buffer_size ? persist[i].size : buffer_size;
+	memcpy(buffer, persist[i].data, n);
+	return n;
+}
+
+int persist_write_data(const uint32_t key, const void *data, const size_t size)
+{
+	int i = persist_find(key);
+
+	sim_stats.api_calls++;
+	sim_stats.persist_writes++;
+	if (size == 0 || size > PERSIST_DATA_MAX_LENGTH)
+		return E_INVALID_ARGUMENT;
+	if (i < 0)
+		for (i = 0; i < PERSIST_KEYS && persist[i].size; i++)
+			;
+	if (i == PERSIST_KEYS)
+		return E_OUT_OF_STORAGE;
+	persist[i].key = key;
+	persist[i].size = size;
+	memcpy(persist[i].data, data, size);
+	return size;
+}
+
+status_t persist_delete(const uint32_t key)
+{
+	int i = persist_find(key);
+
+	sim_stats.api_calls++;
+	if (i < 0)
+		return E_DOES_NOT_EXIST;
+	persist[i].size = 0;
+	return S_SUCCESS;
+}
+
+/*  The store file is the table as it is in memory.  A missing file is
+    an empty store, as on a fresh install.  */
+
+bool sim_persist_load(const char *path)
+{
+	FILE *f = fopen(path, "rb");
+	bool ok;
+
+	memset(persist, 0, sizeof(persist));
+	if (!f)
+		return true;
+	ok = fread(persist, sizeof(persist), 1, f) == 1;
+	fclose(f);
+	if (!ok)
+		memset(persist, 0, sizeof(persist));
+	return ok;
+}
+
+bool sim_persist_save(const char *path)
+{
+	FILE *f = fopen(path, "wb");
+
+	if (!f)
+		return false;
+	return (fwrite(persist, sizeof(persist), 1, f) == 1) & (fclose(f) == 0);
+}
+
+/*  Time and events  */
+
+/*  App timers are fired by the driver when it chooses, in the order they
+    were registered; simulated time does not move for them.  */
+
+#define SIM_TIMERS 8
+
+struct AppTimer {
+	AppTimerCallback callback;
+	void *data;
+};
+
+static AppTimer timers[SIM_TIMERS];
+
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback, void *callback_data)
+{
+	int i;
+
+	sim_stats.api_calls++;
+	for (i = 0; i < SIM_TIMERS; i++)
+		if (!timers[i].callback) {
+			timers[i].callback = callback;
+			timers[i].data = callback_data;
+			return &timers[i];
+		}
+	return NULL;
+}
+
+void app_timer_cancel(AppTimer *timer)
+{
+	sim_stats.api_calls++;
+	timer->callback = NULL;
+}
+
+int sim_run_timers(void)
+{
+	AppTimerCallback callback;
+	int i, n = 0;
+
+	for (i = 0; i < SIM_TIMERS; i++)
+		if ((callback = timers[i].callback)) {
+			timers[i].callback = NULL;
+			callback(timers[i].data);
+			sim_stats.timers++;
+			n++;
+		}
+	return n;
+}
+
+/*  Background worker: started before the app, as if left running from
+    an earlier launch, with the app run inside its event loop.  Calls
+    the worker makes are counted apart from the app's.  */
+
+int worker_main(void);
+int watch_main(void);
+
+static bool in_worker, worker_running;
+static AppWorkerMessageHandler app_message_handler;
+static long app_calls;
+static double worker_start;
+
+static void enter_worker(void)
+{
+	in_worker = true;
+	app_calls = sim_stats.api_calls;
+	worker_start = nanotime();
+}
+
+static void leave_worker(void)
+{
+	sim_stats.worker_ns += nanotime() - worker_start;
+	sim_stats.worker_calls += sim_stats.api_calls - app_calls;
+	sim_stats.api_calls = app_calls;
+	in_worker = false;
+}
+
+void sim_run(bool worker)
+{
+	if (!worker) {
+		watch_main();
+		return;
+	}
+	worker_running = true;
+	enter_worker();
+	worker_main();
+	leave_worker();
+	worker_running = false;
+}
+
+void worker_event_loop(void)
+{
+	leave_worker();
+	sim_stats.worker_start_ns = sim_stats.worker_ns;
+	watch_main();
+	enter_worker();
+}
+
+bool app_worker_is_running(void)
+{
+	sim_stats.api_calls++;
+	return worker_running;
+}
+
+AppWorkerResult app_worker_launch(void)
+{
+	sim_stats.api_calls++;
+	return worker_running ? APP_WORKER_RESULT_ALREADY_RUNNING : APP_WORKER_RESULT_NO_WORKER;
+}
+
+bool app_worker_message_subscribe(AppWorkerMessageHandler handler)
+{
+	sim_stats.api_calls++;
+	app_message_handler = handler;
+	return true;
+}
+
+bool app_worker_message_unsubscribe(void)
+{
+	sim_stats.api_calls++;
+	app_message_handler = NULL;
+	return true;
+}
+
+void app_worker_send_message(uint8_t type, AppWorkerMessage *data)
+{
+	sim_stats.api_calls++;
+	sim_stats.worker_messages++;
+	if (in_worker && app_message_handler) {
+		leave_worker();
+		app_message_handler(type, data);
+		enter_worker();
+	}
+}
+
+void tick_timer_service_subscribe(TimeUnits tick_units, TickHandler handler)
+{
+	sim_stats.api_calls++;
+	if (in_worker) {
+		worker_tick_handler = handler;
+		worker_tick_units = tick_units;
+	} else
+		tick_handler = handler;
+}
+
+void tick_timer_service_unsubscribe(void)
+{
+	sim_stats.api_calls++;
+	*(in_worker ? &worker_tick_handler : &tick_handler) = NULL;
+}
+
+/*  AppMessage: the driver delivers messages the phone side wrote, one
+    per line of KEY=value pairs.  A value of digits is an int32, anything
+    else a byte array of its characters.  A message larger than the inbox
+    the app opened is dropped, as the firmware refuses it.  */
+
+#define SIM_MESSAGE_MAX 1024
+
+struct DictionaryIterator {
+	uint8_t *begin, *end;
+};
+
+static const struct {
+	const char *name;
+	uint32_t key;
+} message_keys[] = {
+	{"MOON_FIRST", MESSAGE_KEY_MOON_FIRST},
+	{"MOON_GLYPHS", MESSAGE_KEY_MOON_GLYPHS},
+};
+
+static AppMessageInboxReceived inbox_received;
+static uint32_t inbox_size;
+
+uint32_t dict_calc_buffer_size(const uint8_t tuple_count, ...)
+{
+	uint32_t size = 1 + tuple_count * sizeof(Tuple);
+	va_list args;
+	int i;
+
+	sim_stats.api_calls++;
+	va_start(args, tuple_count);
+	for (i = 0; i < tuple_count; i++)
+		size += va_arg(args, uint32_t);
+	va_end(args);
+	return size;
+}
+
+Tuple *dict_find(const DictionaryIterator *iter, const uint32_t key)
+{
+	uint8_t *p = iter->begin + 1;
+	Tuple *t;
+	int i;
+
+	sim_stats.api_calls++;
+	for (i = 0; i < iter->begin[0] && p < iter->end; i++, p += sizeof(Tuple) + t->length)
+		if ((t = (Tuple *) p)->key == key)
+			return t;
+	return NULL;
+}
+
+AppMessageResult app_message_open(const uint32_t size_inbound, const uint32_t size_outbound)
+{
+	sim_stats.api_calls++;
+	inbox_size = size_inbound;
+	return APP_MSG_OK;
+}
+
+AppMessageInboxReceived app_message_register_inbox_received(AppMessageInboxReceived received_callback)
+{
+	AppMessageInboxReceived previous = inbox_received;
+
+	sim_stats.api_calls++;
+	inbox_received = received_callback;
+	return previous;
+}
+
+void app_message_deregister_callbacks(void)
+{
+	sim_stats.api_calls++;
+	inbox_received = NULL;
+}
+
+bool sim_deliver_messages(const char *path)
+{
+	char line[SIM_MESSAGE_MAX], *field, *value, *end;
+	uint8_t buffer[SIM_MESSAGE_MAX + 16], *p;
+	DictionaryIterator iter;
+	FILE *f = fopen(path, "r");
+	size_t length;
+	Tuple *t;
+	long n;
+	int i;
+
+	if (!f)
+		return false;
+	while (fgets(line, sizeof(line), f)) {
+		buffer[0] = 0;
+		p = buffer + 1;
+		for (field = strtok(line, " \n"); field; field = strtok(NULL, " \n")) {
+			if (!(value = strchr(field, '=')))
+				continue;
+			*value++ = '\0';
+			for (i = 0; i < sizeof(message_keys) / sizeof(message_keys[0]); i++)
+				if (!strcmp(field, message_keys[i].name))
+					break;
+			n = strtol(value, &end, 10);
+			length = *value && !*end ? sizeof(int32_t) : strlen(value);
+			if (i == sizeof(message_keys) / sizeof(message_keys[0]) || p + sizeof(Tuple) + length > buffer + sizeof(buffer))
+				continue;
+			t = (Tuple *) p;
+			t->key = message_keys[i].key;
+			t->length = length;
+			if (*value && !*end) {
+				t->type = TUPLE_INT;
+				t->value->int32 = n;
+			} else {
+				t->type = TUPLE_BYTE_ARRAY;
+				memcpy(t->value->data, value, length);
+			}
+			p += sizeof(Tuple) + length;
+			buffer[0]++;
+		}
+		sim_stats.message_bytes += p - buffer;
+		if (!inbox_received || p - buffer > inbox_size) {
+			sim_stats.messages_dropped++;
+			continue;
+		}
+		sim_stats.messages++;
+		iter.begin = buffer;
+		iter.end = p;
+		inbox_received(&iter, NULL);
+	}
+	fclose(f);
+	return true;
+}
+
+/*  The worker hears of a tick first, and only of the units it asked for;
+    the app hears of every tick.  */
+
+void sim_tick(TimeUnits units_changed)
+{
+	static struct tm tm;
+
+	if (worker_tick_handler && (units_changed & worker_tick_units)) {
+		enter_worker();
+		sim_stats.worker_ticks++;
+		worker_tick_handler(gmtime_r(&sim_now, &tm), units_changed);
+		leave_worker();
+	}
+	if (tick_handler)
+		tick_handler(gmtime_r(&sim_now, &tm), units_changed);
+}
+
+/*  Taps come only when the driver asks for one.  */
+
+static AccelTapHandler tap_handler;
+
+void accel_tap_service_subscribe(AccelTapHandler handler)
+{
+	sim_stats.api_calls++;
+	tap_handler = handler;
+}
+
+void accel_tap_service_unsubscribe(void)
+{
+	sim_stats.api_calls++;
+	tap_handler = NULL;
+}
+
+bool sim_tap(void)
+{
+	if (!tap_handler)
+		return false;
+	tap_handler(ACCEL_AXIS_Z, 1);
+	return true;
+}
+
+bool clock_is_24h_style(void)
+{
+	sim_stats.api_calls++;
+	sim_stats.clock_style++;
+	return sim_24h;
+}
+
+time_t sim_time(time_t *tloc)
+{
+	sim_stats.api_calls++;
+	if (tloc)
+		*tloc = sim_now;
+	return sim_now;
+}
+
+struct tm *sim_localtime(const time_t *timep)
+{
+	static struct tm tm;
+
+	sim_stats.api_calls++;
+	return gmtime_r(timep, &tm);
+}
+
+size_t sim_strftime(char *s, size_t max, const char *format, const struct tm *tm)
+{
+	sim_stats.api_calls++;
+	sim_stats.strftime++;
+	return strftime(s, max, format, tm);
+}
+
+uint16_t time_ms(time_t *tloc, uint16_t *out_ms)
+{
+	struct timespec ts;
+
+	sim_stats.api_calls++;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	if (tloc)
+		*tloc = ts.tv_sec;
+	if (out_ms)
+		*out_ms = ts.tv_nsec / 1000000;
+	return ts.tv_nsec / 1000000;
+}
+
+void app_event_loop(void)
+{
+	sim_replay();
+}
+
+void app_log(uint8_t log_level, const char *src_filename, int src_line_number, const char *fmt, ...)
+{
+	va_list args;
+
+	va_start(args, fmt);
+	fprintf(stderr, "[%s:%d] ", src_filename, src_line_number);
+	vfprintf(stderr, fmt, args);
+	fputc('\n', stderr);
+	va_end(args);
+}
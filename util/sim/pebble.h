@@ -0,0 +1,352 @@
+/*
+    Host stub of the Pebble SDK for the moontiles simulator.
+
+    Declares the subset of pebble.h the watchface uses, with the same
+    names and types, so src/c/moontiles.c builds unchanged on Linux.
+    The implementation in pebble.c renders into an in-memory frame
+    buffer and counts every call for the reports made by moonsim.c.
+    Build with PBL_PLATFORM_APLITE (1-bit) or PBL_PLATFORM_BASALT
+    (8-bit colour).
+
+*/
+
+#ifndef PEBBLE_STUB_H
+#define PEBBLE_STUB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if !defined(PBL_PLATFORM_APLITE) && !defined(PBL_PLATFORM_BASALT)
+#define PBL_PLATFORM_APLITE
+#endif
+#ifdef PBL_PLATFORM_APLITE
+#define PBL_BW
+#else
+#define PBL_COLOR
+#endif
+
+/*  Geometry  */
+
+typedef struct { int16_t x, y; } GPoint;
+typedef struct { int16_t w, h; } GSize;
+typedef struct { GPoint origin; GSize size; } GRect;
+
+#define GPoint(x, y) ((GPoint){(x), (y)})
+#define GSize(w, h) ((GSize){(w), (h)})
+#define GRect(x, y, w, h) ((GRect){{(x), (y)}, {(w), (h)}})
+#define GRectZero GRect(0, 0, 0, 0)
+
+/*  Colours, as the SDK 3 GColor8 union  */
+
+typedef union GColor8 {
+	uint8_t argb;
+	struct {
+		uint8_t b:2;
+		uint8_t g:2;
+		uint8_t r:2;
+		uint8_t a:2;
+	};
+} GColor8;
+typedef GColor8 GColor;
+
+#define GColorClearARGB8 ((uint8_t)0x00)
+#define GColorBlackARGB8 ((uint8_t)0xC0)
+#define GColorWhiteARGB8 ((uint8_t)0xFF)
+#define GColorClear ((GColor8){.argb = GColorClearARGB8})
+#define GColorBlack ((GColor8){.argb = GColorBlackARGB8})
+#define GColorWhite ((GColor8){.argb = GColorWhiteARGB8})
+
+static inline bool gcolor_equal(GColor8 a, GColor8 b)
+{
+	return a.argb == b.argb;
+}
+
+typedef enum {
+	GCornerNone = 0,
+	GCornerTopLeft = 1 << 0,
+	GCornerTopRight = 1 << 1,
+	GCornerBottomLeft = 1 << 2,
+	GCornerBottomRight = 1 << 3,
+	GCornersAll = 0xF,
+} GCornerMask;
+
+typedef enum {
+	GTextAlignmentLeft,
+	GTextAlignmentCenter,
+	GTextAlignmentRight,
+} GTextAlignment;
+
+typedef enum {
+	GTextOverflowModeWordWrap,
+	GTextOverflowModeTrailingEllipsis,
+	GTextOverflowModeFill,
+} GTextOverflowMode;
+
+/*  Resources, as generated from package.json by the SDK  */
+
+typedef enum {
+	RESOURCE_ID_FONT_MOONPHASE_33 = 1,
+	RESOURCE_ID_FONT_WW_DIGITAL_DATE_SUBSET_22,
+	RESOURCE_ID_FONT_WW_DIGITAL_DOW_SUBSET_33,
+	RESOURCE_ID_FONT_WW_DIGITAL_SUBSET_52,
+	RESOURCE_ID_FONT_WW_DIGITAL_SUBSET_10,
+	RESOURCE_ID_IMAGE_MENU_ICON,
+	RESOURCE_ID_GLYPH_ATLAS,
+} ResourceId;
+
+typedef struct ResHandleStub *ResHandle;
+typedef struct FontInfo *GFont;
+
+ResHandle resource_get_handle(uint32_t resource_id);
+GFont fonts_load_custom_font(ResHandle handle);
+void fonts_unload_custom_font(GFont font);
+size_t resource_size(ResHandle handle);
+size_t resource_load(ResHandle handle, uint8_t *buffer, size_t max_length);
+
+/*  Persistent storage  */
+
+#define PERSIST_DATA_MAX_LENGTH 256
+
+typedef enum {
+	S_SUCCESS = 0,
+	E_ERROR = -1,
+	E_INVALID_ARGUMENT = -4,
+	E_OUT_OF_STORAGE = -6,
+	E_DOES_NOT_EXIST = -9,
+} StatusCode;
+
+typedef int32_t status_t;
+
+bool persist_exists(const uint32_t key);
+int persist_get_size(const uint32_t key);
+int persist_read_data(const uint32_t key, void *buffer, const size_t buffer_size);
+int persist_write_data(const uint32_t key, const void *data, const size_t size);
+status_t persist_delete(const uint32_t key);
+
+/*  Bitmaps  */
+
+typedef enum {
+	GBitmapFormat1Bit = 0,
+	GBitmapFormat8Bit,
+	GBitmapFormat1BitPalette,
+	GBitmapFormat2BitPalette,
+	GBitmapFormat4BitPalette,
+	GBitmapFormat8BitCircular,
+} GBitmapFormat;
+
+typedef struct GBitmap GBitmap;
+
+GBitmap *gbitmap_create_blank(GSize size, GBitmapFormat format);
+GBitmap *gbitmap_create_with_data(const uint8_t *data);
+void gbitmap_destroy(GBitmap *bitmap);
+uint8_t *gbitmap_get_data(const GBitmap *bitmap);
+uint16_t gbitmap_get_bytes_per_row(const GBitmap *bitmap);
+GBitmapFormat gbitmap_get_format(const GBitmap *bitmap);
+GRect gbitmap_get_bounds(const GBitmap *bitmap);
+void gbitmap_set_bounds(GBitmap *bitmap, GRect bounds);
+
+/*  Graphics  */
+
+typedef enum {
+	GCompOpAssign,
+	GCompOpAssignInverted,
+	GCompOpOr,
+	GCompOpAnd,
+	GCompOpClear,
+	GCompOpSet,
+} GCompOp;
+
+typedef struct GContext GContext;
+
+void graphics_context_set_fill_color(GContext *ctx, GColor color);
+void graphics_context_set_text_color(GContext *ctx, GColor color);
+void graphics_context_set_compositing_mode(GContext *ctx, GCompOp mode);
+void graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius, GCornerMask corner_mask);
+void graphics_draw_text(GContext *ctx, const char *text, GFont font, GRect box,
+			GTextOverflowMode overflow_mode, GTextAlignment alignment, void *layout);
+void graphics_draw_bitmap_in_rect(GContext *ctx, const GBitmap *bitmap, GRect rect);
+GBitmap *graphics_capture_frame_buffer(GContext *ctx);
+bool graphics_release_frame_buffer(GContext *ctx, GBitmap *buffer);
+
+/*  Layers and windows  */
+
+typedef struct Layer Layer;
+typedef struct TextLayer TextLayer;
+typedef struct Window Window;
+typedef void (*LayerUpdateProc)(Layer *layer, GContext *ctx);
+
+Layer *layer_create(GRect frame);
+void layer_destroy(Layer *layer);
+void layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc);
+void layer_add_child(Layer *parent, Layer *child);
+void layer_mark_dirty(Layer *layer);
+GRect layer_get_bounds(const Layer *layer);
+GRect layer_get_frame(const Layer *layer);
+
+TextLayer *text_layer_create(GRect frame);
+void text_layer_destroy(TextLayer *text_layer);
+Layer *text_layer_get_layer(TextLayer *text_layer);
+void text_layer_set_text(TextLayer *text_layer, const char *text);
+void text_layer_set_font(TextLayer *text_layer, GFont font);
+void text_layer_set_text_color(TextLayer *text_layer, GColor color);
+void text_layer_set_background_color(TextLayer *text_layer, GColor color);
+void text_layer_set_text_alignment(TextLayer *text_layer, GTextAlignment alignment);
+
+typedef void (*WindowHandler)(Window *window);
+typedef struct {
+	WindowHandler load;
+	WindowHandler appear;
+	WindowHandler disappear;
+	WindowHandler unload;
+} WindowHandlers;
+
+Window *window_create(void);
+void window_destroy(Window *window);
+void window_set_window_handlers(Window *window, WindowHandlers handlers);
+void window_set_background_color(Window *window, GColor color);
+Layer *window_get_root_layer(const Window *window);
+void window_stack_push(Window *window, bool animated);
+Window *window_stack_pop(bool animated);
+
+/*  Time and events  */
+
+typedef enum {
+	SECOND_UNIT = 1 << 0,
+	MINUTE_UNIT = 1 << 1,
+	HOUR_UNIT = 1 << 2,
+	DAY_UNIT = 1 << 3,
+	MONTH_UNIT = 1 << 4,
+	YEAR_UNIT = 1 << 5,
+} TimeUnits;
+
+typedef void (*TickHandler)(struct tm *tick_time, TimeUnits units_changed);
+
+typedef struct AppTimer AppTimer;
+typedef void (*AppTimerCallback)(void *data);
+
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback, void *callback_data);
+void app_timer_cancel(AppTimer *timer);
+
+void tick_timer_service_subscribe(TimeUnits tick_units, TickHandler handler);
+void tick_timer_service_unsubscribe(void);
+bool clock_is_24h_style(void);
+uint16_t time_ms(time_t *tloc, uint16_t *out_ms);
+void app_event_loop(void);
+
+/*  The simulated clock and the counted libc entry points  */
+
+time_t sim_time(time_t *tloc);
+struct tm *sim_localtime(const time_t *timep);
+size_t sim_strftime(char *s, size_t max, const char *format, const struct tm *tm);
+void *sim_malloc(size_t size);
+void *sim_calloc(size_t count, size_t size);
+void sim_free(void *ptr);
+
+#define time(t) sim_time(t)
+#define localtime(t) sim_localtime(t)
+#define strftime(s, max, format, tm) sim_strftime(s, max, format, tm)
+#define malloc(size) sim_malloc(size)
+#define calloc(count, size) sim_calloc(count, size)
+#define free(ptr) sim_free(ptr)
+
+/*  Accelerometer taps  */
+
+typedef enum {
+	ACCEL_AXIS_X = 0,
+	ACCEL_AXIS_Y = 1,
+	ACCEL_AXIS_Z = 2,
+} AccelAxisType;
+
+typedef void (*AccelTapHandler)(AccelAxisType axis, int32_t direction);
+
+void accel_tap_service_subscribe(AccelTapHandler handler);
+void accel_tap_service_unsubscribe(void);
+
+/*  Background worker  */
+
+typedef struct {
+	uint16_t data0;
+	uint16_t data1;
+	uint16_t data2;
+} AppWorkerMessage;
+
+typedef void (*AppWorkerMessageHandler)(uint16_t type, AppWorkerMessage *data);
+
+typedef enum {
+	APP_WORKER_RESULT_SUCCESS = 0,
+	APP_WORKER_RESULT_NO_WORKER = 1,
+	APP_WORKER_RESULT_DIFFERENT_APP = 2,
+	APP_WORKER_RESULT_NOT_RUNNING = 3,
+	APP_WORKER_RESULT_ALREADY_RUNNING = 4,
+	APP_WORKER_RESULT_ASKING_CONFIRMATION = 5,
+} AppWorkerResult;
+
+bool app_worker_is_running(void);
+AppWorkerResult app_worker_launch(void);
+bool app_worker_message_subscribe(AppWorkerMessageHandler handler);
+bool app_worker_message_unsubscribe(void);
+void app_worker_send_message(uint8_t type, AppWorkerMessage *data);
+void worker_event_loop(void);
+
+/*  AppMessage, with the keys generated from package.json by the SDK  */
+
+enum {
+	MESSAGE_KEY_MOON_FIRST = 10000,
+	MESSAGE_KEY_MOON_GLYPHS = 10001,
+};
+
+typedef enum {
+	TUPLE_BYTE_ARRAY = 0,
+	TUPLE_CSTRING = 1,
+	TUPLE_UINT = 2,
+	TUPLE_INT = 3,
+} TupleType;
+
+typedef struct __attribute__((__packed__)) {
+	uint32_t key;
+	TupleType type:8;
+	uint16_t length;
+	union {
+		uint8_t data[0];
+		char cstring[0];
+		uint8_t uint8;
+		uint16_t uint16;
+		uint32_t uint32;
+		int8_t int8;
+		int16_t int16;
+		int32_t int32;
+	} value[];
+} Tuple;
+
+typedef struct DictionaryIterator DictionaryIterator;
+
+typedef enum {
+	APP_MSG_OK = 0,
+	APP_MSG_OUT_OF_MEMORY = 128,
+} AppMessageResult;
+
+typedef void (*AppMessageInboxReceived)(DictionaryIterator *iterator, void *context);
+
+uint32_t dict_calc_buffer_size(const uint8_t tuple_count, ...);
+Tuple *dict_find(const DictionaryIterator *iter, const uint32_t key);
+AppMessageResult app_message_open(const uint32_t size_inbound, const uint32_t size_outbound);
+AppMessageInboxReceived app_message_register_inbox_received(AppMessageInboxReceived received_callback);
+void app_message_deregister_callbacks(void);
+
+/*  Logging  */
+
+typedef enum {
+	APP_LOG_LEVEL_ERROR = 1,
+	APP_LOG_LEVEL_WARNING = 50,
+	APP_LOG_LEVEL_INFO = 100,
+	APP_LOG_LEVEL_DEBUG = 200,
+} AppLogLevel;
+
+void app_log(uint8_t log_level, const char *src_filename, int src_line_number, const char *fmt, ...);
+#define APP_LOG(level, fmt, args...) app_log(level, __FILE__, __LINE__, fmt, ## args)
+
+#endif
@@ -0,0 +1,7 @@
+/*
+    Background worker side of the Pebble SDK stub: the same entry
+    points as the app's, as the stub does not tell them apart.
+
+*/
+
+#include "pebble.h"
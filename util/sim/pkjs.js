@@ -0,0 +1,94 @@
+/*
+    Runs src/pkjs/index.js under node with a stand-in for the PebbleKit
+    JS API.  Every AppMessage is acknowledged and written to stdout as a
+    line of KEY=value pairs for moonsim -m; byte arrays are written as
+    text, which the moon glyphs are.  The message count and dictionary
+    bytes go to stderr.
+
+    Usage: node sim/pkjs.js [YYYY-MM-DD]	sync as on that day
+	   node sim/pkjs.js -g jdn days		print the glyphs moon.js
+						works out for those days
+
+*/
+
+var Module = require('module');
+var path = require('path');
+
+var src = path.join(__dirname, '..', '..', 'src', 'pkjs');
+var names = require(path.join(__dirname, '..', '..', 'package.json')).pebble.messageKeys;
+var keys = {}, byKey = {};
+var handlers = {};
+var messages = 0, bytes = 0;
+
+function glyphs(first, count) {
+	var codes = require(path.join(src, 'moon.js')).glyphs(first, count);
+	process.stdout.write(Buffer.from(codes).toString('latin1') + '\n');
+}
+
+function sync(day) {
+	/*  Message keys are numbered from 10000 in package.json order, as the
+	    SDK does, and served as the message_keys module.  */
+
+	names.forEach(function(name, i) {
+		keys[name] = 10000 + i;
+		byKey[10000 + i] = name;
+	});
+	var resolve = Module._resolveFilename;
+	Module._resolveFilename = function(request) {
+		return request === 'message_keys' ? request : resolve.apply(this, arguments);
+	};
+	require.cache.message_keys = {id: 'message_keys', filename: 'message_keys', loaded: true, exports: keys};
+
+	/*  The phone's clock: noon on the given day, so the local date is that
+	    day in any time zone.  */
+
+	if (day) {
+		var RealDate = Date;
+		var fixed = new RealDate(day + 'T12:00:00').getTime();
+		Date = function() {
+			return arguments.length ? new (Function.prototype.bind.apply(RealDate, [null].concat([].slice.call(arguments))))() : new RealDate(fixed);
+		};
+		Date.now = function() {
+			return fixed;
+		};
+	}
+
+	/*  Logs from the phone side go with the summary, apart from the messages  */
+
+	console.log = console.error;
+
+	global.Pebble = {
+		addEventListener: function(type, handler) {
+			handlers[type] = handler;
+		},
+		sendAppMessage: function(message, success, failure) {
+			var fields = [];
+			var size = 1;
+
+			Object.keys(message).forEach(function(key) {
+				var value = message[key];
+				if (typeof value === 'number') {
+					fields.push(byKey[key] + '=' + value);
+					size += 7 + 4;
+				} else {
+					fields.push(byKey[key] + '=' + String.fromCharCode.apply(null, value));
+					size += 7 + value.length;
+				}
+			});
+			process.stdout.write(fields.join(' ') + '\n');
+			messages++;
+			bytes += size;
+			success({});
+		}
+	};
+
+	require(path.join(src, 'index.js'));
+	handlers.ready({});
+	console.error(messages + ' messages, ' + bytes + ' dictionary bytes');
+}
+
+if (process.argv[2] === '-g') {
+	glyphs(Number(process.argv[3]), Number(process.argv[4]));
+} else {
+	sync(process.argv[2]);
+}
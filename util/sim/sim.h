@@ -0,0 +1,97 @@
+/*
+    Interface between the Pebble stub (pebble.c) and the simulator
+    driver (moonsim.c).
+
+*/
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdio.h>
+#include "pebble.h"
+
+#define SIM_WIDTH  144
+#define SIM_HEIGHT 168
+
+#ifdef PBL_PLATFORM_APLITE
+#define SIM_PLATFORM "aplite"
+#define SIM_ROW_BYTES 20	   /* 1 bit per pixel, rows padded to 32 bits */
+#else
+#define SIM_PLATFORM "basalt"
+#define SIM_ROW_BYTES 144	   /* 1 byte per pixel, GColor8 */
+#endif
+
+#ifndef SIM_NAME
+#define SIM_NAME SIM_PLATFORM	   /* Platform and build variant */
+#endif
+#ifndef SIM_GOLDEN
+#define SIM_GOLDEN SIM_NAME	   /* Variant whose golden images apply */
+#endif
+
+#define SIM_RESOURCES "../resources"
+
+#define SIM_TEXT_LAYERS 16	   /* Text layers tracked individually */
+
+typedef struct {
+	long api_calls;		   /* Every stub entry point */
+	long set_text;
+	long mark_dirty;
+	long strftime;
+	long clock_style;
+	long frames;		   /* Complete redraws of the window */
+	long update_procs;	   /* Layer update procs run during redraws */
+	long fill_rects;
+	long draw_texts;
+	long draw_bitmaps;
+	long captures;		   /* Frame buffer captures */
+	long timers;		   /* App timers fired */
+	long persist_reads;
+	long persist_writes;
+	long font_loads;
+	long font_unloads;
+	long allocs;
+	long frees;
+	long heap_bytes;	   /* Live bytes in the app heap */
+	long heap_peak;
+	double layer_ns;	   /* Host time in app layer update procs */
+	double text_ns;		   /* Host time in text layer update procs */
+	double load_start;	   /* Host time the last window load began */
+	double load_ns;		   /* Host time in the last window load handler */
+	long worker_calls;	   /* Stub entry points called by the worker */
+	long worker_ticks;
+	long worker_messages;
+	double worker_ns;	   /* Host time in the worker */
+	double worker_start_ns;	   /* Of which in starting it, before the app */
+	long messages;		   /* AppMessages delivered to the app */
+	long messages_dropped;	   /* Larger than its inbox, or no handler */
+	long message_bytes;	   /* Dictionary bytes of all of them */
+} SimStats;
+
+typedef struct {
+	GRect frame;		   /* Frame when first given text */
+	long set_text;
+} SimTextLayerStats;
+
+extern SimStats sim_stats;
+extern SimTextLayerStats sim_text_layers[SIM_TEXT_LAYERS];
+extern int sim_text_layer_count;
+extern time_t sim_now;
+extern bool sim_24h;
+extern uint8_t sim_framebuffer[SIM_HEIGHT * SIM_ROW_BYTES];
+
+void sim_run(bool worker);
+bool sim_deliver_messages(const char *path);
+void sim_tick(TimeUnits units_changed);
+bool sim_tap(void);
+bool sim_render(void);
+bool sim_pixel_white(int x, int y);
+void sim_reload(void);
+int sim_run_timers(void);
+bool sim_persist_load(const char *path);
+bool sim_persist_save(const char *path);
+
+/*  Supplied by the driver: runs the replay from app_event_loop().  */
+
+void sim_replay(void);
+
+#endif
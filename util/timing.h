@@ -0,0 +1,32 @@
+/*
+    Timing helpers shared by the measurement tools.
+
+*/
+
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <time.h>
+
+/*  NANOTIME  --  Monotonic wall clock in nanoseconds.  */
+
+static double nanotime(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/*  CYCLES  --  Time stamp counter where the host has one, else zero.  */
+
+static unsigned long long cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __builtin_ia32_rdtsc();
+#else
+	return 0;
+#endif
+}
+
+#endif
@@ -0,0 +1,161 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	moonmath.c
+
+   Purpose:	  		The moon phase model of util/moonlib.c, for the watch. The
+   					SDK has no sin, cos or atan, so they are here as series on
+   					small reduced arguments, good to about 1e-14.
+*/
+
+#include "moonmath.h"
+
+#define PI 3.14159265358979323846
+
+/* Constants from util/moonlib.h, epoch 1980.0 */
+#define epoch       2444238.5	/* 1980 January 0.0 */
+#define elonge      278.833540	/* Ecliptic longitude of the Sun at epoch 1980.0 */
+#define elongp      282.596403	/* Ecliptic longitude of the Sun at perigee */
+#define eccent      0.016718	/* Eccentricity of Earth's orbit */
+#define mmlong      64.975464	/* Moon's mean longitude at the epoch */
+#define mmlongp     349.383063	/* Mean longitude of the perigee at the epoch */
+
+/* sqrt((1 + eccent) / (1 - eccent)), for the true anomaly */
+#define ECCENT_FACTOR 1.0168601118216303
+
+#define torad(d) ((d) * (PI / 180.0))
+#define todeg(d) ((d) * (180.0 / PI))
+
+// floor for the magnitudes met here, without the math library
+static double dfloor(double x)
+{
+	double i = (double) (int64_t) x;
+	return i > x ? i - 1 : i;
+}
+
+static double fixangle(double a)
+{
+	return a - 360.0 * dfloor(a / 360.0);
+}
+
+// sine and cosine of r, |r| <= pi/4, by their series to the 13th power
+static double sin_small(double r)
+{
+	double r2 = r * r;
+	return r * (1 - r2 / 6 * (1 - r2 / 20 * (1 - r2 / 42 * (1 - r2 / 72 * (1 - r2 / 110 * (1 - r2 / 156))))));
+}
+
+static double cos_small(double r)
+{
+	double r2 = r * r;
+	return 1 - r2 / 2 * (1 - r2 / 12 * (1 - r2 / 30 * (1 - r2 / 56 * (1 - r2 / 90 * (1 - r2 / 132 * (1 - r2 / 182))))));
+}
+
+// sine of an angle in degrees: the nearest quarter turn is taken off first
+static double dsin(double d)
+{
+	double a = fixangle(d);
+	int quarter = (int) (a / 90.0 + 0.5);
+	double r = torad(a - 90.0 * quarter);
+
+	switch (quarter & 3)
+	{
+		case 0: return sin_small(r);
+		case 1: return cos_small(r);
+		case 2: return -sin_small(r);
+		default: return -cos_small(r);
+	}
+}
+
+static double dcos(double d)
+{
+	return dsin(d + 90.0);
+}
+
+// arc tangent of t, 0 <= t <= 1: above tan(pi/8) it is pi/4 plus the arc
+// tangent of (t - 1) / (t + 1), which is small enough for the series
+static double atan_unit(double t)
+{
+	double base = 0;
+	if (t > 0.41421356237309503)
+	{
+		t = (t - 1) / (t + 1);
+		base = PI / 4;
+	}
+
+	double t2 = t * t, term = t, sum = t;
+	for (int k = 3; k <= 35; k += 2)
+	{
+		term *= -t2;
+		sum += term / k;
+	}
+	return base + sum;
+}
+
+// atan2(y, x) in degrees
+static double datan2(double y, double x)
+{
+	double ay = y < 0 ? -y : y, ax = x < 0 ? -x : x, a;
+
+	if (ay == 0 && ax == 0)
+	{
+		return 0;
+	}
+	a = ay <= ax ? atan_unit(ay / ax) : PI / 2 - atan_unit(ax / ay);
+	if (x < 0)
+	{
+		a = PI - a;
+	}
+	return todeg(y < 0 ? -a : a);
+}
+
+// solve the equation of Kepler for mean anomaly m in degrees; the
+// eccentric anomaly, in radians
+static double kepler(double m, double ecc)
+{
+	double e, delta;
+
+	e = m = torad(m);
+	do
+	{
+		delta = e - ecc * dsin(todeg(e)) - m;
+		e -= delta / (1 - ecc * dcos(todeg(e)));
+	} while (delta > 1E-6 || delta < -1E-6);
+	return e;
+}
+
+double moon_illumination(double pdate)
+{
+	double Day, N, M, Ec, Lambdasun, ml, MM, Ev, Ae, A3, MmP, mEc, A4, lP, V, lPP, MoonAge;
+
+	/* Calculation of the Sun's position */
+	Day = pdate - epoch;
+	N = fixangle((360 / 365.2422) * Day);
+	M = fixangle(N + elonge - elongp);
+	Ec = kepler(M, eccent);
+	/* True anomaly, 2 atan(ECCENT_FACTOR tan(Ec / 2)), to within a whole turn */
+	Ec = 2 * datan2(ECCENT_FACTOR * dsin(todeg(Ec / 2)), dcos(todeg(Ec / 2)));
+	Lambdasun = fixangle(Ec + elongp);
+
+	/* Calculation of the Moon's position */
+	ml = fixangle(13.1763966 * Day + mmlong);
+	MM = fixangle(ml - 0.1114041 * Day - mmlongp);
+	Ev = 1.2739 * dsin(2 * (ml - Lambdasun) - MM);
+	Ae = 0.1858 * dsin(M);
+	A3 = 0.37 * dsin(M);
+	MmP = MM + Ev - Ae - A3;
+	mEc = 6.2886 * dsin(MmP);
+	A4 = 0.214 * dsin(2 * MmP);
+	lP = ml + Ev + mEc - Ae + A4;
+	V = 0.6583 * dsin(2 * (lP - Lambdasun));
+	lPP = lP + V;
+
+	/* Age of the Moon in degrees, and the phase; the node and the Moon's
+	   latitude, which phase() also works out, do not enter it */
+	MoonAge = lPP - Lambdasun;
+	return (1 - dcos(MoonAge)) / 2;
+}
+
+int moon_phase_index(double illumination)
+{
+	return (int) (illumination * 14 + 0.5);
+}
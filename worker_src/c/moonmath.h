@@ -0,0 +1,21 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	moonmath.h
+
+   Purpose:	  		The moon phase model of util/moonlib.c, for the watch, which
+   					has no floating point math library.
+*/
+
+#ifndef MOONMATH_H
+#define MOONMATH_H
+
+#include <stdint.h>
+
+// illuminated fraction of the Moon's disc (0 to 1) at Julian date pdate,
+// as moonlib's phase() computes it with every term of Walker's model
+double moon_illumination(double pdate);
+
+// phase bucket 0-14 of an illuminated fraction, as util/moonlib.c rounds it
+int moon_phase_index(double illumination);
+
+#endif
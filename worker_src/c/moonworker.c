@@ -0,0 +1,105 @@
+/* Application:   	Pebble Moontiles Watchface
+
+   Filename: 	  	moonworker.c
+
+   Purpose:	  		Background worker that keeps the moon glyphs for the days
+   					ahead in persistent storage, so the watchface never does
+   					ephemeris work on its tick path.
+*/
+
+#include <pebble_worker.h>
+#include "moonmath.h"
+#include "../../src/c/calendar.h"
+#include "../../src/c/moonbuffer.h"
+
+/* Moon Phase (0-14), Waxing Character, Waning Character */
+static const char MoonPhaseCharLookup[15][2] =
+{
+	{'0','0'},  /* 0 */
+	{'A','Z'},  /* 1 */
+	{'B','Y'},  /* 2 */
+	{'C','X'},  /* 3 */
+	{'D','W'},  /* 4 */
+	{'E','V'},  /* 5 */
+	{'F','U'},  /* 6 */
+	{'G','T'},  /* 7 */
+	{'H','S'},  /* 8 */
+	{'I','R'},  /* 9 */
+	{'J','Q'}, /* 10 */
+	{'K','P'}, /* 11 */
+	{'L','O'}, /* 12 */
+	{'M','N'}, /* 13 */
+	{'1','1'}  /* 14 */
+};
+
+static MoonBuffer buffer;
+
+// utility function to drop the days before today from the buffer and work out
+// the days that then fit after its last one, as the old lookup table had it: the
+// phase at noon UT of each day, waxing if it is larger than the day before's
+static void refill(const struct tm *now)
+{
+	int32_t today = jdn_from_civil(now->tm_year + 1900, now->tm_mon + 1, now->tm_mday);
+
+	if (buffer.version != MOON_BUFFER_VERSION || today < buffer.first || today - buffer.first >= buffer.count)
+	{
+		/* Nothing held is still ahead: start over from today */
+		buffer.version = MOON_BUFFER_VERSION;
+		buffer.count = 0;
+	}
+	else
+	{
+		buffer.count -= today - buffer.first;
+	}
+	buffer.first = today;
+	if (buffer.count == MOON_BUFFER_DAYS)
+	{
+		return;
+	}
+
+	int32_t jdn = buffer.first + buffer.count;
+	double last = moon_illumination(jdn - 1);
+	for (; buffer.count < MOON_BUFFER_DAYS; buffer.count++, jdn++)
+	{
+		double illumination = moon_illumination(jdn);
+		buffer.glyph[jdn % MOON_BUFFER_DAYS] = MoonPhaseCharLookup[moon_phase_index(illumination)][last < illumination ? 0 : 1];
+		last = illumination;
+	}
+
+	persist_write_data(PERSIST_KEY_MOON, &buffer, sizeof(buffer));
+	AppWorkerMessage message = { .data0 = buffer.count };
+	app_worker_send_message(MOON_BUFFER_UPDATED, &message);
+}
+
+// callback function for day tick events: one more day comes into reach
+static void handle_day(struct tm *tick_time, TimeUnits units_changed)
+{
+	refill(tick_time);
+}
+
+static void worker_init(void)
+{
+	/* Only the worker writes this buffer, so what it wrote last is still there */
+	if (persist_read_data(PERSIST_KEY_MOON, &buffer, sizeof(buffer)) != (int) sizeof(buffer))
+	{
+		memset(&buffer, 0, sizeof(buffer));
+	}
+
+	time_t t;
+	time(&t);
+	refill(localtime(&t));
+	tick_timer_service_subscribe(DAY_UNIT, handle_day);
+}
+
+static void worker_deinit(void)
+{
+	tick_timer_service_unsubscribe();
+}
+
+// main entry point of the background worker
+int main(void)
+{
+	worker_init();
+	worker_event_loop();
+	worker_deinit();
+}